@@ -41,6 +41,139 @@
 using namespace H5Support_NAMESPACE;
 #endif
 
+namespace
+{
+// -----------------------------------------------------------------------------
+// Writes all of the strings as a 1D variable length string dataset with a
+// single H5Dwrite call. The caller is responsible for any locking.
+// -----------------------------------------------------------------------------
+herr_t writeVariableLengthStrings(hid_t loc_id, const std::string& dsetName, const std::vector<const char*>& data)
+{
+  hid_t sid = -1;
+  hid_t datatype = -1;
+  hid_t did = -1;
+  herr_t err = -1;
+  herr_t retErr = 0;
+
+  hsize_t dims[1] = {data.size()};
+  if((sid = H5Screate_simple(sizeof(dims) / sizeof(*dims), dims, nullptr)) >= 0)
+  {
+    datatype = H5Tcopy(H5T_C_S1);
+    H5Tset_size(datatype, H5T_VARIABLE);
+
+    if((did = H5Dcreate(loc_id, dsetName.c_str(), datatype, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) >= 0)
+    {
+      if(!data.empty())
+      {
+        err = H5Dwrite(did, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+        if(err < 0)
+        {
+          std::cout << "Error Writing String Data: " __FILE__ << "(" << __LINE__ << ")" << std::endl;
+          retErr = err;
+        }
+      }
+      CloseH5D(did, err, retErr);
+    }
+    else
+    {
+      retErr = static_cast<herr_t>(did);
+    }
+    H5Tclose(datatype);
+    CloseH5S(sid, err, retErr);
+  }
+  else
+  {
+    retErr = static_cast<herr_t>(sid);
+  }
+  return retErr;
+}
+
+// -----------------------------------------------------------------------------
+// Reads a 1D variable length string dataset with a single H5Dread call and
+// hands the HDF5 owned C strings to 'consume' before they are reclaimed. The
+// caller is responsible for any locking.
+// -----------------------------------------------------------------------------
+template <typename ConsumerType>
+herr_t readVariableLengthStrings(hid_t loc_id, const std::string& dsetName, ConsumerType consume)
+{
+  hid_t did; // dataset id
+  hid_t tid; // type id
+  herr_t err = 0;
+  herr_t retErr = 0;
+
+  did = H5Dopen(loc_id, dsetName.c_str(), H5P_DEFAULT);
+  if(did < 0)
+  {
+    std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Error opening Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")" << std::endl;
+    return -1;
+  }
+  /*
+  * Get the datatype.
+  */
+  tid = H5Dget_type(did);
+  if(tid >= 0)
+  {
+    hsize_t dims[1] = {0};
+    /*
+    * Get dataspace and allocate memory for read buffer.
+    */
+    hid_t sid = H5Dget_space(did);
+    int ndims = H5Sget_simple_extent_dims(sid, dims, nullptr);
+    if(ndims != 1)
+    {
+      CloseH5S(sid, err, retErr);
+      CloseH5T(tid, err, retErr);
+      CloseH5D(did, err, retErr);
+      std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Number of dims should be 1 but it was " << ndims << ". Returning early. Is your data file correct?" << std::endl;
+      return -2;
+    }
+    std::vector<char*> rdata(dims[0], nullptr);
+
+    /*
+    * Create the memory datatype.
+    */
+    hid_t memtype = H5Tcopy(H5T_C_S1);
+    herr_t status = H5Tset_size(memtype, H5T_VARIABLE);
+
+    /*
+    * Read the data.
+    */
+    if(!rdata.empty())
+    {
+      status = H5Dread(did, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata.data());
+      if(status < 0)
+      {
+        status = H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, rdata.data());
+        CloseH5S(sid, err, retErr);
+        CloseH5T(tid, err, retErr);
+        CloseH5T(memtype, err, retErr);
+        CloseH5D(did, err, retErr);
+        std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Error reading Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")" << std::endl;
+        return -3;
+      }
+    }
+    consume(rdata);
+    /*
+    * Close and release resources.  Note that H5Dvlen_reclaim works
+    * for variable-length strings as well as variable-length arrays.
+    * Also note that we must still free the array of pointers stored
+    * in rdata, as H5Tvlen_reclaim only frees the data these point to.
+    */
+    if(!rdata.empty())
+    {
+      status = H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, rdata.data());
+    }
+    CloseH5S(sid, err, retErr);
+    CloseH5T(tid, err, retErr);
+    CloseH5T(memtype, err, retErr);
+  }
+
+  CloseH5D(did, err, retErr);
+
+  return retErr;
+}
+} // namespace
+
 /*-------------------------------------------------------------------------
  * Function: find_dataset
  *
@@ -471,56 +604,22 @@ herr_t H5Lite::writeVectorOfStringsDataset(hid_t loc_id, const std::string& dset
 {
   H5SUPPORT_MUTEX_LOCK()
 
-  hid_t sid = -1;
-  hid_t memspace = -1;
-  hid_t datatype = -1;
-  hid_t did = -1;
-  herr_t err = -1;
-  herr_t retErr = 0;
-
-  hsize_t dims[1] = {data.size()};
-  if((sid = H5Screate_simple(sizeof(dims) / sizeof(*dims), dims, nullptr)) >= 0)
+  std::vector<const char*> strings(data.size());
+  for(size_t i = 0; i < data.size(); i++)
   {
-    dims[0] = 1;
-
-    if((memspace = H5Screate_simple(sizeof(dims) / sizeof(*dims), dims, nullptr)) >= 0)
-    {
-
-      datatype = H5Tcopy(H5T_C_S1);
-      H5Tset_size(datatype, H5T_VARIABLE);
-
-      if((did = H5Dcreate(loc_id, dsetName.c_str(), datatype, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) >= 0)
-      {
+    strings[i] = data[i].c_str();
+  }
+  return writeVariableLengthStrings(loc_id, dsetName, strings);
+}
 
-        //
-        // Select the "memory" to be written out - just 1 record.
-        hsize_t offset[] = {0};
-        hsize_t count[] = {1};
-        H5Sselect_hyperslab(memspace, H5S_SELECT_SET, offset, nullptr, count, nullptr);
-        hsize_t m_pos = 0;
-        for(auto v : data)
-        {
-          // Select the file position, 1 record at position 'pos'
-          hsize_t count[] = {1};
-          hsize_t offset[] = {m_pos++};
-          H5Sselect_hyperslab(sid, H5S_SELECT_SET, offset, nullptr, count, nullptr);
-          const char* s = v.c_str();
-          err = H5Dwrite(did, datatype, memspace, sid, H5P_DEFAULT, &s);
-          if(err < 0)
-          {
-            std::cout << "Error Writing String Data: " __FILE__ << "(" << __LINE__ << ")" << std::endl;
-            retErr = err;
-          }
-        }
-        CloseH5D(did, err, retErr);
-      }
-      H5Tclose(datatype);
-      CloseH5S(memspace, err, retErr);
-    }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5Lite::writeVectorOfCStringsDataset(hid_t loc_id, const std::string& dsetName, const std::vector<const char*>& data)
+{
+  H5SUPPORT_MUTEX_LOCK()
 
-    CloseH5S(sid, err, retErr);
-  }
-  return retErr;
+  return writeVariableLengthStrings(loc_id, dsetName, data);
 }
 
 // -----------------------------------------------------------------------------
@@ -884,86 +983,44 @@ herr_t H5Lite::readVectorOfStringDataset(hid_t loc_id, const std::string& dsetNa
 {
   H5SUPPORT_MUTEX_LOCK()
 
-  hid_t did; // dataset id
-  hid_t tid; // type id
-  herr_t err = 0;
-  herr_t retErr = 0;
-
-  did = H5Dopen(loc_id, dsetName.c_str(), H5P_DEFAULT);
-  if(did < 0)
-  {
-    std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Error opening Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")" << std::endl;
-    return -1;
-  }
-  /*
-  * Get the datatype.
-  */
-  tid = H5Dget_type(did);
-  if(tid >= 0)
-  {
-    hsize_t dims[1] = {0};
-    /*
-    * Get dataspace and allocate memory for read buffer.
-    */
-    hid_t sid = H5Dget_space(did);
-    int ndims = H5Sget_simple_extent_dims(sid, dims, nullptr);
-    if(ndims != 1)
-    {
-      CloseH5S(sid, err, retErr);
-      CloseH5T(tid, err, retErr);
-      std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Number of dims should be 1 but it was " << ndims << ". Returning early. Is your data file correct?" << std::endl;
-      return -2;
-    }
-    std::vector<char*> rdata(dims[0]);
-    for(int i = 0; i < dims[0]; i++)
+  return readVariableLengthStrings(loc_id, dsetName, [&data](const std::vector<char*>& rdata) {
+    data.resize(rdata.size());
+    for(size_t i = 0; i < rdata.size(); i++)
     {
-      rdata[i] = nullptr;
+      data[i] = (rdata[i] != nullptr) ? std::string(rdata[i]) : std::string();
     }
+  });
+}
 
-    /*
-    * Create the memory datatype.
-    */
-    hid_t memtype = H5Tcopy(H5T_C_S1);
-    herr_t status = H5Tset_size(memtype, H5T_VARIABLE);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5Lite::readVectorOfStringDataset(hid_t loc_id, const std::string& dsetName, std::vector<char>& buffer, std::vector<size_t>& offsets)
+{
+  H5SUPPORT_MUTEX_LOCK()
 
-    /*
-    * Read the data.
-    */
-    status = H5Dread(did, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, &(rdata.front()));
-    if(status < 0)
+  return readVariableLengthStrings(loc_id, dsetName, [&buffer, &offsets](const std::vector<char*>& rdata) {
+    std::vector<size_t> lengths(rdata.size(), 0);
+    size_t total = 0;
+    for(size_t i = 0; i < rdata.size(); i++)
     {
-      status = H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, &(rdata.front()));
-      CloseH5S(sid, err, retErr);
-      CloseH5T(tid, err, retErr);
-      CloseH5T(memtype, err, retErr);
-      std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Error reading Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")" << std::endl;
-      return -3;
+      lengths[i] = (rdata[i] != nullptr) ? std::strlen(rdata[i]) : 0;
+      total += lengths[i] + 1;
     }
-    /*
-    * copy the data into the vector of strings
-    */
-    data.resize(dims[0]);
-    for(int i = 0; i < dims[0]; i++)
+    size_t pos = buffer.size();
+    buffer.resize(pos + total);
+    offsets.resize(rdata.size());
+    for(size_t i = 0; i < rdata.size(); i++)
     {
-      // printf("%s[%d]: %s\n", "VlenStrings", i, rdata[i].p);
-      std::string str = std::string(rdata[i]);
-      data[i] = str;
+      offsets[i] = pos;
+      if(lengths[i] > 0)
+      {
+        std::memcpy(buffer.data() + pos, rdata[i], lengths[i]);
+      }
+      pos += lengths[i];
+      buffer[pos++] = '\0';
     }
-    /*
-    * Close and release resources.  Note that H5Dvlen_reclaim works
-    * for variable-length strings as well as variable-length arrays.
-    * Also note that we must still free the array of pointers stored
-    * in rdata, as H5Tvlen_reclaim only frees the data these point to.
-    */
-    status = H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, &(rdata.front()));
-    CloseH5S(sid, err, retErr);
-    CloseH5T(tid, err, retErr);
-    CloseH5T(memtype, err, retErr);
-  }
-
-  CloseH5D(did, err, retErr);
-
-  return retErr;
+  });
 }
 
 // -----------------------------------------------------------------------------
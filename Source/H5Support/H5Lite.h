@@ -662,6 +662,19 @@ namespace H5Support_NAMESPACE
       static H5Support_EXPORT herr_t writeVectorOfStringsDataset(hid_t loc_id,
                                                                  const std::string& dsetName,
                                                                  const std::vector<std::string>& data);
+
+      /**
+      * @brief Writes NUL terminated C strings as a 1D variable length string dataset
+      * using a single write call. The strings are not copied, so callers holding
+      * their strings in one contiguous buffer can pass pointers into that buffer.
+      * @param loc_id The parent location
+      * @param dsetName The name of the dataset to create
+      * @param data Pointers to the NUL terminated strings, one per element
+      * @return Standard HDF error condition
+      */
+      static H5Support_EXPORT herr_t writeVectorOfCStringsDataset(hid_t loc_id,
+                                                                  const std::string& dsetName,
+                                                                  const std::vector<const char*>& data);
       /**
        * @brief Writes an Attribute to an HDF5 Object
        * @param loc_id The Parent Location of the HDFobject that is getting the attribute
@@ -1302,6 +1315,21 @@ namespace H5Support_NAMESPACE
       static H5Support_EXPORT herr_t readVectorOfStringDataset(hid_t loc_id,
                                                                const std::string& dsetName,
                                                                std::vector<std::string>& data);
+
+      /**
+      * @brief Reads a 1D variable length string dataset into a single buffer of
+      * NUL terminated strings. The strings are appended after any bytes already in
+      * the buffer and offsets[i] is the position of string i in the buffer.
+      * @param loc_id The parent location
+      * @param dsetName The name of the dataset to read
+      * @param buffer Receives the NUL terminated strings back to back
+      * @param offsets Receives the starting position of each string
+      * @return Standard HDF error condition
+      */
+      static H5Support_EXPORT herr_t readVectorOfStringDataset(hid_t loc_id,
+                                                               const std::string& dsetName,
+                                                               std::vector<char>& buffer,
+                                                               std::vector<size_t>& offsets);
       /**
        * @brief Reads an Attribute from an HDF5 Object.
        *
@@ -48,8 +48,11 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDebug>
 #include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
 #include <QtCore/QString>
 
+#include <hdf5.h>
+
 // DREAM3DLib includes
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
@@ -57,11 +60,76 @@
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineBatch.h"
+#include "SIMPLib/Filtering/PipelineProfile.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/ThreadScheduler.h"
+
+// -----------------------------------------------------------------------------
+// Runs the pipeline once for every job of the manifest and writes the summary
+// -----------------------------------------------------------------------------
+int runBatch(const FilterPipeline::Pointer& pipeline, const QString& manifestFile, uint32_t maxJobs, uint64_t maxMemoryBytes, bool fuseFilters, const QString& summaryFile)
+{
+  QString errorMessage;
+  std::vector<PipelineBatch::Job> jobs = PipelineBatch::ReadManifest(manifestFile, errorMessage);
+  if(!errorMessage.isEmpty())
+  {
+    std::cout << errorMessage.toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  PipelineBatch::Pointer batch = PipelineBatch::New(pipeline->toJson());
+  batch->setMaxConcurrentJobs(maxJobs);
+  batch->setMaxMemoryBytes(maxMemoryBytes);
+  batch->setFuseElementWiseFilters(fuseFilters);
+  for(const auto& job : jobs)
+  {
+    batch->addJob(job);
+  }
+
+#ifndef H5_HAVE_THREADSAFE
+  if(maxJobs != 1 && jobs.size() > 1)
+  {
+    std::cout << "The HDF5 library is not thread safe, so the jobs run one at a time." << std::endl;
+  }
+#endif
+
+  std::cout << "Batch Job Count: " << jobs.size() << std::endl;
+  std::cout << "Concurrent Jobs: " << batch->getJobConcurrency() << std::endl;
+  std::vector<PipelineBatch::Result> results = batch->run();
+
+  int failedCount = 0;
+  for(const auto& result : results)
+  {
+    std::cout << result.Name.toStdString() << ": " << result.Status.toStdString() << " (" << result.WallTime << " ms)" << std::endl;
+    for(const QString& error : result.Errors)
+    {
+      std::cout << "    " << error.toStdString() << std::endl;
+    }
+    if(result.Status != "Completed")
+    {
+      failedCount++;
+    }
+  }
+
+  if(!summaryFile.isEmpty())
+  {
+    QFile file(summaryFile);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+      std::cout << "The summary could not be written to '" << summaryFile.toStdString() << "'" << std::endl;
+      return EXIT_FAILURE;
+    }
+    file.write(QJsonDocument(batch->getSummary()).toJson());
+    std::cout << "Summary File: " << summaryFile.toStdString() << std::endl;
+  }
+
+  return (failedCount == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
 
 // -----------------------------------------------------------------------------
 //
@@ -91,10 +159,46 @@ int main(int argc, char* argv[])
                                      "Pipeline File as a JSON file.", "file");
   parser.addOption(pipelineFileArg);
 
+  QCommandLineOption profileFileArg(QStringList() << "profile",
+                                    "Write a Chrome trace of the pipeline execution to the file. Open it with chrome://tracing or ui.perfetto.dev.", "file");
+  parser.addOption(profileFileArg);
+
+  QCommandLineOption batchFileArg(QStringList() << "b"
+                                                << "batch",
+                                  "Run the pipeline once for every job of the manifest JSON file, which lists the parameter overrides of each job.", "file");
+  parser.addOption(batchFileArg);
+
+  QCommandLineOption jobsArg(QStringList() << "j"
+                                           << "jobs",
+                             "The most batch jobs that run at the same time. Defaults to the number of hardware threads. The jobs always run one at a time when the HDF5 library is not thread safe.", "count", "0");
+  parser.addOption(jobsArg);
+
+  QCommandLineOption maxMemoryArg(QStringList() << "max-memory",
+                                  "Start no new batch job while the data of the whole process takes up this many megabytes or more. One large job holds back all others.", "MB", "0");
+  parser.addOption(maxMemoryArg);
+
+  QCommandLineOption summaryFileArg(QStringList() << "summary",
+                                    "Write the status, timing and errors of every batch job to this JSON file.", "file");
+  parser.addOption(summaryFileArg);
+
+  QCommandLineOption fusionArg(QStringList() << "fuse",
+                               "Run consecutive element-wise filters on the same Attribute Matrix as one pass over the data instead of executing every filter on its own.");
+  parser.addOption(fusionArg);
+
+  QCommandLineOption threadsArg(QStringList() << "t"
+                                              << "threads",
+                                "The most threads the filters of each pipeline, or of each batch job, use at once. Defaults to all hardware threads.", "count", "0");
+  parser.addOption(threadsArg);
+
+  QCommandLineOption pinThreadsArg(QStringList() << "pin-threads",
+                                   "Pin every worker thread to one core.");
+  parser.addOption(pinThreadsArg);
+
   // Process the actual command line arguments given by the user
   parser.process(*app);
 
   QString pipelineFile = parser.value(pipelineFileArg);
+  QString profileFile = parser.value(profileFileArg);
 
   std::cout << "PipelineRunner " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
   std::cout << "Input File: " << pipelineFile.toStdString() << std::endl;
@@ -105,6 +209,10 @@ int main(int argc, char* argv[])
 
   QMetaObjectUtilities::RegisterMetaTypes();
 
+  ThreadScheduler* scheduler = ThreadScheduler::Instance();
+  scheduler->setMaxThreadsPerPipeline(parser.value(threadsArg).toUInt());
+  scheduler->setThreadPinning(parser.isSet(pinThreadsArg));
+
   int err = 0;
 
   // Sanity Check the filepath to make sure it exists, Report an error and bail if it does not
@@ -142,6 +250,14 @@ int main(int argc, char* argv[])
   }
 
   std::cout << "Pipeline Count: " << pipeline->size() << std::endl;
+
+  if(parser.isSet(batchFileArg))
+  {
+    uint32_t maxJobs = parser.value(jobsArg).toUInt();
+    uint64_t maxMemoryBytes = parser.value(maxMemoryArg).toULongLong() * 1024 * 1024;
+    return runBatch(pipeline, parser.value(batchFileArg), maxJobs, maxMemoryBytes, parser.isSet(fusionArg), parser.value(summaryFileArg));
+  }
+
   Observer obs; // Create an Observer to report errors/progress from the executing pipeline
   pipeline->addMessageReceiver(&obs);
   // Preflight the pipeline
@@ -151,9 +267,45 @@ int main(int argc, char* argv[])
     std::cout << "Errors preflighting the pipeline. Exiting Now." << std::endl;
     return EXIT_FAILURE;
   }
+  PipelineProfile::Pointer profile;
+  if(!profileFile.isEmpty())
+  {
+    profile = PipelineProfile::New();
+    pipeline->setProfile(profile);
+  }
+  pipeline->setFuseElementWiseFilters(parser.isSet(fusionArg));
   // Now actually execute the pipeline
   pipeline->execute();
   err = pipeline->getErrorCode();
+  for(const ElementWiseFusion::Group& group : pipeline->getFusedFilterGroups())
+  {
+    std::cout << "Fused Filters:";
+    for(size_t index : group.FilterIndices)
+    {
+      std::cout << " [" << (index + 1) << "]";
+    }
+    std::cout << " over " << group.AttributeMatrixPath.serialize().toStdString() << std::endl;
+  }
+  if(nullptr != profile.get())
+  {
+    for(const PipelineProfile::FilterRecord& record : profile->getFilterRecords())
+    {
+      std::cout << "[" << (record.PipelineIndex + 1) << "] " << record.HumanLabel.toStdString() << ": " << (record.WallTime / 1000) << " ms wall, " << (record.ProcessCpuTime / 1000) << " ms process CPU, "
+                << (record.BytesAllocated / (1024 * 1024)) << " MB allocated" << std::endl;
+    }
+    ThreadScheduler::Arena::Pointer arena = pipeline->getThreadArena();
+    ThreadScheduler::Statistics threadStatistics = arena->getStatistics();
+    std::cout << "Parallel Regions: " << threadStatistics.Regions << " on up to " << arena->getMaxConcurrency() << " threads, busy "
+              << static_cast<int>(threadStatistics.getUtilization() * 100.0) << "% of the time" << std::endl;
+    if(profile->writeChromeTrace(profileFile))
+    {
+      std::cout << "Profile File: " << profileFile.toStdString() << std::endl;
+    }
+    else
+    {
+      std::cout << "The profile could not be written to '" << profileFile.toStdString() << "'" << std::endl;
+    }
+  }
   if(err < 0)
   {
     std::cout << "Error Condition of Pipeline: " << err << std::endl;
@@ -64,6 +64,7 @@
 #include "SIMPLib/REST/V1Controllers/SIMPLStaticFileController.h"
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/ThreadScheduler.h"
 
 // -----------------------------------------------------------------------------
 // Search the configuration file
@@ -139,6 +140,11 @@ int main(int argc, char* argv[])
   QSettings config(configFileName, QSettings::IniFormat, &app);
   ServerSettings serverSettings(config);
 
+  // Pipelines that execute at the same time share the cores, each is held to this many threads
+  ThreadScheduler* scheduler = ThreadScheduler::Instance();
+  scheduler->setMaxThreadsPerPipeline(config.value("pipelines/maxThreadsPerPipeline", 0).toUInt());
+  scheduler->setThreadPinning(config.value("pipelines/pinThreads", false).toBool());
+
   HttpSessionStore* sessionStore = HttpSessionStore::CreateInstance(&serverSettings, &app);
   sessionStore = nullptr; // This is here to quiet the compiler about unused variable.
   // Configure static file controller
@@ -0,0 +1,250 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "MessageBus.h"
+
+#include <QtCore/QHash>
+
+#include "SIMPLib/Common/Observable.h"
+#include "SIMPLib/Messages/AbstractErrorMessage.h"
+#include "SIMPLib/Messages/AbstractProgressMessage.h"
+#include "SIMPLib/Messages/AbstractWarningMessage.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MessageBus::MessageBus(size_t capacity)
+: m_EnqueuePos(0)
+, m_DequeuePos(0)
+, m_Overflowing(false)
+, m_DroppedCount(0)
+, m_CoalescedCount(0)
+{
+  size_t size = 2;
+  while(size < capacity)
+  {
+    size *= 2;
+  }
+  m_Cells.reset(new Cell[size]);
+  for(size_t i = 0; i < size; i++)
+  {
+    m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+  }
+  m_Mask = size - 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MessageBus::~MessageBus() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t MessageBus::getCapacity() const
+{
+  return m_Mask + 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t MessageBus::getDroppedCount() const
+{
+  return m_DroppedCount.load();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t MessageBus::getCoalescedCount() const
+{
+  return m_CoalescedCount.load();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MessageBus::tryPush(Observable* source, const AbstractMessage::Pointer& msg)
+{
+  // Each cell's sequence tells whose turn it is: equal to the position when it is free
+  // for the producer that claims that position, one past it when it holds a message.
+  size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+  Cell* cell = nullptr;
+  for(;;)
+  {
+    cell = &m_Cells[pos & m_Mask];
+    size_t seq = cell->Sequence.load(std::memory_order_acquire);
+    std::ptrdiff_t dif = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+    if(dif == 0)
+    {
+      if(m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if(dif < 0)
+    {
+      return false;
+    }
+    else
+    {
+      pos = m_EnqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+  cell->Value.Source = source;
+  cell->Value.Message = msg;
+  cell->Sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MessageBus::tryPop(Entry& entry)
+{
+  size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+  Cell* cell = nullptr;
+  for(;;)
+  {
+    cell = &m_Cells[pos & m_Mask];
+    size_t seq = cell->Sequence.load(std::memory_order_acquire);
+    std::ptrdiff_t dif = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+    if(dif == 0)
+    {
+      if(m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if(dif < 0)
+    {
+      return false;
+    }
+    else
+    {
+      pos = m_DequeuePos.load(std::memory_order_relaxed);
+    }
+  }
+  entry = std::move(cell->Value);
+  cell->Value.Message.reset();
+  cell->Sequence.store(pos + m_Mask + 1, std::memory_order_release);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MessageBus::post(Observable* source, const AbstractMessage::Pointer& msg)
+{
+  // Once anything overflowed, later messages wait behind it so they stay in order
+  if(!m_Overflowing.load(std::memory_order_acquire) && tryPush(source, msg))
+  {
+    return true;
+  }
+
+  const AbstractMessage* message = msg.get();
+  if(nullptr == dynamic_cast<const AbstractErrorMessage*>(message) && nullptr == dynamic_cast<const AbstractWarningMessage*>(message))
+  {
+    const AbstractProgressMessage* progressMessage = dynamic_cast<const AbstractProgressMessage*>(message);
+    if(nullptr != progressMessage)
+    {
+      source->releaseQueuedProgress(progressMessage->getProgressValue(), progressMessage->getMessageText());
+    }
+    m_DroppedCount++;
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(m_OverflowMutex);
+  m_Overflow.push_back({source, msg});
+  m_Overflowing.store(true, std::memory_order_release);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t MessageBus::drain()
+{
+  std::lock_guard<std::mutex> drainLock(m_DrainMutex);
+
+  std::vector<Entry> entries;
+  Entry entry;
+  while(tryPop(entry))
+  {
+    entries.push_back(std::move(entry));
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_OverflowMutex);
+    for(auto& overflowEntry : m_Overflow)
+    {
+      entries.push_back(std::move(overflowEntry));
+    }
+    m_Overflow.clear();
+    m_Overflowing.store(false, std::memory_order_release);
+  }
+
+  // A progress message is only kept if nothing else from its source follows it before
+  // the next progress message of that source
+  std::vector<bool> keep(entries.size(), true);
+  QHash<Observable*, size_t> lastProgress;
+  for(size_t i = 0; i < entries.size(); i++)
+  {
+    const AbstractProgressMessage* progressMessage = dynamic_cast<const AbstractProgressMessage*>(entries[i].Message.get());
+    if(nullptr == progressMessage)
+    {
+      lastProgress.remove(entries[i].Source);
+      continue;
+    }
+    entries[i].Source->releaseQueuedProgress(progressMessage->getProgressValue(), progressMessage->getMessageText());
+    auto iter = lastProgress.find(entries[i].Source);
+    if(iter != lastProgress.end())
+    {
+      keep[iter.value()] = false;
+      m_CoalescedCount++;
+    }
+    lastProgress[entries[i].Source] = i;
+  }
+
+  size_t delivered = 0;
+  for(size_t i = 0; i < entries.size(); i++)
+  {
+    if(keep[i])
+    {
+      emit entries[i].Source->messageGenerated(entries[i].Message);
+      delivered++;
+    }
+  }
+  return delivered;
+}
@@ -0,0 +1,156 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Messages/AbstractMessage.h"
+#include "SIMPLib/SIMPLib.h"
+
+class Observable;
+
+/**
+ * @brief The MessageBus class carries the messages of Observables that are attached to it
+ * with Observable::setMessageBus(). post() may be called from any thread and never blocks:
+ * the message goes into a bounded lock-free ring and drain() later emits everything that
+ * was posted from the thread that calls it, in the order it was posted.
+ *
+ * drain() keeps only the last of several progress messages from the same Observable that
+ * follow each other, and a progress message with the same value and text as one that is
+ * still waiting in the ring is dropped by the Observable before it is even created. When the ring
+ * is full, status and progress messages are dropped and counted; warnings and errors are
+ * never dropped but go to a locked overflow list instead.
+ *
+ * Observables must stay alive until the messages they posted have been drained.
+ */
+class SIMPLib_EXPORT MessageBus
+{
+public:
+  SIMPL_TYPE_MACRO(MessageBus)
+
+  static const size_t k_DefaultCapacity = 4096;
+
+  /**
+   * @brief MessageBus
+   * @param capacity The number of messages the ring holds, rounded up to a power of two
+   */
+  MessageBus(size_t capacity = k_DefaultCapacity);
+
+  virtual ~MessageBus();
+
+  /**
+   * @brief Adds a message of the source to the ring. Safe to call from any thread.
+   * @param source
+   * @param msg
+   * @return false if the message was dropped because the ring was full
+   */
+  bool post(Observable* source, const AbstractMessage::Pointer& msg);
+
+  /**
+   * @brief Emits the messageGenerated() signal of the source of every message posted so far,
+   * after coalescing the progress messages. Only one thread drains at a time.
+   * @return The number of messages that were emitted
+   */
+  size_t drain();
+
+  /**
+   * @brief Returns the number of messages the ring holds
+   * @return
+   */
+  size_t getCapacity() const;
+
+  /**
+   * @brief Returns the number of status and progress messages dropped because the ring was full
+   * @return
+   */
+  uint64_t getDroppedCount() const;
+
+  /**
+   * @brief Returns the number of progress messages that were replaced by a later one
+   * @return
+   */
+  uint64_t getCoalescedCount() const;
+
+protected:
+  struct Entry
+  {
+    Observable* Source = nullptr;
+    AbstractMessage::Pointer Message;
+  };
+
+  /**
+   * @brief Adds the entry to the ring
+   * @return false if the ring is full
+   */
+  bool tryPush(Observable* source, const AbstractMessage::Pointer& msg);
+
+  /**
+   * @brief Takes the oldest entry out of the ring
+   * @return false if the ring is empty
+   */
+  bool tryPop(Entry& entry);
+
+private:
+  struct Cell
+  {
+    std::atomic<size_t> Sequence;
+    Entry Value;
+  };
+
+  std::unique_ptr<Cell[]> m_Cells;
+  size_t m_Mask = 0;
+  std::atomic<size_t> m_EnqueuePos;
+  std::atomic<size_t> m_DequeuePos;
+
+  std::mutex m_OverflowMutex;
+  std::vector<Entry> m_Overflow;
+  std::atomic<bool> m_Overflowing;
+
+  std::mutex m_DrainMutex;
+  std::atomic<uint64_t> m_DroppedCount;
+  std::atomic<uint64_t> m_CoalescedCount;
+
+public:
+  MessageBus(const MessageBus&) = delete;            // Copy Constructor Not Implemented
+  MessageBus(MessageBus&&) = delete;                 // Move Constructor Not Implemented
+  MessageBus& operator=(const MessageBus&) = delete; // Copy Assignment Not Implemented
+  MessageBus& operator=(MessageBus&&) = delete;      // Move Assignment Not Implemented
+};
@@ -35,6 +35,7 @@
 
 #include "Observable.h"
 
+#include "SIMPLib/Common/MessageBus.h"
 #include "SIMPLib/Messages/GenericErrorMessage.h"
 #include "SIMPLib/Messages/GenericProgressMessage.h"
 #include "SIMPLib/Messages/GenericStatusMessage.h"
@@ -45,6 +46,7 @@
 // -----------------------------------------------------------------------------
 Observable::Observable()
 : QObject(nullptr)
+, m_QueuedProgress(-1)
 {
 }
 
@@ -52,6 +54,7 @@ Observable::Observable()
 //
 // -----------------------------------------------------------------------------
 Observable::Observable(const Observable&)
+: m_QueuedProgress(-1)
 {
 }
 
@@ -73,7 +76,7 @@ void Observable::operator=(const Observable&)
 void Observable::setErrorCondition(int code, const QString &messageText)
 {
   GenericErrorMessage::Pointer pm = GenericErrorMessage::New(messageText, code);
-  emit messageGenerated(pm);
+  sendMessage(pm);
 }
 
 // -----------------------------------------------------------------------------
@@ -93,7 +96,7 @@ void Observable::setErrorConditionWithPrefix(int code, const QString &prefix, co
 void Observable::setWarningCondition(int code, const QString& messageText)
 {
   GenericWarningMessage::Pointer pm = GenericWarningMessage::New(messageText, code);
-  emit messageGenerated(pm);
+  sendMessage(pm);
 }
 
 // -----------------------------------------------------------------------------
@@ -113,7 +116,7 @@ void Observable::setWarningConditionWithPrefix(int code, const QString &prefix,
 void Observable::notifyStatusMessage(const QString& messageText)
 {
   GenericStatusMessage::Pointer pm = GenericStatusMessage::New(messageText);
-  emit messageGenerated(pm);
+  sendMessage(pm);
 }
 
 // -----------------------------------------------------------------------------
@@ -132,8 +135,12 @@ void Observable::notifyStatusMessageWithPrefix(const QString &prefix, const QStr
 // -----------------------------------------------------------------------------
 void Observable::notifyProgressMessage(int progress, const QString& messageText)
 {
+  if(isProgressQueued(progress, messageText))
+  {
+    return;
+  }
   GenericProgressMessage::Pointer pm = GenericProgressMessage::New(messageText, progress);
-  emit messageGenerated(pm);
+  sendMessage(pm);
 }
 
 // -----------------------------------------------------------------------------
@@ -146,3 +153,67 @@ void Observable::notifyProgressMessageWithPrefix(int progress, const QString &pr
 
   notifyProgressMessage(progress, msg);
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Observable::setMessageBus(MessageBus* bus)
+{
+  m_MessageBus = bus;
+  std::lock_guard<std::mutex> lock(m_QueuedProgressMutex);
+  m_QueuedProgress = -1;
+  m_QueuedProgressText.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MessageBus* Observable::getMessageBus() const
+{
+  return m_MessageBus;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Observable::sendMessage(const AbstractMessage::Pointer& msg)
+{
+  if(nullptr != m_MessageBus)
+  {
+    m_MessageBus->post(this, msg);
+    return;
+  }
+  emit messageGenerated(msg);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool Observable::isProgressQueued(int progress, const QString& messageText)
+{
+  if(nullptr == m_MessageBus)
+  {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(m_QueuedProgressMutex);
+  if(m_QueuedProgress == progress && m_QueuedProgressText == messageText)
+  {
+    return true;
+  }
+  m_QueuedProgress = progress;
+  m_QueuedProgressText = messageText;
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Observable::releaseQueuedProgress(int progress, const QString& messageText)
+{
+  std::lock_guard<std::mutex> lock(m_QueuedProgressMutex);
+  if(m_QueuedProgress == progress && m_QueuedProgressText == messageText)
+  {
+    m_QueuedProgress = -1;
+    m_QueuedProgressText.clear();
+  }
+}
@@ -36,12 +36,15 @@
 
 #pragma once
 
+#include <mutex>
+
 #include <QtCore/QString>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Messages/AbstractMessage.h"
 
+class MessageBus;
 
 /**
  * @class Observable Observable.h DREAM3D/Common/Observable.h
@@ -94,6 +97,20 @@ class SIMPLib_EXPORT Observable : public QObject
 
     void notifyProgressMessageWithPrefix(int progress, const QString &prefix, const QString& messageText);
 
+    /**
+     * @brief Sends the messages of this object through the bus instead of emitting them
+     * directly, which makes the methods above safe to call from any thread. nullptr goes
+     * back to emitting directly.
+     * @param bus
+     */
+    void setMessageBus(MessageBus* bus);
+
+    /**
+     * @brief Returns the bus set with setMessageBus(), or nullptr
+     * @return
+     */
+    MessageBus* getMessageBus() const;
+
   signals:
 
     /**
@@ -101,6 +118,37 @@ class SIMPLib_EXPORT Observable : public QObject
      * @param msg
      */
     void messageGenerated(const AbstractMessage::Pointer& msg);
+
+  protected:
+    /**
+     * @brief Posts the message to the message bus if there is one, otherwise emits it
+     * @param msg
+     */
+    void sendMessage(const AbstractMessage::Pointer& msg);
+
+    /**
+     * @brief Returns true if a progress message with the same value and text is still waiting
+     * in the message bus, in which case there is no need to create another one
+     * @param progress
+     * @param messageText
+     * @return
+     */
+    bool isProgressQueued(int progress, const QString& messageText);
+
+  private:
+    friend class MessageBus;
+
+    /**
+     * @brief Called by the message bus once a progress message has left it
+     * @param progress
+     * @param messageText
+     */
+    void releaseQueuedProgress(int progress, const QString& messageText);
+
+    MessageBus* m_MessageBus = nullptr;
+    std::mutex m_QueuedProgressMutex;
+    int m_QueuedProgress;
+    QString m_QueuedProgressText;
 };
 
 
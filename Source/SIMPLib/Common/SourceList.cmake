@@ -22,6 +22,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Constants.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CreatedArrayHelpIndexEntry.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IObserver.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MessageBus.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PhaseType.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibDLLExport.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibSetGetMacros.h
@@ -41,6 +42,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DocRequestManager.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/EnsembleInfo.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IObserver.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MessageBus.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Observable.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Observer.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PhaseType.cpp
@@ -0,0 +1,237 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "SIMPLib/Common/MessageBus.h"
+#include "SIMPLib/Common/Observable.h"
+#include "SIMPLib/Messages/AbstractErrorMessage.h"
+#include "SIMPLib/Messages/AbstractProgressMessage.h"
+#include "SIMPLib/Messages/AbstractStatusMessage.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class MessageBusTest
+{
+public:
+  MessageBusTest() = default;
+  virtual ~MessageBusTest() = default;
+
+  MessageBusTest(const MessageBusTest&) = delete;            // Copy Constructor Not Implemented
+  MessageBusTest(MessageBusTest&&) = delete;                 // Move Constructor Not Implemented
+  MessageBusTest& operator=(const MessageBusTest&) = delete; // Copy Assignment Not Implemented
+  MessageBusTest& operator=(MessageBusTest&&) = delete;      // Move Assignment Not Implemented
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void collectMessages(Observable* obs, std::vector<AbstractMessage::Pointer>& messages)
+  {
+    QObject::connect(obs, &Observable::messageGenerated, [&messages](const AbstractMessage::Pointer& msg) { messages.push_back(msg); });
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int getProgress(const AbstractMessage::Pointer& msg)
+  {
+    const AbstractProgressMessage* progressMessage = dynamic_cast<const AbstractProgressMessage*>(msg.get());
+    return nullptr == progressMessage ? -1 : progressMessage->getProgressValue();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCoalescing()
+  {
+    MessageBus bus(16);
+    DREAM3D_REQUIRE_EQUAL(bus.getCapacity(), 16)
+
+    Observable obs;
+    std::vector<AbstractMessage::Pointer> messages;
+    collectMessages(&obs, messages);
+    obs.setMessageBus(&bus);
+
+    obs.notifyStatusMessage("a");
+    obs.notifyProgressMessage(10, "");
+    obs.notifyProgressMessage(20, "");
+    obs.notifyStatusMessage("b");
+    obs.notifyProgressMessage(30, "");
+    obs.notifyProgressMessage(40, "");
+    obs.notifyProgressMessage(50, "");
+    DREAM3D_REQUIRE_EQUAL(messages.size(), 0)
+
+    DREAM3D_REQUIRE_EQUAL(bus.drain(), 4)
+    DREAM3D_REQUIRE_EQUAL(messages.size(), 4)
+    DREAM3D_REQUIRE(messages[0]->getMessageText() == "a")
+    DREAM3D_REQUIRE_EQUAL(getProgress(messages[1]), 20)
+    DREAM3D_REQUIRE(messages[2]->getMessageText() == "b")
+    DREAM3D_REQUIRE_EQUAL(getProgress(messages[3]), 50)
+    DREAM3D_REQUIRE_EQUAL(bus.getCoalescedCount(), 3)
+
+    // The same progress is only queued once until it is drained
+    messages.clear();
+    obs.notifyProgressMessage(60, "");
+    obs.notifyProgressMessage(60, "");
+    DREAM3D_REQUIRE_EQUAL(bus.drain(), 1)
+    obs.notifyProgressMessage(60, "");
+    DREAM3D_REQUIRE_EQUAL(bus.drain(), 1)
+    DREAM3D_REQUIRE_EQUAL(messages.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(bus.getCoalescedCount(), 3)
+
+    // A new text with the same progress is not dropped, and the newest one is delivered
+    messages.clear();
+    obs.notifyProgressMessage(60, "Reading");
+    obs.notifyProgressMessage(60, "Writing");
+    DREAM3D_REQUIRE_EQUAL(bus.drain(), 1)
+    DREAM3D_REQUIRE_EQUAL(messages.size(), 1)
+    DREAM3D_REQUIRE(messages[0]->getMessageText() == "Writing")
+    DREAM3D_REQUIRE_EQUAL(bus.getCoalescedCount(), 4)
+
+    // Without a bus the messages are emitted right away
+    messages.clear();
+    obs.setMessageBus(nullptr);
+    obs.notifyProgressMessage(70, "");
+    DREAM3D_REQUIRE_EQUAL(messages.size(), 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFullRing()
+  {
+    MessageBus bus(4);
+    Observable obs;
+    std::vector<AbstractMessage::Pointer> messages;
+    collectMessages(&obs, messages);
+    obs.setMessageBus(&bus);
+
+    for(int i = 0; i < 6; i++)
+    {
+      obs.notifyStatusMessage(QString::number(i));
+    }
+    obs.setErrorCondition(-1, "error");
+    obs.notifyStatusMessage("after");
+    DREAM3D_REQUIRE_EQUAL(bus.getDroppedCount(), 3)
+
+    DREAM3D_REQUIRE_EQUAL(bus.drain(), 5)
+    for(int i = 0; i < 4; i++)
+    {
+      DREAM3D_REQUIRE(messages[i]->getMessageText() == QString::number(i))
+    }
+    DREAM3D_REQUIRE_VALID_POINTER(dynamic_cast<const AbstractErrorMessage*>(messages[4].get()))
+
+    // The ring is usable again once it was drained
+    obs.notifyStatusMessage("again");
+    DREAM3D_REQUIRE_EQUAL(bus.drain(), 1)
+    DREAM3D_REQUIRE(messages.back()->getMessageText() == "again")
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConcurrentPosting()
+  {
+    const int numThreads = 4;
+    const int numMessages = 20000;
+
+    MessageBus bus(256);
+    std::vector<std::unique_ptr<Observable>> sources;
+    std::vector<std::vector<AbstractMessage::Pointer>> messages(numThreads);
+    for(int t = 0; t < numThreads; t++)
+    {
+      sources.emplace_back(new Observable());
+      collectMessages(sources.back().get(), messages[t]);
+      sources.back()->setMessageBus(&bus);
+    }
+
+    std::atomic<int> running(numThreads);
+    std::vector<std::thread> threads;
+    for(int t = 0; t < numThreads; t++)
+    {
+      Observable* source = sources[t].get();
+      threads.emplace_back([source, &running, numMessages]() {
+        for(int i = 0; i < numMessages; i++)
+        {
+          source->notifyStatusMessage(QString::number(i));
+        }
+        running--;
+      });
+    }
+    while(running > 0)
+    {
+      bus.drain();
+    }
+    for(auto& thread : threads)
+    {
+      thread.join();
+    }
+    bus.drain();
+
+    size_t delivered = 0;
+    for(int t = 0; t < numThreads; t++)
+    {
+      // Whatever was not dropped arrives in the order each thread posted it
+      int last = -1;
+      for(const auto& msg : messages[t])
+      {
+        int value = msg->getMessageText().toInt();
+        DREAM3D_REQUIRED(value, >, last)
+        last = value;
+      }
+      delivered += messages[t].size();
+    }
+    DREAM3D_REQUIRE_EQUAL(delivered + bus.getDroppedCount(), numThreads * numMessages)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### MessageBusTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestCoalescing())
+    DREAM3D_REGISTER_TEST(TestFullRing())
+    DREAM3D_REGISTER_TEST(TestConcurrentPosting())
+  }
+};
@@ -67,6 +67,7 @@ void ConditionalSetValue::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("New Value", ReplaceValue, FilterParameter::Parameter, ConditionalSetValue));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Category::Any);
+    req.daTypes.push_back(SIMPL::TypeNames::BitMaskArray);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Conditional Array", ConditionalArrayPath, FilterParameter::RequiredArray, ConditionalSetValue, req));
   }
   {
@@ -140,6 +141,100 @@ template <typename T> void replaceValue(AbstractFilter* filter, IDataArray::Poin
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void replaceValueWithMask(AbstractFilter* filter, IDataArray::Pointer inDataPtr, BitMaskArray::Pointer maskPtr, double replaceValue)
+{
+  typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
+
+  T replaceVal = static_cast<T>(replaceValue);
+
+  T* inData = inputArrayPtr->getPointer(0);
+  const BitMaskArray::WordType* words = maskPtr->getWordPointer(0);
+  size_t numWords = maskPtr->getNumberOfWords();
+
+  for(size_t w = 0; w < numWords; w++)
+  {
+    // Words without any true values are skipped entirely
+    BitMaskArray::WordType word = words[w];
+    size_t iter = w * BitMaskArray::k_BitsPerWord;
+    while(word != 0)
+    {
+      if((word & 1) != 0)
+      {
+        inData[iter] = replaceVal;
+      }
+      word >>= 1;
+      iter++;
+    }
+  }
+}
+
+/**
+ * @brief Sets the tuples whose condition is true to the replace value, for the fused
+ * execution of the filter
+ */
+template <typename T> class ConditionalSetValueKernel : public ElementWiseKernel
+{
+public:
+  ConditionalSetValueKernel(T* data, const bool* condition, const BitMaskArray* mask, T replaceValue)
+  : m_Data(data)
+  , m_Condition(condition)
+  , m_Mask(mask)
+  , m_ReplaceValue(replaceValue)
+  {
+  }
+
+  ~ConditionalSetValueKernel() override = default;
+
+  void process(size_t start, size_t end) const override
+  {
+    if(nullptr != m_Mask)
+    {
+      for(size_t iter = start; iter < end; iter++)
+      {
+        if(m_Mask->getValue(iter))
+        {
+          m_Data[iter] = m_ReplaceValue;
+        }
+      }
+      return;
+    }
+    for(size_t iter = start; iter < end; iter++)
+    {
+      if(m_Condition[iter])
+      {
+        m_Data[iter] = m_ReplaceValue;
+      }
+    }
+  }
+
+private:
+  T* m_Data = nullptr;
+  const bool* m_Condition = nullptr;
+  const BitMaskArray* m_Mask = nullptr;
+  T m_ReplaceValue;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+void createConditionalSetValueKernel(IDataArray::Pointer inDataPtr, BoolArrayType::Pointer condDataPtr, BitMaskArray::Pointer maskPtr, double replaceValue, ElementWiseKernel::Pointer& kernel)
+{
+  typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
+
+  // The bit packed mask takes precedence, as it does in execute()
+  const bool* condData = nullptr;
+  if(nullptr == maskPtr.get())
+  {
+    condData = condDataPtr->getPointer(0);
+  }
+
+  kernel = std::make_shared<ConditionalSetValueKernel<T>>(inputArrayPtr->getPointer(0), condData, maskPtr.get(), static_cast<T>(replaceValue));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -176,13 +271,19 @@ void ConditionalSetValue::dataCheck()
     return;
   }
 
-  std::vector<size_t> cDims(1, 1);
-  m_ConditionalArrayPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getConditionalArrayPath(),
-                                                                                                           cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
-  if(nullptr != m_ConditionalArrayPtr.lock())                                                                      /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+  // The condition may either be a DataArray<bool> or a bit packed BitMaskArray
+  IDataArray::Pointer conditionalPtr = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, getConditionalArrayPath());
+  m_ConditionalMaskPtr = std::dynamic_pointer_cast<BitMaskArray>(conditionalPtr);
+  if(nullptr != conditionalPtr.get() && nullptr == m_ConditionalMaskPtr.lock())
   {
-    m_ConditionalArray = m_ConditionalArrayPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
+    std::vector<size_t> cDims(1, 1);
+    m_ConditionalArrayPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getConditionalArrayPath(),
+                                                                                                             cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if(nullptr != m_ConditionalArrayPtr.lock())                                                                      /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+    {
+      m_ConditionalArray = m_ConditionalArrayPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
   if(getErrorCode() >= 0)
   {
     dataArrayPaths.push_back(getConditionalArrayPath());
@@ -271,7 +372,45 @@ void ConditionalSetValue::execute()
     return;
   }
 
-  EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_ConditionalArrayPtr.lock(), m_ReplaceValue)
+  if(nullptr != m_ConditionalMaskPtr.lock())
+  {
+    EXECUTE_FUNCTION_TEMPLATE(this, replaceValueWithMask, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_ConditionalMaskPtr.lock(), m_ReplaceValue)
+  }
+  else
+  {
+    EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_ConditionalArrayPtr.lock(), m_ReplaceValue)
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayPath ConditionalSetValue::getElementWiseAttributeMatrixPath()
+{
+  // The fused pass walks a single AttributeMatrix so both arrays have to live in it
+  if(!getSelectedArrayPath().isValid() || !getSelectedArrayPath().hasSameAttributeMatrixPath(getConditionalArrayPath()))
+  {
+    return DataArrayPath();
+  }
+  return DataArrayPath(getSelectedArrayPath().getDataContainerName(), getSelectedArrayPath().getAttributeMatrixName(), "");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementWiseKernel::Pointer ConditionalSetValue::createElementWiseKernel()
+{
+  clearErrorCode();
+  clearWarningCode();
+  dataCheck();
+  if(getErrorCode() < 0)
+  {
+    return ElementWiseKernel::NullPointer();
+  }
+
+  ElementWiseKernel::Pointer kernel;
+  EXECUTE_FUNCTION_TEMPLATE(this, createConditionalSetValueKernel, m_ArrayPtr.lock(), m_ArrayPtr.lock(), m_ConditionalArrayPtr.lock(), m_ConditionalMaskPtr.lock(), m_ReplaceValue, kernel)
+  return kernel;
 }
 
 // -----------------------------------------------------------------------------
@@ -37,6 +37,7 @@
 #pragma once
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -133,6 +134,16 @@ class SIMPLib_EXPORT ConditionalSetValue : public AbstractFilter
     */
     void preflight() override;
 
+    /**
+     * @brief getElementWiseAttributeMatrixPath Reimplemented from @see AbstractFilter class
+     */
+    DataArrayPath getElementWiseAttributeMatrixPath() override;
+
+    /**
+     * @brief createElementWiseKernel Reimplemented from @see AbstractFilter class
+     */
+    ElementWiseKernel::Pointer createElementWiseKernel() override;
+
   signals:
     /**
      * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
@@ -172,6 +183,7 @@ class SIMPLib_EXPORT ConditionalSetValue : public AbstractFilter
   private:
     IDataArray::WeakPointer m_ArrayPtr;
     DEFINE_DATAARRAY_VARIABLE(bool, ConditionalArray)
+    BitMaskArray::WeakPointer m_ConditionalMaskPtr;
 
   public:
     ConditionalSetValue(const ConditionalSetValue&) = delete; // Copy Constructor Not Implemented
@@ -4,6 +4,9 @@
 
 #include "GenerateColorTable.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
@@ -11,6 +14,7 @@
 #include "SIMPLib/FilterParameters/GenerateColorTableFilterParameter.h"
 #include "SIMPLib/Utilities/ColorTable.h"
 #include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelDataReduceAlgorithm.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
 enum createdPathID : RenameDataPath::DataID_t {
@@ -71,13 +75,22 @@ public:
   , m_ControlPoints(std::move(controlPoints))
   , m_ColorArray(std::move(colorArray))
   {
-    m_ArrayMin = arrayPtr->getValue(0);
-    m_ArrayMax = arrayPtr->getValue(0);
-    for (int i=1; i<arrayPtr->getNumberOfTuples(); i++)
-    {
-      if (arrayPtr->getValue(i) < m_ArrayMin) { m_ArrayMin = arrayPtr->getValue(i); }
-      if (arrayPtr->getValue(i) > m_ArrayMax) { m_ArrayMax = arrayPtr->getValue(i); }
-    }
+    using MinMax = std::pair<T, T>;
+    T* values = arrayPtr->getPointer(0);
+    ParallelDataReduceAlgorithm reduceAlg;
+    reduceAlg.setRange(0, arrayPtr->getNumberOfTuples());
+    MinMax minMax = reduceAlg.execute(MinMax(values[0], values[0]),
+                                      [values](const SIMPLRange& range, MinMax value) {
+                                        for(size_t i = range.min(); i < range.max(); i++)
+                                        {
+                                          if(values[i] < value.first) { value.first = values[i]; }
+                                          if(values[i] > value.second) { value.second = values[i]; }
+                                        }
+                                        return value;
+                                      },
+                                      [](const MinMax& left, const MinMax& right) { return MinMax(std::min(left.first, right.first), std::max(left.second, right.second)); });
+    m_ArrayMin = minMax.first;
+    m_ArrayMax = minMax.second;
   }
   virtual ~GenerateColorTableImpl() = default;
 
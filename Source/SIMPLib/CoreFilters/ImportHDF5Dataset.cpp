@@ -38,6 +38,7 @@
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/ImportHDF5DatasetFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
 #include "H5Support/H5ScopedSentinel.h"
@@ -53,16 +54,18 @@ template <typename T>
 IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const size_t& numOfTuples, const std::vector<size_t>& cDims)
 {
   herr_t err = -1;
-  IDataArray::Pointer ptr;
+  typename DataArray<T>::Pointer ptr = DataArray<T>::CreateArray(numOfTuples, cDims, datasetPath, false);
 
-  ptr = DataArray<T>::CreateArray(numOfTuples, cDims, datasetPath, true);
-
-  T* data = (T*)(ptr->getVoidPointer(0));
-  err = QH5Lite::readPointerDataset(locId, datasetPath, data);
+  // Allocate without initializing the values since the read overwrites all of them anyways
+  if(ptr->allocate() < 0)
+  {
+    return IDataArray::NullPointer();
+  }
+  err = H5DataArrayReader::ReadDatasetIntoBuffer(locId, datasetPath, H5Lite::HDFTypeForPrimitive(T(0)), ptr->getVoidPointer(0), ptr->getSize());
   if(err < 0)
   {
     qDebug() << "readH5Data read error: " << __FILE__ << "(" << __LINE__ << ")";
-    ptr = IDataArray::NullPointer();
+    return IDataArray::NullPointer();
   }
   return ptr;
 }
@@ -36,6 +36,7 @@
 #include "MultiThresholdObjects.h"
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/ComparisonSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
@@ -205,11 +206,15 @@ void MultiThresholdObjects::execute()
   DataContainerArray::Pointer dca = getDataContainerArray();
   DataContainer::Pointer m = dca->getDataContainer(dcName);
 
-  // Prime our output array with the result of the first comparison
+  // The thresholds are computed and combined as bit packed masks, 64 tuples per word
+  size_t totalTuples = m->getAttributeMatrix(amName)->getNumberOfTuples();
+  BitMaskArray::Pointer maskPtr = BitMaskArray::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_MASK", true);
+
+  // Prime our mask with the result of the first comparison
   {
-    ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(comp_0.compOperator), comp_0.compValue, m_DestinationPtr.lock().get());
-    // Run the first threshold and store the results in our output array
-    int32_t err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comp_0.attributeArrayName).get(), m_DestinationPtr.lock().get());
+    ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(comp_0.compOperator), comp_0.compValue, maskPtr.get());
+    // Run the first threshold and store the results in our mask
+    int32_t err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comp_0.attributeArrayName).get(), maskPtr.get());
     if(err < 0)
     {
       DataArrayPath tempPath(comp_0.dataContainerName, comp_0.attributeMatrixName, comp_0.attributeArrayName);
@@ -221,23 +226,16 @@ void MultiThresholdObjects::execute()
 
   if(m_SelectedThresholds.size() > 1)
   {
-    // Get the total number of tuples, create and initialize an array to use for these results
-    int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-    BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP", true);
+    BitMaskArray::Pointer currentMaskPtr = BitMaskArray::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP", true);
 
-    // Loop on the remaining Comparison objects updating our final result array as we go
+    // Loop on the remaining Comparison objects updating our final result mask as we go
     for(int32_t i = 1; i < m_SelectedThresholds.size(); ++i)
     {
-      // Initialize the array to false
-      currentArrayPtr->initializeWithZeros();
-      // Get the pointer to the front of the array. Raw Pointers = fast access = NO Bounds Checking!!!
-      bool* currentArray = currentArrayPtr->getPointer(0);
-
       ComparisonInput_t& compRef = m_SelectedThresholds[i];
 
-      ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compRef.compOperator), compRef.compValue, currentArrayPtr.get());
+      ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compRef.compOperator), compRef.compValue, currentMaskPtr.get());
 
-      int32_t err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(compRef.attributeArrayName).get(), currentArrayPtr.get());
+      int32_t err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(compRef.attributeArrayName).get(), currentMaskPtr.get());
       if(err < 0)
       {
         DataArrayPath tempPath(compRef.dataContainerName, compRef.attributeMatrixName, compRef.attributeArrayName);
@@ -245,15 +243,11 @@ void MultiThresholdObjects::execute()
         setErrorCondition(-13002, ss);
         return;
       }
-      for(int64_t p = 0; p < totalTuples; ++p)
-      {
-        if(!m_Destination[p] || !currentArray[p])
-        {
-          m_Destination[p] = false;
-        }
-      }
+      maskPtr->andWith(*currentMaskPtr);
     }
   }
+
+  maskPtr->copyIntoBoolArray(m_DestinationPtr.lock().get());
 }
 
 // -----------------------------------------------------------------------------
@@ -35,7 +35,12 @@
 
 #include "MultiThresholdObjects2.h"
 
+#include <algorithm>
+#include <functional>
+#include <vector>
+
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/ComparisonSelectionAdvancedFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
@@ -48,6 +53,219 @@ enum createdPathID : RenameDataPath::DataID_t {
   ThresholdArrayID = 1
 };
 
+/**
+ * @brief Evaluates the whole threshold tree one block of tuples at a time, for the fused
+ * execution of the filter. Each block is combined in the same order execute() combines
+ * the full arrays, so both give the same mask.
+ */
+class ThresholdKernel : public ElementWiseKernel
+{
+public:
+  using Comparison = std::function<void(size_t start, size_t end, uint8_t* result)>;
+
+  /**
+   * @brief A single comparison when Compare is set, otherwise a set combining its children
+   */
+  struct Node
+  {
+    int UnionOperator = SIMPL::Union::Operator_And;
+    bool Invert = false;
+    Comparison Compare;
+    std::vector<Node> Children;
+  };
+
+  ThresholdKernel(Node root, bool* destination)
+  : m_Root(std::move(root))
+  , m_Destination(destination)
+  , m_Levels(1 + CountSetLevels(m_Root))
+  {
+  }
+
+  ~ThresholdKernel() override = default;
+
+  void process(size_t start, size_t end) const override
+  {
+    // One result buffer per level of the tree, kept by the thread across blocks and kernels
+    thread_local std::vector<uint8_t> t_Scratch;
+    size_t count = end - start;
+    if(t_Scratch.size() < m_Levels * count)
+    {
+      t_Scratch.resize(m_Levels * count);
+    }
+    uint8_t* result = t_Scratch.data();
+    evaluate(m_Root, start, end, result, result + count);
+    for(size_t i = start; i < end; i++)
+    {
+      m_Destination[i] = result[i - start] != 0;
+    }
+  }
+
+private:
+  Node m_Root;
+  bool* m_Destination = nullptr;
+  size_t m_Levels = 1;
+
+  /**
+   * @brief Returns how many levels of child results evaluating the set needs
+   */
+  static size_t CountSetLevels(const Node& set)
+  {
+    size_t childLevels = 0;
+    for(const Node& child : set.Children)
+    {
+      if(!child.Compare)
+      {
+        childLevels = std::max(childLevels, CountSetLevels(child));
+      }
+    }
+    return 1 + childLevels;
+  }
+
+  /**
+   * @brief Writes the result of the set to result, using scratch, which holds one block for
+   * every level below the set, for the results of its children
+   */
+  void evaluate(const Node& set, size_t start, size_t end, uint8_t* result, uint8_t* scratch) const
+  {
+    size_t count = end - start;
+    std::fill(result, result + count, 0);
+    uint8_t* childResult = scratch;
+    bool firstValueFound = false;
+    for(const Node& child : set.Children)
+    {
+      if(child.Compare)
+      {
+        child.Compare(start, end, childResult);
+      }
+      else
+      {
+        evaluate(child, start, end, childResult, scratch + count);
+      }
+
+      if(!firstValueFound)
+      {
+        std::copy(childResult, childResult + count, result);
+      }
+      else if(SIMPL::Union::Operator_Or == child.UnionOperator)
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          result[i] |= childResult[i];
+        }
+      }
+      else
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          result[i] &= childResult[i];
+        }
+      }
+      firstValueFound = true;
+    }
+
+    if(set.Invert)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        result[i] ^= 1;
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void createThresholdComparison(IDataArray::Pointer inputPtr, int compOperator, double compValue, ThresholdKernel::Comparison& comparison)
+{
+  const T* data = std::dynamic_pointer_cast<DataArray<T>>(inputPtr)->getPointer(0);
+  T value = static_cast<T>(compValue);
+
+  switch(compOperator)
+  {
+  case SIMPL::Comparison::Operator_LessThan:
+    comparison = [data, value](size_t start, size_t end, uint8_t* result) {
+      for(size_t i = start; i < end; i++)
+      {
+        result[i - start] = data[i] < value;
+      }
+    };
+    break;
+  case SIMPL::Comparison::Operator_GreaterThan:
+    comparison = [data, value](size_t start, size_t end, uint8_t* result) {
+      for(size_t i = start; i < end; i++)
+      {
+        result[i - start] = data[i] > value;
+      }
+    };
+    break;
+  case SIMPL::Comparison::Operator_Equal:
+    comparison = [data, value](size_t start, size_t end, uint8_t* result) {
+      for(size_t i = start; i < end; i++)
+      {
+        result[i - start] = data[i] == value;
+      }
+    };
+    break;
+  case SIMPL::Comparison::Operator_NotEqual:
+    comparison = [data, value](size_t start, size_t end, uint8_t* result) {
+      for(size_t i = start; i < end; i++)
+      {
+        result[i - start] = data[i] != value;
+      }
+    };
+    break;
+  default:
+    // ThresholdFilterHelper leaves the mask empty for an unknown operator
+    comparison = [](size_t start, size_t end, uint8_t* result) { std::fill(result, result + (end - start), 0); };
+    break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool createThresholdNodes(AbstractFilter* filter, const DataArrayPath& amPath, const AttributeMatrix::Pointer& am, const QVector<AbstractComparison::Pointer>& comparisons, ThresholdKernel::Node& parent)
+{
+  for(const AbstractComparison::Pointer& comparison : comparisons)
+  {
+    ThresholdKernel::Node node;
+    node.UnionOperator = comparison->getUnionOperator();
+
+    ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(comparison);
+    ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(comparison);
+    if(nullptr != comparisonSet)
+    {
+      node.Invert = comparisonSet->getInvertComparison();
+      if(!createThresholdNodes(filter, amPath, am, comparisonSet->getComparisons(), node))
+      {
+        return false;
+      }
+    }
+    else if(nullptr != comparisonValue)
+    {
+      IDataArray::Pointer inputPtr = am->getAttributeArray(comparisonValue->getAttributeArrayName());
+      if(nullptr != inputPtr.get())
+      {
+        EXECUTE_FUNCTION_TEMPLATE(filter, createThresholdComparison, inputPtr, inputPtr, comparisonValue->getCompOperator(), comparisonValue->getCompValue(), node.Compare)
+      }
+      if(!node.Compare)
+      {
+        DataArrayPath tempPath(amPath.getDataContainerName(), amPath.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
+        QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
+        filter->setErrorCondition(-13002, ss);
+        return false;
+      }
+    }
+    else
+    {
+      continue;
+    }
+    parent.Children.push_back(std::move(node));
+  }
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -215,9 +433,9 @@ void MultiThresholdObjects2::execute()
     bool invert = m_SelectedThresholds.shouldInvert();
 
     int64_t thresholdSize;
-    BoolArrayType::Pointer thresholdArray;
+    BitMaskArray::Pointer thresholdArray;
 
-    createBoolArray(thresholdSize, thresholdArray);
+    createMaskArray(thresholdSize, thresholdArray);
     bool firstValueFound = false;
 
     int32_t err = 0;
@@ -244,17 +462,13 @@ void MultiThresholdObjects2::execute()
       invertThreshold(thresholdSize, thresholdArray);
     }
 
-    bool* threshold = thresholdArray->getPointer(0);
-    for (int64_t p = 0; p < thresholdSize; p++)
-    {
-      m_Destination[p] = threshold[p];
-    }
+    thresholdArray->copyIntoBoolArray(m_DestinationPtr.lock().get());
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::createBoolArray(int64_t& totalTuples, BoolArrayType::Pointer& thresholdArrayPtr)
+void MultiThresholdObjects2::createMaskArray(int64_t& totalTuples, BitMaskArray::Pointer& thresholdArrayPtr)
 {
   // Get the names of the Data Container and AttributeMatrix for later
   QString dcName = m_SelectedThresholds.getDataContainerName();
@@ -265,56 +479,42 @@ void MultiThresholdObjects2::createBoolArray(int64_t& totalTuples, BoolArrayType
 
   // Get the total number of tuples, create and initialize an array to use for these results
   totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  thresholdArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP", true);
-
-  // Initialize the array to false
-  thresholdArrayPtr->initializeWithZeros();
+  thresholdArrayPtr = BitMaskArray::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP", true);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArrayPtr, int unionOperator, const BoolArrayType::Pointer newArrayPtr, bool inverse)
+void MultiThresholdObjects2::insertThreshold(int64_t numItems, BitMaskArray::Pointer currentArrayPtr, int unionOperator, const BitMaskArray::Pointer newArrayPtr, bool inverse)
 {
-  bool* newArray = newArrayPtr->getPointer(0);
-  bool* currentArray = currentArrayPtr->getPointer(0);
-
-  for (int64_t i = 0; i < numItems; i++)
+  // invert the current comparison if necessary
+  if (inverse)
   {
-    // invert the current comparison if necessary
-    if (inverse)
-    {
-      newArray[i] = !newArray[i];
-    }
+    newArrayPtr->invert();
+  }
 
-    if (SIMPL::Union::Operator_Or == unionOperator)
-    {
-      currentArray[i] = currentArray[i] || newArray[i];
-    }
-    else if(!currentArray[i] || !newArray[i])
-    {
-      currentArray[i] = false;
-    }
+  if (SIMPL::Union::Operator_Or == unionOperator)
+  {
+    currentArrayPtr->orWith(*newArrayPtr);
+  }
+  else
+  {
+    currentArrayPtr->andWith(*newArrayPtr);
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray)
+void MultiThresholdObjects2::invertThreshold(int64_t numItems, BitMaskArray::Pointer thresholdArray)
 {
-  bool* threshold = thresholdArray->getPointer(0);
-
-  for (int64_t i = 0; i < numItems; i++)
-  {
-    threshold[i] = !threshold[i];
-  }
+  thresholdArray->invert();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& currentThreshold, int32_t &err, bool replaceInput, bool inverse)
+void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet, BitMaskArray::Pointer& currentThreshold, int32_t &err, bool replaceInput, bool inverse)
 {
   if (nullptr == comparisonSet)
   {
@@ -331,9 +531,9 @@ void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet,
   }
 
   int64_t setArraySize;
-  BoolArrayType::Pointer setThresholdArray;
+  BitMaskArray::Pointer setThresholdArray;
 
-  createBoolArray(setArraySize, setThresholdArray);
+  createMaskArray(setArraySize, setThresholdArray);
   bool firstValueFound = false;
 
   QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
@@ -378,7 +578,7 @@ void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet,
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t &err, bool replaceInput, bool inverse)
+void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonValue, BitMaskArray::Pointer& inputThreshold, int32_t &err, bool replaceInput, bool inverse)
 {
   if (nullptr == comparisonValue)
   {
@@ -394,12 +594,8 @@ void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonV
 
   // Get the total number of tuples, create and initialize an array to use for these results
   int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP", true);
-
-  // Initialize the array to false
-  currentArrayPtr->initializeWithZeros();
+  BitMaskArray::Pointer currentArrayPtr = BitMaskArray::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP", true);
 
-  //bool* currentArray = currentArrayPtr->getPointer(0);
   int compOperator = comparisonValue->getCompOperator();
   double compValue = comparisonValue->getCompValue();
 
@@ -429,6 +625,51 @@ void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonV
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayPath MultiThresholdObjects2::getElementWiseAttributeMatrixPath()
+{
+  // All thresholded arrays and the output live in the selected AttributeMatrix
+  if(m_SelectedThresholds.getDataContainerName().isEmpty() || m_SelectedThresholds.getAttributeMatrixName().isEmpty())
+  {
+    return DataArrayPath();
+  }
+  return m_SelectedThresholds.getAttributeMatrixPath();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementWiseKernel::Pointer MultiThresholdObjects2::createElementWiseKernel()
+{
+  clearErrorCode();
+  clearWarningCode();
+  dataCheck();
+  if(getErrorCode() < 0)
+  {
+    return ElementWiseKernel::NullPointer();
+  }
+
+  if(!m_SelectedThresholds.hasComparisonValue())
+  {
+    QString ss = QObject::tr("Error Executing threshold filter. There are no specified values to threshold against");
+    setErrorCondition(-13001, ss);
+    return ElementWiseKernel::NullPointer();
+  }
+
+  AttributeMatrix::Pointer am = getDataContainerArray()->getDataContainer(m_SelectedThresholds.getDataContainerName())->getAttributeMatrix(m_SelectedThresholds.getAttributeMatrixName());
+
+  ThresholdKernel::Node root;
+  root.Invert = m_SelectedThresholds.shouldInvert();
+  if(!createThresholdNodes(this, m_SelectedThresholds.getAttributeMatrixPath(), am, m_SelectedThresholds.getInputs(), root))
+  {
+    return ElementWiseKernel::NullPointer();
+  }
+
+  return std::make_shared<ThresholdKernel>(std::move(root), m_Destination);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -148,6 +148,48 @@ template <typename T> void replaceValue(AbstractFilter* filter, IDataArray::Poin
   }
 }
 
+/**
+ * @brief Replaces the tuples equal to the remove value with the replace value, for the
+ * fused execution of the filter
+ */
+template <typename T> class ReplaceValueKernel : public ElementWiseKernel
+{
+public:
+  ReplaceValueKernel(T* data, T removeValue, T replaceValue)
+  : m_Data(data)
+  , m_RemoveValue(removeValue)
+  , m_ReplaceValue(replaceValue)
+  {
+  }
+
+  ~ReplaceValueKernel() override = default;
+
+  void process(size_t start, size_t end) const override
+  {
+    for(size_t iter = start; iter < end; iter++)
+    {
+      if(m_Data[iter] == m_RemoveValue)
+      {
+        m_Data[iter] = m_ReplaceValue;
+      }
+    }
+  }
+
+private:
+  T* m_Data = nullptr;
+  T m_RemoveValue;
+  T m_ReplaceValue;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void createReplaceValueKernel(IDataArray::Pointer inDataPtr, double removeValue, double replaceValue, ElementWiseKernel::Pointer& kernel)
+{
+  typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
+  kernel = std::make_shared<ReplaceValueKernel<T>>(inputArrayPtr->getPointer(0), static_cast<T>(removeValue), static_cast<T>(replaceValue));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -266,6 +308,36 @@ void ReplaceValueInArray::execute()
   EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_RemoveValue, m_ReplaceValue)
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayPath ReplaceValueInArray::getElementWiseAttributeMatrixPath()
+{
+  if(!getSelectedArray().isValid())
+  {
+    return DataArrayPath();
+  }
+  return DataArrayPath(getSelectedArray().getDataContainerName(), getSelectedArray().getAttributeMatrixName(), "");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementWiseKernel::Pointer ReplaceValueInArray::createElementWiseKernel()
+{
+  clearErrorCode();
+  clearWarningCode();
+  dataCheck();
+  if(getErrorCode() < 0)
+  {
+    return ElementWiseKernel::NullPointer();
+  }
+
+  ElementWiseKernel::Pointer kernel;
+  EXECUTE_FUNCTION_TEMPLATE(this, createReplaceValueKernel, m_ArrayPtr.lock(), m_ArrayPtr.lock(), m_RemoveValue, m_ReplaceValue, kernel)
+  return kernel;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
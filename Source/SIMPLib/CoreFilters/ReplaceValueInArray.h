@@ -133,6 +133,16 @@ class SIMPLib_EXPORT ReplaceValueInArray : public AbstractFilter
     */
     void preflight() override;
 
+    /**
+     * @brief getElementWiseAttributeMatrixPath Reimplemented from @see AbstractFilter class
+     */
+    DataArrayPath getElementWiseAttributeMatrixPath() override;
+
+    /**
+     * @brief createElementWiseKernel Reimplemented from @see AbstractFilter class
+     */
+    ElementWiseKernel::Pointer createElementWiseKernel() override;
+
   signals:
     /**
      * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
@@ -35,6 +35,8 @@
 
 #include "WriteASCIIData.h"
 
+#include <cstring>
+
 #include <QtCore/QDir>
 
 #include "SIMPLib/Common/Constants.h"
@@ -538,11 +540,34 @@ void WriteASCIIData::writeStringArray(const IDataArray::Pointer& inputData, cons
     return;
   }
 
-  QTextStream out(&file);
-
   size_t nTuples = inputArray->getNumberOfTuples();
 
   int32_t recCount = 0;
+  if(inputArray->getStorage() != StringDataArray::Storage::Strings)
+  {
+    // The values are already UTF-8 so copy the bytes without building a QString for each one
+    for(size_t i = 0; i < nTuples; i++)
+    {
+      const char* value = inputArray->getUtf8Value(i);
+      file.write(value, static_cast<qint64>(std::strlen(value)));
+
+      recCount++;
+
+      if(recCount >= getMaxValPerLine())
+      {
+        file.putChar('\n');
+        recCount = 0;
+      }
+      else
+      {
+        file.putChar(delimiter);
+      }
+    }
+    return;
+  }
+
+  QTextStream out(&file);
+
   for(size_t i = 0; i < nTuples; i++)
   {
     out << inputArray->getValue(i);
@@ -0,0 +1,699 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "BitMaskArray.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+#include <QtCore/QLocale>
+#include <QtCore/QTextStream>
+
+#include "H5Support/QH5Lite.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline size_t WordCount(size_t numTuples)
+{
+  return (numTuples + BitMaskArray::k_BitsPerWord - 1) / BitMaskArray::k_BitsPerWord;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline size_t PopCount(BitMaskArray::WordType word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_popcountll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+  return static_cast<size_t>(__popcnt64(word));
+#else
+  word = word - ((word >> 1) & 0x5555555555555555ULL);
+  word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+  word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+} // namespace
+
+const size_t BitMaskArray::k_BitsPerWord;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::BitMaskArray() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::BitMaskArray(size_t numTuples, const QString& name, bool allocate)
+: IDataArray(name)
+, m_NumTuples(numTuples)
+{
+  if(allocate)
+  {
+    m_Words.resize(WordCount(numTuples), 0);
+    m_IsAllocated = true;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::~BitMaskArray() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::CreateArray(size_t numTuples, const QString& name, bool allocate)
+{
+  if(name.isEmpty())
+  {
+    return NullPointer();
+  }
+  BitMaskArray* d = new BitMaskArray(numTuples, name, allocate);
+  Pointer ptr(d);
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::CreateArray(size_t numTuples, const std::vector<size_t>& compDims, const QString& name, bool allocate)
+{
+  return CreateArray(numTuples, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::FromBoolArray(BoolArrayType* boolArray, const QString& name)
+{
+  if(nullptr == boolArray)
+  {
+    return NullPointer();
+  }
+  size_t numValues = boolArray->getSize();
+  Pointer mask = CreateArray(numValues, name.isEmpty() ? boolArray->getName() : name, boolArray->isAllocated());
+  if(nullptr == mask.get() || !boolArray->isAllocated())
+  {
+    return mask;
+  }
+
+  const bool* values = boolArray->getConstPointer(0);
+  size_t numWords = mask->m_Words.size();
+  for(size_t w = 0; w < numWords; w++)
+  {
+    size_t start = w * k_BitsPerWord;
+    size_t count = std::min(k_BitsPerWord, numValues - start);
+    WordType word = 0;
+    for(size_t b = 0; b < count; b++)
+    {
+      word |= static_cast<WordType>(values[start + b]) << b;
+    }
+    mask->m_Words[w] = word;
+  }
+  return mask;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BoolArrayType::Pointer BitMaskArray::toBoolArray(const QString& name)
+{
+  BoolArrayType::Pointer boolArray = BoolArrayType::CreateArray(m_NumTuples, name.isEmpty() ? getName() : name, m_IsAllocated);
+  if(nullptr != boolArray.get() && m_IsAllocated)
+  {
+    copyIntoBoolArray(boolArray.get());
+  }
+  return boolArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::copyIntoBoolArray(BoolArrayType* boolArray)
+{
+  if(nullptr == boolArray || !m_IsAllocated || boolArray->getSize() < m_NumTuples)
+  {
+    return false;
+  }
+  if(m_NumTuples == 0)
+  {
+    return true;
+  }
+
+  bool* values = boolArray->getPointer(0);
+  size_t numWords = m_Words.size();
+  for(size_t w = 0; w < numWords; w++)
+  {
+    size_t start = w * k_BitsPerWord;
+    size_t count = std::min(k_BitsPerWord, m_NumTuples - start);
+    WordType word = m_Words[w];
+    for(size_t b = 0; b < count; b++)
+    {
+      values[start + b] = ((word >> b) & WordType(1)) != 0;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::createNewArray(size_t numElements, int rank, const size_t* dims, const QString& name, bool allocate)
+{
+  IDataArray::Pointer p = BitMaskArray::CreateArray(numElements, name, allocate);
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::createNewArray(size_t numElements, const std::vector<size_t>& dims, const QString& name, bool allocate)
+{
+  IDataArray::Pointer p = BitMaskArray::CreateArray(numElements, name, allocate);
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::isAllocated()
+{
+  return m_IsAllocated;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::getXdmfTypeAndSize(QString& xdmfTypeName, int& precision)
+{
+  xdmfTypeName = getNameOfClass();
+  precision = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getTypeAsString()
+{
+  return SIMPL::TypeNames::BitMaskArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::takeOwnership()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::releaseOwnership()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* BitMaskArray::getVoidPointer(size_t i)
+{
+  if(i / k_BitsPerWord >= m_Words.size())
+  {
+    return nullptr;
+  }
+  return static_cast<void*>(&(m_Words[i / k_BitsPerWord]));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getNumberOfTuples()
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getSize()
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::getNumberOfComponents()
+{
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> BitMaskArray::getComponentDimensions()
+{
+  std::vector<size_t> dims = {1};
+  return dims;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getTypeSize()
+{
+  return sizeof(bool);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getUniqueByteCount()
+{
+  return m_Words.size() * sizeof(WordType);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::eraseTuples(std::vector<size_t>& idxs)
+{
+  // If nothing is to be erased just return
+  if(idxs.empty())
+  {
+    return 0;
+  }
+  if(idxs.size() >= m_NumTuples)
+  {
+    resizeTuples(0);
+    return 0;
+  }
+
+  // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
+  // off the end of the array and return an error code.
+  std::vector<bool> erase(m_NumTuples, false);
+  for(const auto& value : idxs)
+  {
+    if(value >= m_NumTuples)
+    {
+      return -100;
+    }
+    erase[value] = true;
+  }
+
+  // Compact the kept values toward the front. The write index never passes the read index.
+  size_t dest = 0;
+  for(size_t i = 0; i < m_NumTuples; i++)
+  {
+    if(!erase[i])
+    {
+      setValue(dest, getValue(i));
+      dest++;
+    }
+  }
+  resizeTuples(dest);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::copyTuple(size_t currentPos, size_t newPos)
+{
+  if(currentPos >= m_NumTuples || newPos >= m_NumTuples)
+  {
+    return -1;
+  }
+  setValue(newPos, getValue(currentPos));
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
+{
+  if(!m_IsAllocated || destTupleOffset >= m_NumTuples)
+  {
+    return false;
+  }
+  if(nullptr == sourceArray.get() || !sourceArray->isAllocated())
+  {
+    return false;
+  }
+  if(srcTupleOffset + totalSrcTuples > sourceArray->getNumberOfTuples())
+  {
+    return false;
+  }
+  if(totalSrcTuples + destTupleOffset > m_NumTuples)
+  {
+    return false;
+  }
+
+  if(Self* source = dynamic_cast<Self*>(sourceArray.get()))
+  {
+    for(size_t i = 0; i < totalSrcTuples; i++)
+    {
+      setValue(destTupleOffset + i, source->getValue(srcTupleOffset + i));
+    }
+    return true;
+  }
+
+  BoolArrayType* boolSource = dynamic_cast<BoolArrayType*>(sourceArray.get());
+  if(nullptr != boolSource && boolSource->getNumberOfComponents() == 1)
+  {
+    const bool* values = boolSource->getConstPointer(0);
+    for(size_t i = 0; i < totalSrcTuples; i++)
+    {
+      setValue(destTupleOffset + i, values[srcTupleOffset + i]);
+    }
+    return true;
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initializeTuple(size_t pos, void* value)
+{
+  setValue(pos, *(reinterpret_cast<bool*>(value)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initializeWithZeros()
+{
+  initializeWithValue(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initializeWithValue(bool value)
+{
+  std::fill(m_Words.begin(), m_Words.end(), value ? ~WordType(0) : WordType(0));
+  clearTrailingBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::deepCopy(bool forceNoAllocate)
+{
+  BitMaskArray::Pointer daCopy = BitMaskArray::CreateArray(m_NumTuples, getName(), m_IsAllocated && !forceNoAllocate);
+  if(m_IsAllocated && !forceNoAllocate)
+  {
+    daCopy->m_Words = m_Words;
+  }
+  return daCopy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitMaskArray::resizeTotalElements(size_t size)
+{
+  resizeTuples(size);
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::resizeTuples(size_t numTuples)
+{
+  // The unused bits of the old last word are zero so new values start out false
+  m_Words.resize(WordCount(numTuples), 0);
+  m_NumTuples = numTuples;
+  m_IsAllocated = true;
+  clearTrailingBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initialize()
+{
+  std::vector<WordType>().swap(m_Words);
+  m_NumTuples = 0;
+  m_IsAllocated = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::printTuple(QTextStream& out, size_t i, char delimiter)
+{
+  out << (getValue(i) ? 1 : 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::printComponent(QTextStream& out, size_t i, int j)
+{
+  out << (getValue(i) ? 1 : 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getFullNameOfClass()
+{
+  return SIMPL::TypeNames::BitMaskArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::writeH5Data(hid_t parentId, std::vector<size_t> tDims)
+{
+  int err = 0;
+  hsize_t dims[1] = {static_cast<hsize_t>(m_Words.size())};
+  if(!QH5Lite::datasetExists(parentId, getName()))
+  {
+    err = QH5Lite::writePointerDataset(parentId, getName(), 1, dims, m_Words.data());
+  }
+  else
+  {
+    err = QH5Lite::replacePointerDataset(parentId, getName(), 1, dims, m_Words.data());
+  }
+  if(err < 0)
+  {
+    return err;
+  }
+  std::vector<size_t> cDims(1, 1);
+  return H5DataArrayWriter::writeDataArrayAttributes<BitMaskArray>(parentId, this, tDims, cDims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& labelb)
+{
+  out << "<!-- Xdmf is not supported for " << getNameOfClass() << " with type " << getTypeAsString() << " --> ";
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getInfoString(SIMPL::InfoStringFormat format)
+{
+  QString info;
+  QTextStream ss(&info);
+  if(format == SIMPL::HtmlFormat)
+  {
+    ss << "<html><head></head>\n";
+    ss << "<body>\n";
+    ss << "<table cellpadding=\"4\" cellspacing=\"0\" border=\"0\">\n";
+    ss << "<tbody>\n";
+    ss << "<tr bgcolor=\"#FFFCEA\"><th colspan=2>Attribute Array Info</th></tr>";
+    ss << R"(<tr bgcolor="#FFFCEA"><th align="right">Name:</th><td>)" << getName() << R"(</td></tr>)";
+    ss << R"(<tr bgcolor="#FFFCEA"><th align="right">Type:</th><td>)" << getTypeAsString() << R"(</td></tr>)";
+    QLocale usa(QLocale::English, QLocale::UnitedStates);
+    QString numStr = usa.toString(static_cast<qlonglong>(getNumberOfTuples()));
+    ss << R"(<tr bgcolor="#FFFCEA"><th align="right">Number of Tuples:</th><td>)" << numStr << R"(</td></tr>)";
+    numStr = usa.toString(static_cast<qlonglong>(getUniqueByteCount()));
+    ss << R"(<tr bgcolor="#FFFCEA"><th align="right">Total Memory Required:</th><td>)" << numStr << R"(</td></tr>)";
+    ss << "</tbody></table>\n";
+    ss << "<br/>";
+    ss << "</body></html>";
+  }
+  else
+  {
+  }
+  return info;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::readH5Data(hid_t parentId)
+{
+  QString objType;
+  int version = 0;
+  std::vector<size_t> tDims;
+  std::vector<size_t> cDims;
+  int err = H5DataArrayReader::ReadRequiredAttributes(parentId, getName(), objType, version, tDims, cDims);
+  if(err < 0)
+  {
+    return err;
+  }
+  if(objType.compare(getFullNameOfClass()) != 0)
+  {
+    return -1;
+  }
+
+  size_t numTuples = std::accumulate(tDims.begin(), tDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+  std::vector<WordType> words(WordCount(numTuples), 0);
+  err = H5DataArrayReader::ReadDatasetIntoBuffer(parentId, getName(), H5T_NATIVE_UINT64, words.data(), words.size());
+  if(err < 0)
+  {
+    return err;
+  }
+  m_Words.swap(words);
+  m_NumTuples = numTuples;
+  m_IsAllocated = true;
+  clearTrailingBits();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getNumberOfWords() const
+{
+  return m_Words.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::WordType* BitMaskArray::getWordPointer(size_t wordIndex)
+{
+  if(wordIndex >= m_Words.size())
+  {
+    return nullptr;
+  }
+  return m_Words.data() + wordIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::andWith(const BitMaskArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  size_t numWords = m_Words.size();
+  for(size_t w = 0; w < numWords; w++)
+  {
+    m_Words[w] &= other.m_Words[w];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::orWith(const BitMaskArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  size_t numWords = m_Words.size();
+  for(size_t w = 0; w < numWords; w++)
+  {
+    m_Words[w] |= other.m_Words[w];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::invert()
+{
+  for(auto& word : m_Words)
+  {
+    word = ~word;
+  }
+  clearTrailingBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::countTrue() const
+{
+  size_t count = 0;
+  for(const auto& word : m_Words)
+  {
+    count += PopCount(word);
+  }
+  return count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::clearTrailingBits()
+{
+  size_t usedBits = m_NumTuples % k_BitsPerWord;
+  if(usedBits != 0 && !m_Words.empty())
+  {
+    m_Words.back() &= (WordType(1) << usedBits) - 1;
+  }
+}
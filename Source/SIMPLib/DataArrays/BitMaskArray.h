@@ -0,0 +1,431 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @class BitMaskArray BitMaskArray.h SIMPLib/DataArrays/BitMaskArray.h
+ * @brief Stores an array of boolean values packed 1 bit per value into 64 bit
+ * words. Compared to a DataArray<bool> the mask needs 1/8 of the memory and the
+ * logical operations (AND, OR, NOT, counting) work on 64 values at a time.
+ *
+ * The array always has a single component. Bits past the last tuple in the final
+ * word are always kept at zero so that whole words can be compared and counted.
+ */
+class SIMPLib_EXPORT BitMaskArray : public IDataArray
+{
+  // clang-format off
+  PYB11_CREATE_BINDINGS(BitMaskArray SUPER IDataArray)
+  PYB11_STATIC_CREATION(CreateArray OVERLOAD size_t QString bool)
+  PYB11_STATIC_CREATION(CreateArray OVERLOAD size_t std::vector<size_t> QString bool)
+  PYB11_PROPERTY(QString Name READ getName WRITE setName)
+  PYB11_METHOD(bool getValue ARGS size_t,i)
+  PYB11_METHOD(void setValue ARGS size_t,i bool,value)
+  PYB11_METHOD(size_t countTrue)
+  PYB11_METHOD(size_t getSize)
+  PYB11_METHOD(size_t getNumberOfTuples)
+  // clang-format on
+
+public:
+  SIMPL_SHARED_POINTERS(BitMaskArray)
+  SIMPL_STATIC_NEW_MACRO(BitMaskArray)
+  SIMPL_TYPE_MACRO_SUPER_OVERRIDE(BitMaskArray, IDataArray)
+  SIMPL_CLASS_VERSION(1)
+
+  using WordType = uint64_t;
+  static const size_t k_BitsPerWord = 64;
+
+  /**
+   * @brief CreateArray
+   * @param numTuples
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(size_t numTuples, const QString& name, bool allocate = true);
+
+  /**
+   * @brief CreateArray
+   * @param numTuples
+   * @param compDims NOT USED. The mask always has 1 component.
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(size_t numTuples, const std::vector<size_t>& compDims, const QString& name, bool allocate = true);
+
+  /**
+   * @brief Creates a packed mask from the values of a DataArray<bool>. Every component
+   * of the source array becomes one bit.
+   * @param boolArray The array to pack
+   * @param name The name of the new array. An empty name uses the name of the source array.
+   * @return
+   */
+  static Pointer FromBoolArray(BoolArrayType* boolArray, const QString& name = QString());
+
+  /**
+   * @brief Unpacks this mask into a new DataArray<bool>
+   * @param name The name of the new array. An empty name uses the name of this array.
+   * @return
+   */
+  BoolArrayType::Pointer toBoolArray(const QString& name = QString());
+
+  /**
+   * @brief Unpacks this mask into an existing DataArray<bool>
+   * @param boolArray The destination. It must hold at least getNumberOfTuples() values.
+   * @return false if the destination is too small
+   */
+  bool copyIntoBoolArray(BoolArrayType* boolArray);
+
+  /**
+   * @brief createNewArray
+   * @param numElements
+   * @param rank NOT USED. The mask always has 1 component.
+   * @param dims NOT USED.
+   * @param name
+   * @return
+   */
+  IDataArray::Pointer createNewArray(size_t numElements, int rank, const size_t* dims, const QString& name, bool allocate = true) override;
+
+  /**
+   * @brief createNewArray
+   * @param numElements
+   * @param dims NOT USED. The mask always has 1 component.
+   * @param name
+   * @param allocate
+   * @return
+   */
+  IDataArray::Pointer createNewArray(size_t numElements, const std::vector<size_t>& dims, const QString& name, bool allocate = true) override;
+
+  /**
+   * @brief ~BitMaskArray
+   */
+  ~BitMaskArray() override;
+
+  /**
+   * @brief isAllocated
+   * @return
+   */
+  bool isAllocated() override;
+
+  /**
+   * @brief getXdmfTypeAndSize
+   * @param xdmfTypeName
+   * @param precision
+   */
+  void getXdmfTypeAndSize(QString& xdmfTypeName, int& precision) override;
+
+  /**
+   * @brief getTypeAsString
+   * @return
+   */
+  QString getTypeAsString() override;
+
+  /**
+   * @brief Does nothing. The mask always owns its words.
+   */
+  void takeOwnership() override;
+
+  /**
+   * @brief Does nothing. The mask always owns its words.
+   */
+  void releaseOwnership() override;
+
+  /**
+   * @brief Returns a void pointer to the word that holds the bit for index i.
+   * @param i The index of the value
+   * @return Void Pointer. Possibly nullptr.
+   */
+  void* getVoidPointer(size_t i) override;
+
+  /**
+   * @brief Returns the number of Tuples in the array.
+   */
+  size_t getNumberOfTuples() override;
+
+  /**
+   * @brief Return the number of elements in the array
+   * @return
+   */
+  size_t getSize() override;
+
+  int getNumberOfComponents() override;
+
+  std::vector<size_t> getComponentDimensions() override;
+
+  /**
+   * @brief Returns the number of bytes of the smallest value that can be addressed,
+   * which is a single byte even though each value only uses 1 bit.
+   */
+  size_t getTypeSize() override;
+
+  /**
+   * @brief Returns the number of bytes held by the packed words
+   */
+  size_t getUniqueByteCount() override;
+
+  /**
+   * @brief Removes Tuples from the Array. If the size of the vector is Zero nothing is done. If the size of the
+   * vector is greater than or Equal to the number of Tuples then the Array is Resized to Zero. If there are
+   * indices that are larger than the size of the original (before erasing operations) then an error code (-100) is
+   * returned from the program.
+   * @param idxs The indices to remove
+   * @return error code.
+   */
+  int eraseTuples(std::vector<size_t>& idxs) override;
+
+  /**
+   * @brief Copies a Tuple from one position to another.
+   * @param currentPos The index of the source data
+   * @param newPos The destination index to place the copied data
+   * @return
+   */
+  int copyTuple(size_t currentPos, size_t newPos) override;
+
+  // This line must be here, because we are overloading the copyData pure virtual function in IDataArray.
+  // This is required so that other classes can call this version of copyData from the subclasses.
+  using IDataArray::copyFromArray;
+
+  /**
+   * @brief Copies totalSrcTuples values starting at srcTupleOffset from either another
+   * BitMaskArray or a DataArray<bool> into this mask starting at destTupleOffset.
+   * @param destTupleOffset
+   * @param sourceArray
+   * @param srcTupleOffset
+   * @param totalSrcTuples
+   * @return
+   */
+  bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override;
+
+  /**
+   * @brief Sets a single value
+   * @param pos The index of the Tuple
+   * @param value Pointer to a bool value
+   */
+  void initializeTuple(size_t pos, void* value) override;
+
+  /**
+   * @brief Sets all the values to false.
+   */
+  void initializeWithZeros() override;
+
+  /**
+   * @brief Sets all the values to the given value
+   * @param value
+   */
+  void initializeWithValue(bool value);
+
+  /**
+   * @brief deepCopy
+   * @param forceNoAllocate
+   * @return
+   */
+  IDataArray::Pointer deepCopy(bool forceNoAllocate = false) override;
+
+  /**
+   * @brief Reseizes the internal array
+   * @param size The new size of the internal array
+   * @return 1 on success, 0 on failure
+   */
+  int32_t resizeTotalElements(size_t size) override;
+
+  /**
+   * @brief Resizes the internal array to accomondate numTuples. New values are false.
+   * @param numTuples
+   */
+  void resizeTuples(size_t numTuples) override;
+
+  /**
+   * @brief Initializes this class to zero bytes freeing any data that it currently owns
+   */
+  virtual void initialize();
+
+  /**
+   * @brief printTuple
+   * @param out
+   * @param i
+   * @param delimiter
+   */
+  void printTuple(QTextStream& out, size_t i, char delimiter = ',') override;
+
+  /**
+   * @brief printComponent
+   * @param out
+   * @param i
+   * @param j
+   */
+  void printComponent(QTextStream& out, size_t i, int j) override;
+
+  /**
+   * @brief getFullNameOfClass
+   * @return
+   */
+  QString getFullNameOfClass();
+
+  /**
+   * @brief Writes the packed words as a 1D uint64 data set along with the usual
+   * DataArray attributes. The tuple dimensions describe the number of bits.
+   * @param parentId
+   * @param tDims
+   * @return
+   */
+  int writeH5Data(hid_t parentId, std::vector<size_t> tDims) override;
+
+  /**
+   * @brief writeXdmfAttribute
+   * @param out
+   * @param volDims
+   * @param hdfFileName
+   * @param groupPath
+   * @return
+   */
+  int writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& labelb) override;
+
+  /**
+   * @brief getInfoString
+   * @return Returns a formatted string that contains general infomation about
+   * the instance of the object.
+   */
+  QString getInfoString(SIMPL::InfoStringFormat format) override;
+
+  /**
+   * @brief Reads the packed words written by writeH5Data
+   * @param parentId
+   * @return
+   */
+  int readH5Data(hid_t parentId) override;
+
+  /**
+   * @brief setValue
+   * @param i
+   * @param value
+   */
+  inline void setValue(size_t i, bool value)
+  {
+    WordType bit = WordType(1) << (i % k_BitsPerWord);
+    if(value)
+    {
+      m_Words[i / k_BitsPerWord] |= bit;
+    }
+    else
+    {
+      m_Words[i / k_BitsPerWord] &= ~bit;
+    }
+  }
+
+  /**
+   * @brief getValue
+   * @param i
+   * @return
+   */
+  inline bool getValue(size_t i) const
+  {
+    return ((m_Words[i / k_BitsPerWord] >> (i % k_BitsPerWord)) & WordType(1)) != 0;
+  }
+
+  /**
+   * @brief Returns the number of 64 bit words used to store the values
+   */
+  size_t getNumberOfWords() const;
+
+  /**
+   * @brief Returns a pointer to the packed words. Bit j of word w holds the value at
+   * index (w * 64 + j). Callers that write whole words must leave the bits past the
+   * last tuple at zero.
+   * @param wordIndex
+   * @return
+   */
+  WordType* getWordPointer(size_t wordIndex);
+
+  /**
+   * @brief Sets this mask to (this AND other)
+   * @param other A mask with the same number of tuples
+   * @return false if the number of tuples does not match
+   */
+  bool andWith(const BitMaskArray& other);
+
+  /**
+   * @brief Sets this mask to (this OR other)
+   * @param other A mask with the same number of tuples
+   * @return false if the number of tuples does not match
+   */
+  bool orWith(const BitMaskArray& other);
+
+  /**
+   * @brief Flips every value in the mask
+   */
+  void invert();
+
+  /**
+   * @brief Returns the number of values that are true
+   */
+  size_t countTrue() const;
+
+protected:
+  /**
+   * @brief Protected Constructor
+   * @param numTuples The number of values in the mask
+   * @param name The name of the array
+   * @param allocate Should the words be allocated right away
+   */
+  BitMaskArray(size_t numTuples, const QString& name, bool allocate = true);
+
+  BitMaskArray();
+
+  /**
+   * @brief Zeros the unused bits of the last word
+   */
+  void clearTrailingBits();
+
+private:
+  std::vector<WordType> m_Words;
+  size_t m_NumTuples = 0;
+  bool m_IsAllocated = false;
+
+public:
+  BitMaskArray(const BitMaskArray&) = delete;            // Copy Constructor Not Implemented
+  BitMaskArray(BitMaskArray&&) = delete;                 // Move Constructor Not Implemented
+  BitMaskArray& operator=(const BitMaskArray&) = delete; // Copy Assignment Not Implemented
+  BitMaskArray& operator=(BitMaskArray&&) = delete;      // Move Assignment Not Implemented
+};
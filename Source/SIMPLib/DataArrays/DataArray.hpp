@@ -36,15 +36,18 @@
 #pragma once
 
 // STL Includes
+#include <atomic>
 #include <cassert>
 #include <cstring>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <string>
 #include <vector>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArrayAllocator.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
@@ -362,7 +365,7 @@ public:
   /**
    * @brief WrapPointer Creates a DataArray<T> object that references the pointer. The original caller can
    * set if the memory should be "free()'ed" when the object goes away. The original memory MUST have been
-   * "alloc()'ed" and <b>NOT</b> new 'ed.
+   * "alloc()'ed" (or come from a DataArrayAllocator) and <b>NOT</b> new 'ed.
    * @param data
    * @param numTuples
    * @param cDims
@@ -382,6 +385,7 @@ public:
     if(nullptr != data)
     {
       p->m_IsAllocated = true;
+      p->m_Capacity = p->m_Size;
     }
 
     return p;
@@ -390,7 +394,16 @@ public:
   //========================================= Begin API =================================
 
   /**
-   * @brief deepCopy
+   * @brief deepCopy Creates a copy of this array. If this array owns its memory the copy shares
+   * the same buffer until either array is modified (copy-on-write), so the cost of this call does
+   * not depend on the size of the array. The values are only copied on the first mutable access
+   * (getPointer(), setValue(), non-const iterators, resizing...) of either array, which moves
+   * that array to its own buffer.
+   *
+   * Raw pointers into this array that were taken before the call still point into the shared
+   * buffer, so writing through them would change the copy too. Take them again after the copy.
+   * Several threads may make the first mutable access at the same time, but no thread may read
+   * the array through a pointer taken before that access while it happens.
    * @param forceNoAllocate
    * @return
    */
@@ -401,10 +414,25 @@ public:
     {
       allocate = false;
     }
+    if(allocate && m_OwnsData && nullptr != m_Array)
+    {
+      Pointer daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+      makeShareable();
+      daCopy->m_SharedArray = m_SharedArray;
+      daCopy->m_Shared = true;
+      daCopy->m_Array = m_Array;
+      daCopy->m_Size = m_Size;
+      daCopy->m_Capacity = m_Capacity;
+      daCopy->m_MaxId = m_MaxId;
+      daCopy->m_IsAllocated = true;
+      daCopy->m_OwnsData = true;
+      daCopy->m_Allocator = m_Allocator;
+      return daCopy;
+    }
     IDataArray::Pointer daCopy = createNewArray(getNumberOfTuples(), getComponentDimensions(), getName(), allocate);
     if(m_IsAllocated && !forceNoAllocate)
     {
-      T* src = getPointer(0);
+      const T* src = getConstPointer(0);
       void* dest = daCopy->getVoidPointer(0);
       size_t totalBytes = (getNumberOfTuples() * getNumberOfComponents() * sizeof(T));
       std::memcpy(dest, src, totalBytes);
@@ -412,6 +440,39 @@ public:
     return daCopy;
   }
 
+  /**
+   * @brief Returns true if the internal array is currently shared with at least one other
+   * array through deepCopy(). The first mutable access gives this array its own copy.
+   * @return
+   */
+  bool isShared() override
+  {
+    if(!m_Shared.load(std::memory_order_acquire))
+    {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(GetCopyOnWriteMutex(this));
+    return (nullptr != m_SharedArray && m_SharedArray.use_count() > 1);
+  }
+
+  /**
+   * @brief Returns the number of bytes of the internal array that are shared with other arrays.
+   * @return
+   */
+  size_t getSharedByteCount() override
+  {
+    return isShared() ? m_Size * sizeof(T) : 0;
+  }
+
+  /**
+   * @brief Returns the number of bytes of the internal array that belong to this array only.
+   * @return
+   */
+  size_t getUniqueByteCount() override
+  {
+    return (m_IsAllocated && !isShared()) ? m_Size * sizeof(T) : 0;
+  }
+
   /**
    * @brief GetTypeName Returns a string representation of the type of data that is stored by this class. This
    * can be a primitive like char, float, int or the name of a class.
@@ -587,7 +648,7 @@ public:
       return false;
     }
     Self* source = dynamic_cast<Self*>(sourceArray.get());
-    if(nullptr == source->getPointer(0))
+    if(nullptr == source || nullptr == source->getConstPointer(0))
     {
       return false;
     }
@@ -609,7 +670,8 @@ public:
 
     size_t elementStart = destTupleOffset * getNumberOfComponents();
     size_t totalBytes = (totalSrcTuples * sourceArray->getNumberOfComponents()) * sizeof(T);
-    std::memcpy(m_Array + elementStart, source->getPointer(srcTupleOffset * sourceArray->getNumberOfComponents()), totalBytes);
+    detach();
+    std::memcpy(m_Array + elementStart, source->getConstPointer(srcTupleOffset * sourceArray->getNumberOfComponents()), totalBytes);
     return true;
   }
 
@@ -661,9 +723,30 @@ public:
    */
   void releaseOwnership() override
   {
+    // The caller takes the block over so it must not be shared with any other array
+    detach();
     m_OwnsData = false;
   }
 
+  /**
+   * @brief Sets the allocator that is used for all future allocations of this array. Memory that
+   * is already allocated stays where it is. Passing a null pointer selects the default allocator.
+   * @param allocator
+   */
+  void setAllocator(const DataArrayAllocator::Pointer& allocator)
+  {
+    m_Allocator = (nullptr != allocator) ? allocator : DataArrayAllocator::GetDefault();
+  }
+
+  /**
+   * @brief Returns the allocator that this array allocates its memory through
+   * @return
+   */
+  DataArrayAllocator::Pointer getAllocator() const
+  {
+    return m_Allocator;
+  }
+
   /**
    * @brief Allocates the memory needed for this class
    * @return 1 on success, -1 on failure
@@ -684,17 +767,14 @@ public:
     }
 
     size_t newSize = m_Size;
-#if defined(AIM_USE_SSE) && defined(__SSE2__)
-    m_Array = static_cast<T*>(_mm_malloc(newSize * sizeof(T), 16));
-#else
-    m_Array = (T*)malloc(newSize * sizeof(T));
-#endif
+    m_Array = static_cast<T*>(m_Allocator->allocate(newSize * sizeof(T)));
     if(!m_Array)
     {
       qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
       return -1;
     }
     m_Size = newSize;
+    m_Capacity = newSize;
     m_IsAllocated = true;
 
     return 1;
@@ -709,6 +789,7 @@ public:
     {
       return;
     }
+    detach();
     size_t typeSize = sizeof(T);
     ::memset(m_Array, 0, m_Size * typeSize);
   }
@@ -722,6 +803,7 @@ public:
     {
       return;
     }
+    detach();
     for(size_t i = offset; i < m_Size; i++)
     {
       m_Array[i] = initValue;
@@ -766,7 +848,12 @@ public:
     size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents;
 
     // Create a new m_Array to copy into
-    T* newArray = (T*)malloc(newSize * sizeof(T));
+    T* newArray = static_cast<T*>(m_Allocator->allocate(newSize * sizeof(T)));
+    if(nullptr == newArray)
+    {
+      qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
+      return -101;
+    }
     // Splat AB across the array so we know if we are copying the values or not
     ::memset(newArray, 0xAB, newSize * sizeof(T));
 
@@ -794,6 +881,7 @@ public:
       std::memcpy(currentDest, currentSrc, (getNumberOfTuples() - idxs.size()) * m_NumComponents * sizeof(T));
       deallocate(); // We are done copying - delete the current m_Array
       m_Size = newSize;
+      m_Capacity = newSize;
       m_Array = newArray;
       m_OwnsData = true;
       m_MaxId = newSize - 1;
@@ -837,6 +925,7 @@ public:
 
     // Allocation was successful.  Save it.
     m_Size = newSize;
+    m_Capacity = newSize;
     m_Array = newArray;
     // This object has now allocated its memory and owns it.
     m_OwnsData = true;
@@ -859,6 +948,7 @@ public:
     {
       return -1;
     }
+    detach();
     T* src = m_Array + (currentPos * m_NumComponents);
     T* dest = m_Array + (newPos * m_NumComponents);
     size_t bytes = sizeof(T) * m_NumComponents;
@@ -927,7 +1017,7 @@ public:
     {
       return nullptr;
     }
-
+    detach();
     return (void*)(&(m_Array[i]));
   }
 
@@ -950,6 +1040,7 @@ public:
     {
       return;
     }
+    detach();
     int i = 0;
     for(auto elem : newArray)
     {
@@ -972,9 +1063,27 @@ public:
       Q_ASSERT(i < m_Size);
     }
 #endif
+    detach();
     return (T*)(&(m_Array[i]));
   }
 
+  /**
+   * @brief Returns a read only pointer to a specific index into the array. Unlike getPointer()
+   * this never copies a buffer that is shared with other arrays.
+   * @param i The index to return the pointer to.
+   * @return The pointer to the index
+   */
+  const T* getConstPointer(size_t i) const
+  {
+#ifndef NDEBUG
+    if(m_Size > 0)
+    {
+      Q_ASSERT(i < m_Size);
+    }
+#endif
+    return m_Array + i;
+  }
+
   /**
    * @brief Returns the value for a given index
    * @param i The index to return the value at
@@ -1004,6 +1113,7 @@ public:
       Q_ASSERT(i < m_Size);
     }
 #endif
+    detach();
     m_Array[i] = value;
   }
 
@@ -1034,6 +1144,7 @@ public:
       Q_ASSERT(i * m_NumComponents + j < m_Size);
     }
 #endif
+    detach();
     m_Array[i * m_NumComponents + j] = c;
   }
 
@@ -1090,6 +1201,7 @@ public:
     {
       return;
     }
+    detach();
     T* c = reinterpret_cast<T*>(p);
     for(size_t j = 0; j < m_NumComponents; ++j)
     {
@@ -1109,6 +1221,7 @@ public:
       Q_ASSERT(tupleIndex * m_NumComponents < m_Size);
     }
 #endif
+    detach();
     return m_Array + (tupleIndex * m_NumComponents);
   }
 
@@ -1449,6 +1562,8 @@ public:
       ss << R"(<tr bgcolor="#FFFCEA"><th align="right">Total Elements:</th><td>)" << numStr << "</td></tr>";
       numStr = usa.toString(static_cast<qlonglong>(m_Size * sizeof(T)));
       ss << R"(<tr bgcolor="#FFFCEA"><th align="right">Total Memory Required:</th><td>)" << numStr << "</td></tr>";
+      numStr = usa.toString(static_cast<qlonglong>(getSharedByteCount()));
+      ss << R"(<tr bgcolor="#FFFCEA"><th align="right">Shared Memory:</th><td>)" << numStr << "</td></tr>";
       ss << "</tbody></table>\n";
       ss << "</body></html>";
     }
@@ -1459,34 +1574,60 @@ public:
   }
 
   /**
-   * @brief
+   * @brief Reads the data set with the same name as this array from the HDF5 group. The values are
+   * read straight into the memory of this array: memory that is already allocated (or wrapped) and
+   * large enough is reused, otherwise it is allocated through the allocator of this array. Values
+   * stored with a different type in the file are converted by HDF5 while reading.
    * @param parentId
    * @return
    */
   int readH5Data(hid_t parentId) override
   {
-    int err = 0;
+    QString objType;
+    int version = 0;
+    comp_dims_type tDims;
+    comp_dims_type cDims;
+    if(H5DataArrayReader::ReadRequiredAttributes(parentId, getName(), objType, version, tDims, cDims) < 0)
+    {
+      resizeTuples(0);
+      return -1;
+    }
+    size_t numTuples = std::accumulate(tDims.begin(), tDims.end(), static_cast<size_t>(1), std::multiplies<>());
+    return readH5Slab(parentId, numTuples, cDims, 0, 0);
+  }
 
-    resizeTuples(0);
-    IDataArray::Pointer p = H5DataArrayReader::ReadIDataArray(parentId, getName());
-    if(p.get() == nullptr)
+  /**
+   * @brief Reads the tuples [tupleOffset, tupleOffset + numTuples) of the data set with the same name
+   * as this array, without reading the rest of the data set. The array is resized to numTuples. If the
+   * data set has more than one tuple dimension the range must cover whole slices of its slowest tuple
+   * dimension, e.g. whole Z slices of an image.
+   * @param parentId
+   * @param tupleOffset The first tuple to read
+   * @param numTuples The number of tuples to read
+   * @return Negative value on error
+   */
+  int readH5Hyperslab(hid_t parentId, size_t tupleOffset, size_t numTuples)
+  {
+    QString objType;
+    int version = 0;
+    comp_dims_type tDims;
+    comp_dims_type cDims;
+    if(H5DataArrayReader::ReadRequiredAttributes(parentId, getName(), objType, version, tDims, cDims) < 0 || tDims.empty())
     {
       return -1;
     }
-    m_Array = reinterpret_cast<T*>(p->getVoidPointer(0));
-    m_Size = p->getSize();
-    m_OwnsData = true;
-    m_MaxId = (m_Size == 0) ? 0 : m_Size - 1;
-    m_IsAllocated = true;
-    setName(p->getName());
-    m_NumTuples = p->getNumberOfTuples();
-    m_CompDims = p->getComponentDimensions();
-    m_NumComponents = p->getNumberOfComponents();
-
-    // Tell the intermediate DataArray to release ownership of the data as we are going to be responsible
-    // for deleting the memory
-    p->releaseOwnership();
-    return err;
+    size_t sliceTuples = std::accumulate(tDims.begin(), tDims.end() - 1, static_cast<size_t>(1), std::multiplies<>());
+    if(sliceTuples == 0 || tupleOffset % sliceTuples != 0 || numTuples % sliceTuples != 0)
+    {
+      qDebug() << "The tuple range of " << getName() << " does not cover whole slices of " << sliceTuples << " tuples";
+      return -2;
+    }
+    if(numTuples == 0)
+    {
+      resizeTuples(0);
+      return 0;
+    }
+    return readH5Slab(parentId, numTuples, cDims, tupleOffset / sliceTuples, numTuples / sliceTuples);
   }
 
   /**
@@ -1494,6 +1635,7 @@ public:
    */
   virtual void byteSwapElements()
   {
+    detach();
     char* ptr = (char*)(m_Array);
     char t[8];
     size_t size = getTypeSize();
@@ -1740,19 +1882,23 @@ public:
 
   template <typename IteratorType> IteratorType begin()
   {
+    detach();
     return IteratorType(m_Array, m_NumComponents);
   }
   iterator begin()
   {
+    detach();
     return iterator(m_Array);
   }
 
   template <typename IteratorType> IteratorType end()
   {
+    detach();
     return IteratorType(m_Array + m_Size, m_NumComponents);
   }
   iterator end()
   {
+    detach();
     return iterator(m_Array + m_Size);
   }
 
@@ -1789,22 +1935,57 @@ public:
   //    resizeAndExtend(n);
   //  }
   // void resize (size_type n, const value_type& val);
+  /**
+   * @brief Returns the number of elements that the internal array has room for before
+   * it must be reallocated. This is always greater than or equal to size().
+   */
   size_type capacity() const noexcept
   {
-    return m_Size;
+    return m_Capacity;
   }
   bool empty() const noexcept
   {
     return (m_Size == 0);
   }
-  // reserve()
-  // shrink_to_fit()
+
+  /**
+   * @brief Increases the capacity of the array to at least n elements. The size of the
+   * array, the number of tuples and the values already stored are not changed. If n is
+   * less than or equal to the current capacity nothing is done.
+   * @param n The number of elements to reserve room for
+   */
+  void reserve(size_type n)
+  {
+    if(n <= m_Capacity)
+    {
+      return;
+    }
+    reallocateStorage(n > m_Size ? n : m_Size);
+  }
+
+  /**
+   * @brief Releases any unused capacity so that capacity() == size().
+   */
+  void shrink_to_fit()
+  {
+    if(m_Capacity == m_Size || !m_OwnsData)
+    {
+      return;
+    }
+    if(m_Size == 0)
+    {
+      clear();
+      return;
+    }
+    reallocateStorage(m_Size);
+  }
 
   // ######### Element Access #########
 
   inline reference operator[](size_type index)
   {
     // assert(index < m_Size);
+    detach();
     return m_Array[index];
   }
 
@@ -1817,6 +1998,7 @@ public:
   inline reference at(size_type index)
   {
     assert(index < m_Size);
+    detach();
     return m_Array[index];
   }
 
@@ -1828,6 +2010,7 @@ public:
 
   inline reference front()
   {
+    detach();
     return m_Array[0];
   }
   inline const T& front() const
@@ -1837,6 +2020,7 @@ public:
 
   inline reference back()
   {
+    detach();
     return m_Array[m_MaxId];
   }
   inline const T& back() const
@@ -1846,6 +2030,7 @@ public:
 
   inline T* data() noexcept
   {
+    detach();
     return m_Array;
   }
   inline const T* data() const noexcept
@@ -1863,11 +2048,13 @@ public:
   {
     size_type size = last - first;
     resizeAndExtend(size);
+    detach();
     size_type idx = 0;
     while(first != last)
     {
       m_Array[idx] = *first;
       first++;
+      idx++;
     }
   }
 
@@ -1879,6 +2066,7 @@ public:
   void assign(size_type n, const value_type& val) // fill (2)
   {
     resizeAndExtend(n);
+    detach();
     for(size_t i = 0; i < n; i++)
     {
       m_Array[i] = val;
@@ -1901,6 +2089,7 @@ public:
   void push_back(const value_type& val)
   {
     resizeAndExtend(m_Size + 1);
+    detach();
     m_Array[m_MaxId] = val;
   }
   /**
@@ -1910,6 +2099,7 @@ public:
   void push_back(value_type&& val)
   {
     resizeAndExtend(m_Size + 1);
+    detach();
     m_Array[m_MaxId] = val;
   }
 
@@ -1936,6 +2126,7 @@ public:
     }
     m_Array = nullptr;
     m_Size = 0;
+    m_Capacity = 0;
     m_OwnsData = true;
     m_MaxId = 0;
     m_IsAllocated = false;
@@ -1969,6 +2160,18 @@ protected:
    */
   void deallocate()
   {
+    if(nullptr != m_SharedArray)
+    {
+      // Other arrays may still be reading this block. Dropping our reference frees it
+      // once the last of them is gone.
+      m_SharedArray.reset();
+      m_Shared = false;
+      m_Array = nullptr;
+      m_Capacity = 0;
+      m_IsAllocated = false;
+      return;
+    }
+
     // We are going to splat 0xABABAB across the first value of the array as a debugging aid
     auto cptr = reinterpret_cast<unsigned char*>(m_Array);
     if(nullptr != cptr)
@@ -2009,12 +2212,9 @@ protected:
       }
 #endif
 
-#if defined(AIM_USE_SSE) && defined(__SSE2__)
-    _mm_free(m_buffer);
-#else
-    free(m_Array);
-#endif
+    m_Allocator->deallocate(m_Array);
     m_Array = nullptr;
+    m_Capacity = 0;
     m_IsAllocated = false;
   }
 
@@ -2040,102 +2240,262 @@ protected:
   }
 
   /**
-   * @brief resizes the internal array to be 'size' elements in length
+   * @brief resizes the internal array to be 'size' elements in length. The
+   * internal array is only reallocated when 'size' exceeds the current capacity,
+   * in which case the capacity grows geometrically so that repeated appends are
+   * amortized O(1). Shrinking the array keeps the capacity; use shrink_to_fit()
+   * to release the unused memory.
    * @param size
    * @return Pointer to the internal array
    */
   virtual T* resizeAndExtend(size_t size)
   {
-    T* newArray;
-    size_t newSize;
-    size_t oldSize;
-
     if(size == m_Size) // Requested size is equal to current size.  Do nothing.
     {
       return m_Array;
     }
-    newSize = size;
-    oldSize = m_Size;
+    size_t oldSize = m_Size;
 
     // Wipe out the array completely if new size is zero.
-    if(newSize == 0)
+    if(size == 0)
     {
       clear();
       return m_Array;
     }
-    // OS X's realloc does not free memory if the new block is smaller.  This
-    // is a very serious problem and causes huge amount of memory to be
-    // wasted. Do not use realloc on the Mac.
-    bool dontUseRealloc = false;
-#if defined __APPLE__
-    dontUseRealloc = true;
-#endif
 
-    // Allocate a new array if we DO NOT own the current array
-    if((nullptr != m_Array) && (false == m_OwnsData))
+    if(nullptr == m_Array || !m_OwnsData)
     {
-      // The old array is owned by the user so we cannot try to
-      // reallocate it.  Just allocate new memory that we will own.
-      newArray = (T*)malloc(newSize * sizeof(T));
-      if(!newArray)
+      // Either nothing has been allocated yet or the memory belongs to somebody
+      // else. Allocate exactly what was asked for.
+      if(nullptr == reallocateStorage(size))
+      {
+        return nullptr;
+      }
+    }
+    else if(size > m_Capacity)
+    {
+      size_t newCapacity = m_Capacity + m_Capacity / 2;
+      if(newCapacity < size)
+      {
+        newCapacity = size;
+      }
+      if(nullptr == reallocateStorage(newCapacity))
       {
-        qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
         return nullptr;
       }
+    }
 
-      // Copy the data from the old array.
-      std::memcpy(newArray, m_Array, (newSize < m_Size ? newSize : m_Size) * sizeof(T));
+    m_Size = size;
+    m_MaxId = size - 1;
+    m_IsAllocated = true;
+
+    // Initialize the new tuples if newSize is larger than old size
+    if(size > oldSize)
+    {
+      initializeWithValue(m_InitValue, oldSize);
+    }
+
+    return m_Array;
+  }
+
+  /**
+   * @brief Moves the contents of the internal array into a block of memory that can hold
+   * exactly 'newCapacity' elements. At most 'newCapacity' of the current values are kept.
+   * The size of the array is clamped to the new capacity. After this call the array owns
+   * its memory.
+   * @param newCapacity
+   * @return Pointer to the internal array or nullptr if the memory could not be allocated
+   */
+  T* reallocateStorage(size_t newCapacity)
+  {
+    if(nullptr != m_SharedArray && m_SharedArray.use_count() == 1)
+    {
+      // Nobody else references the block any more so it can be resized in place
+      detach();
     }
-    else if(!dontUseRealloc)
+
+    T* newArray = nullptr;
+    size_t numToCopy = (newCapacity < m_Size ? newCapacity : m_Size);
+    if(nullptr == m_Array)
     {
-      // Try to reallocate with minimal memory usage and possibly avoid copying.
-      newArray = (T*)realloc(m_Array, newSize * sizeof(T));
+      numToCopy = 0;
+    }
+
+    if((nullptr != m_Array) && m_OwnsData && nullptr == m_SharedArray)
+    {
+      // Let the allocator resize the block, possibly without copying.
+      newArray = static_cast<T*>(m_Allocator->reallocate(m_Array, numToCopy * sizeof(T), newCapacity * sizeof(T)));
       if(!newArray)
       {
-        qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
+        qDebug() << "Unable to allocate " << newCapacity << " elements of size " << sizeof(T) << " bytes. ";
         return nullptr;
       }
     }
     else
     {
-      newArray = (T*)malloc(newSize * sizeof(T));
+      // The old array (if any) is owned by the user or shared with other arrays so
+      // we cannot try to reallocate it.  Just allocate new memory that we will own.
+      newArray = static_cast<T*>(m_Allocator->allocate(newCapacity * sizeof(T)));
       if(!newArray)
       {
-        qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
+        qDebug() << "Unable to allocate " << newCapacity << " elements of size " << sizeof(T) << " bytes. ";
         return nullptr;
       }
 
       // Copy the data from the old array.
-      if(m_Array != nullptr)
+      if(numToCopy > 0)
       {
-        std::memcpy(newArray, m_Array, (newSize < m_Size ? newSize : m_Size) * sizeof(T));
+        std::memcpy(newArray, m_Array, numToCopy * sizeof(T));
       }
-      // Free the old array
-      deallocate();
+      m_SharedArray.reset();
+      m_Shared = false;
     }
 
-    // Allocation was successful.  Save it.
-    m_Size = newSize;
     m_Array = newArray;
-
+    m_Capacity = newCapacity;
     // This object has now allocated its memory and owns it.
     m_OwnsData = true;
-
-    m_MaxId = newSize - 1;
     m_IsAllocated = true;
-
-    // Initialize the new tuples if newSize is larger than old size
-    if(newSize > oldSize)
+    if(m_Size > newCapacity)
     {
-      initializeWithValue(m_InitValue, oldSize);
+      m_Size = newCapacity;
+      m_MaxId = newCapacity - 1;
     }
 
     return m_Array;
   }
 
+  /**
+   * @brief Makes sure that the internal array is not shared with any other array. This is
+   * called before every mutable access and only costs a load of m_Shared once the array
+   * has its own buffer.
+   */
+  inline void detach()
+  {
+    if(m_Shared.load(std::memory_order_acquire))
+    {
+      detachSharedArray();
+    }
+  }
+
+  /**
+   * @brief Makes room for numTuples tuples with the given component dimensions and reads slabCount
+   * indices of the slowest dimension of the data set, starting at slabOffset, into it. A slabCount
+   * of zero reads the whole data set. The values are not initialized before the read.
+   * @return Negative value on error
+   */
+  int readH5Slab(hid_t parentId, size_t numTuples, const comp_dims_type& cDims, size_t slabOffset, size_t slabCount)
+  {
+    size_t numComponents = std::accumulate(cDims.begin(), cDims.end(), static_cast<size_t>(1), std::multiplies<>());
+    size_t size = numTuples * numComponents;
+    bool reuse = (nullptr != m_Array && nullptr == m_SharedArray && size <= (m_OwnsData ? m_Capacity : m_Size));
+    if(!reuse)
+    {
+      clear();
+      if(size > 0)
+      {
+        m_Array = static_cast<T*>(m_Allocator->allocate(size * sizeof(T)));
+        if(nullptr == m_Array)
+        {
+          qDebug() << "Unable to allocate " << size << " elements of size " << sizeof(T) << " bytes. ";
+          return -101;
+        }
+        m_Capacity = size;
+      }
+    }
+    m_Size = size;
+    m_MaxId = (size == 0) ? 0 : size - 1;
+    m_NumTuples = numTuples;
+    m_CompDims = cDims;
+    m_NumComponents = numComponents;
+    m_IsAllocated = (size > 0);
+
+    int err = H5DataArrayReader::ReadDatasetIntoBuffer(parentId, getName(), H5Lite::HDFTypeForPrimitive(static_cast<T>(0)), m_Array, size, slabOffset, slabCount);
+    if(err < 0)
+    {
+      clear();
+    }
+    return err;
+  }
+
 private:
+  /**
+   * @brief Frees a block that was handed to a shared pointer by makeShareable() unless the
+   * last array that referenced it has taken the block back.
+   */
+  struct SharedArrayDeleter
+  {
+    DataArrayAllocator::Pointer allocator;
+    bool released = false;
+
+    void operator()(T* ptr) const
+    {
+      if(!released)
+      {
+        allocator->deallocate(ptr);
+      }
+    }
+  };
+
+  /**
+   * @brief Moves the ownership of the internal array into a reference counted buffer that
+   * copies of this array can share.
+   */
+  void makeShareable()
+  {
+    if(nullptr == m_SharedArray && nullptr != m_Array && m_OwnsData)
+    {
+      m_SharedArray = std::shared_ptr<T>(m_Array, SharedArrayDeleter{m_Allocator});
+    }
+    m_Shared = true;
+  }
+
+  /**
+   * @brief Gives this array a private copy of the shared buffer, or takes the buffer back
+   * without copying if this is the last array that references it. Threads that get here at
+   * the same time wait for the first one, which clears m_Shared only after m_Array points
+   * to the new buffer.
+   */
+  void detachSharedArray()
+  {
+    std::lock_guard<std::mutex> lock(GetCopyOnWriteMutex(this));
+    if(!m_Shared.load(std::memory_order_relaxed))
+    {
+      return;
+    }
+
+    if(m_SharedArray.use_count() == 1)
+    {
+      // The other arrays finished reading the block before they let go of it
+      std::atomic_thread_fence(std::memory_order_acquire);
+      std::get_deleter<SharedArrayDeleter>(m_SharedArray)->released = true;
+      m_SharedArray.reset();
+      m_Shared.store(false, std::memory_order_release);
+      return;
+    }
+
+    size_t newCapacity = (m_Capacity > m_Size) ? m_Capacity : m_Size;
+    T* newArray = static_cast<T*>(m_Allocator->allocate(newCapacity * sizeof(T)));
+    if(nullptr == newArray)
+    {
+      qDebug() << "Unable to allocate " << newCapacity << " elements of size " << sizeof(T) << " bytes. ";
+      // Writing through the shared block would modify every copy of this array
+      throw std::bad_alloc();
+    }
+    std::memcpy(newArray, m_Array, m_Size * sizeof(T));
+    m_SharedArray.reset();
+    m_Array = newArray;
+    m_Capacity = newCapacity;
+    m_Shared.store(false, std::memory_order_release);
+  }
+
   T* m_Array = nullptr;
+  // The shared_ptr counts the arrays that reference a buffer shared through deepCopy(), and
+  // m_Shared tells the accessors without locking whether this array still holds one
+  std::shared_ptr<T> m_SharedArray;
+  std::atomic<bool> m_Shared = {false};
   size_t m_Size = 0;
+  size_t m_Capacity = 0;
   size_t m_MaxId = 0;
   size_t m_NumTuples = 0;
   size_t m_NumComponents = 1;
@@ -2143,6 +2503,7 @@ private:
   comp_dims_type m_CompDims = {1};
   bool m_IsAllocated = false;
   bool m_OwnsData = true;
+  DataArrayAllocator::Pointer m_Allocator = DataArrayAllocator::GetDefault();
 };
 
 // -----------------------------------------------------------------------------
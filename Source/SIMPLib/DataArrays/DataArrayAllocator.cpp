@@ -0,0 +1,810 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataArrayAllocator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QFile>
+#include <QtCore/QLocale>
+#include <QtCore/QTextStream>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <malloc.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+enum class BlockKind : unsigned int
+{
+  Malloc = 0,
+  Aligned = 1,
+  Mapped = 2,
+  FileMapped = 3
+};
+
+struct BlockRecord
+{
+  BlockKind kind = BlockKind::Malloc;
+  size_t numBytes = 0;
+  size_t mappedBytes = 0;
+  void* fileHandle = nullptr;
+  std::shared_ptr<DataArrayAllocator::Counters> counters;
+};
+
+/**
+ * @brief Process wide table of every block that was handed out by an allocator. The table is
+ * split into shards that are picked by the address of the block, each with its own lock, so
+ * that threads creating and releasing arrays at the same time rarely wait on each other.
+ */
+class BlockTable
+{
+public:
+  void insert(void* ptr, const BlockRecord& record)
+  {
+    Shard& shard = getShard(ptr);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.blocks[ptr] = record;
+  }
+
+  bool find(void* ptr, BlockRecord& record)
+  {
+    Shard& shard = getShard(ptr);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iter = shard.blocks.find(ptr);
+    if(iter == shard.blocks.end())
+    {
+      return false;
+    }
+    record = iter->second;
+    return true;
+  }
+
+  bool take(void* ptr, BlockRecord& record)
+  {
+    Shard& shard = getShard(ptr);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iter = shard.blocks.find(ptr);
+    if(iter == shard.blocks.end())
+    {
+      return false;
+    }
+    record = std::move(iter->second);
+    shard.blocks.erase(iter);
+    return true;
+  }
+
+private:
+  static const size_t k_NumShards = 64;
+
+  // Each shard sits on its own cache lines so that the locks do not false share
+  struct alignas(64) Shard
+  {
+    std::mutex mutex;
+    std::unordered_map<void*, BlockRecord> blocks;
+  };
+
+  Shard& getShard(void* ptr)
+  {
+    // Fibonacci hashing spreads the (aligned) addresses evenly over the shards
+    uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr)) * 0x9E3779B97F4A7C15ull;
+    return m_Shards[static_cast<size_t>(hash >> 58)];
+  }
+
+  Shard m_Shards[k_NumShards];
+};
+
+BlockTable& GetBlockTable()
+{
+  static BlockTable table;
+  return table;
+}
+
+DataArrayAllocator::Counters& GetGlobalCounters()
+{
+  static DataArrayAllocator::Counters counters;
+  return counters;
+}
+
+/**
+ * @brief Holds the default allocator. Every DataArray reads it when it is constructed, so the
+ * current allocator is published through an atomic pointer and read without a lock. The lock
+ * is only taken to change it. Replaced holders are kept until the process exits because a
+ * reader may still be copying out of them; SetDefault() is called rarely enough that this
+ * does not matter.
+ */
+class DefaultAllocatorHolder
+{
+public:
+  DataArrayAllocator::Pointer get() const
+  {
+    const DataArrayAllocator::Pointer* current = m_Current.load(std::memory_order_acquire);
+    return (nullptr == current) ? DataArrayAllocator::NullPointer() : *current;
+  }
+
+  void set(const DataArrayAllocator::Pointer& allocator)
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    publish(allocator);
+  }
+
+  /**
+   * @brief Publishes the allocator made by the factory if no allocator is set yet
+   */
+  template <typename Factory>
+  DataArrayAllocator::Pointer getOrCreate(Factory factory)
+  {
+    DataArrayAllocator::Pointer allocator = get();
+    if(nullptr != allocator)
+    {
+      return allocator;
+    }
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    allocator = get();
+    if(nullptr == allocator)
+    {
+      allocator = factory();
+      publish(allocator);
+    }
+    return allocator;
+  }
+
+private:
+  void publish(const DataArrayAllocator::Pointer& allocator)
+  {
+    m_Holders.emplace_back(new DataArrayAllocator::Pointer(allocator));
+    m_Current.store(m_Holders.back().get(), std::memory_order_release);
+  }
+
+  std::atomic<const DataArrayAllocator::Pointer*> m_Current{nullptr};
+  std::mutex m_Mutex;
+  std::vector<std::unique_ptr<DataArrayAllocator::Pointer>> m_Holders;
+};
+
+DefaultAllocatorHolder& GetDefaultAllocator()
+{
+  static DefaultAllocatorHolder holder;
+  return holder;
+}
+
+size_t GetPageSize()
+{
+#if defined(_WIN32)
+  return 4096;
+#else
+  long pageSize = sysconf(_SC_PAGESIZE);
+  return (pageSize > 0) ? static_cast<size_t>(pageSize) : 4096;
+#endif
+}
+
+void* AlignedMalloc(size_t numBytes, size_t alignment)
+{
+#if defined(_WIN32)
+  return _aligned_malloc(numBytes, alignment);
+#else
+  void* ptr = nullptr;
+  if(posix_memalign(&ptr, alignment, numBytes) != 0)
+  {
+    return nullptr;
+  }
+  return ptr;
+#endif
+}
+
+/**
+ * @brief Creates an (already deleted) scratch file of numBytes bytes in the given directory and maps it
+ * into memory.
+ */
+void* MapScratchFile(const QString& scratchDirectory, size_t numBytes, BlockRecord& record)
+{
+#if defined(_WIN32)
+  std::wstring directory = scratchDirectory.toStdWString();
+  wchar_t filePath[MAX_PATH];
+  if(GetTempFileNameW(directory.c_str(), L"SIM", 0, filePath) == 0)
+  {
+    return nullptr;
+  }
+  HANDLE file = CreateFileW(filePath, GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+  if(file == INVALID_HANDLE_VALUE)
+  {
+    DeleteFileW(filePath);
+    return nullptr;
+  }
+  uint64_t size = static_cast<uint64_t>(numBytes);
+  HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32), static_cast<DWORD>(size & 0xFFFFFFFFull), nullptr);
+  if(nullptr == mapping)
+  {
+    CloseHandle(file);
+    return nullptr;
+  }
+  void* ptr = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, numBytes);
+  // The view keeps the mapping alive
+  CloseHandle(mapping);
+  if(nullptr == ptr)
+  {
+    CloseHandle(file);
+    return nullptr;
+  }
+  record.fileHandle = file;
+#else
+  QByteArray pathTemplate = QFile::encodeName(scratchDirectory + "/SIMPL_DataArray_XXXXXX");
+  std::vector<char> filePath(pathTemplate.constData(), pathTemplate.constData() + pathTemplate.size() + 1);
+  int fd = mkstemp(filePath.data());
+  if(fd < 0)
+  {
+    return nullptr;
+  }
+  // The mapping keeps the file contents alive. Removing the name right away means that
+  // nothing is left behind in the scratch directory, even if the process is killed.
+  unlink(filePath.data());
+  if(ftruncate(fd, static_cast<off_t>(numBytes)) != 0)
+  {
+    close(fd);
+    return nullptr;
+  }
+  void* ptr = mmap(nullptr, numBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if(ptr == MAP_FAILED)
+  {
+    return nullptr;
+  }
+#endif
+  record.kind = BlockKind::FileMapped;
+  record.mappedBytes = numBytes;
+  return ptr;
+}
+
+void ReleaseBlock(void* ptr, const BlockRecord& record)
+{
+  switch(record.kind)
+  {
+  case BlockKind::Mapped:
+#if !defined(_WIN32)
+    munmap(ptr, record.mappedBytes);
+#endif
+    break;
+  case BlockKind::FileMapped:
+#if defined(_WIN32)
+    UnmapViewOfFile(ptr);
+    CloseHandle(static_cast<HANDLE>(record.fileHandle));
+#else
+    munmap(ptr, record.mappedBytes);
+#endif
+    break;
+  case BlockKind::Aligned:
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+    break;
+  case BlockKind::Malloc:
+    free(ptr);
+    break;
+  }
+}
+
+/**
+ * @brief Writes one byte into every page of a block
+ */
+class FirstTouchImpl
+{
+public:
+  FirstTouchImpl(char* ptr, size_t numBytes, size_t pageSize)
+  : m_Ptr(ptr)
+  , m_NumBytes(numBytes)
+  , m_PageSize(pageSize)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t page = range.min(); page < range.max(); page++)
+    {
+      size_t offset = page * m_PageSize;
+      if(offset < m_NumBytes)
+      {
+        m_Ptr[offset] = 0;
+      }
+    }
+  }
+
+private:
+  char* m_Ptr = nullptr;
+  size_t m_NumBytes = 0;
+  size_t m_PageSize = 4096;
+};
+} // namespace
+
+const size_t DataArrayAllocator::k_DefaultAlignment;
+const size_t DataArrayAllocator::k_CacheLineAlignment;
+const size_t DataArrayAllocator::k_HugePageSize;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Counters::Counters()
+: bytesLive(0)
+, bytesFileBacked(0)
+, bytesPeak(0)
+, bytesAllocated(0)
+, numAllocations(0)
+, numLiveBlocks(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::Counters::add(size_t numBytes, bool fileBacked)
+{
+  if(fileBacked)
+  {
+    bytesFileBacked += numBytes;
+  }
+  size_t live = bytesLive.fetch_add(numBytes) + numBytes;
+  bytesAllocated += numBytes;
+  numAllocations++;
+  numLiveBlocks++;
+  size_t peak = bytesPeak.load();
+  while(live > peak && !bytesPeak.compare_exchange_weak(peak, live))
+  {
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::Counters::remove(size_t numBytes, bool fileBacked)
+{
+  if(fileBacked)
+  {
+    bytesFileBacked -= numBytes;
+  }
+  bytesLive.fetch_sub(numBytes);
+  numLiveBlocks--;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::DataArrayAllocator(size_t alignment, HugePageMode hugePages, bool parallelFirstTouch)
+: m_Alignment(alignment)
+, m_HugePages(hugePages)
+, m_ParallelFirstTouch(parallelFirstTouch)
+, m_Counters(std::make_shared<Counters>())
+{
+  // Alignments smaller than a pointer (or not a power of two) are not accepted by posix_memalign
+  if(m_Alignment != 0 && ((m_Alignment & (m_Alignment - 1)) != 0 || m_Alignment < sizeof(void*)))
+  {
+    m_Alignment = k_DefaultAlignment;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::~DataArrayAllocator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Pointer DataArrayAllocator::New(size_t alignment, HugePageMode hugePages, bool parallelFirstTouch)
+{
+  Pointer sharedPtr(new DataArrayAllocator(alignment, hugePages, parallelFirstTouch));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Pointer DataArrayAllocator::NewFileBacked(const QString& scratchDirectory, FileBackedMode mode, size_t thresholdBytes)
+{
+  Pointer sharedPtr(new DataArrayAllocator(k_DefaultAlignment, HugePageMode::Disabled, false));
+  sharedPtr->setFileBacking(scratchDirectory, mode, thresholdBytes);
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Pointer DataArrayAllocator::GetDefault()
+{
+  return GetDefaultAllocator().getOrCreate([] {
+    Pointer allocator = New();
+    const char* scratchDirectory = std::getenv("SIMPL_SCRATCH_DIRECTORY");
+    if(nullptr != scratchDirectory && scratchDirectory[0] != '\0')
+    {
+      allocator->setFileBacking(QFile::decodeName(scratchDirectory), FileBackedMode::OnAllocationFailure);
+    }
+    return allocator;
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::SetDefault(const Pointer& allocator)
+{
+  GetDefaultAllocator().set(allocator);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Statistics DataArrayAllocator::GetGlobalStatistics()
+{
+  Counters& counters = GetGlobalCounters();
+  Statistics stats;
+  stats.bytesLive = counters.bytesLive.load();
+  stats.bytesFileBacked = counters.bytesFileBacked.load();
+  stats.bytesPeak = counters.bytesPeak.load();
+  stats.bytesAllocated = counters.bytesAllocated.load();
+  stats.numAllocations = counters.numAllocations.load();
+  stats.numLiveBlocks = counters.numLiveBlocks.load();
+  return stats;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayAllocator::allocate(size_t numBytes)
+{
+  if(numBytes == 0)
+  {
+    return nullptr;
+  }
+
+  BlockRecord record;
+  record.numBytes = numBytes;
+  record.counters = m_Counters;
+  void* ptr = nullptr;
+  bool isLarge = (numBytes >= k_HugePageSize);
+  bool canUseFile = (m_FileBacked != FileBackedMode::Never) && !m_ScratchDirectory.isEmpty() && numBytes >= m_FileBackedThreshold;
+
+  if(canUseFile && m_FileBacked == FileBackedMode::Always)
+  {
+    ptr = MapScratchFile(m_ScratchDirectory, numBytes, record);
+  }
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+  if(nullptr == ptr && isLarge && m_HugePages == HugePageMode::Explicit)
+  {
+    size_t mappedBytes = ((numBytes + k_HugePageSize - 1) / k_HugePageSize) * k_HugePageSize;
+    void* mapped = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if(mapped != MAP_FAILED)
+    {
+      ptr = mapped;
+      record.kind = BlockKind::Mapped;
+      record.mappedBytes = mappedBytes;
+    }
+  }
+#endif
+
+  if(nullptr == ptr)
+  {
+    size_t alignment = m_Alignment;
+    if(isLarge && m_HugePages != HugePageMode::Disabled)
+    {
+      alignment = std::max(alignment, k_HugePageSize);
+    }
+
+    if(alignment <= alignof(std::max_align_t))
+    {
+      ptr = malloc(numBytes);
+      record.kind = BlockKind::Malloc;
+    }
+    else
+    {
+      ptr = AlignedMalloc(numBytes, alignment);
+      record.kind = BlockKind::Aligned;
+    }
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if(nullptr != ptr && isLarge && m_HugePages != HugePageMode::Disabled)
+    {
+      madvise(ptr, (numBytes / k_HugePageSize) * k_HugePageSize, MADV_HUGEPAGE);
+    }
+#endif
+  }
+
+  if(nullptr == ptr && canUseFile && m_FileBacked == FileBackedMode::OnAllocationFailure)
+  {
+    ptr = MapScratchFile(m_ScratchDirectory, numBytes, record);
+  }
+  if(nullptr == ptr)
+  {
+    return nullptr;
+  }
+
+  bool fileBacked = (record.kind == BlockKind::FileMapped);
+  GetBlockTable().insert(ptr, record);
+  m_Counters->add(numBytes, fileBacked);
+  GetGlobalCounters().add(numBytes, fileBacked);
+
+  if(m_ParallelFirstTouch && isLarge && !fileBacked)
+  {
+    firstTouch(ptr, numBytes);
+  }
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayAllocator::reallocate(void* ptr, size_t oldNumBytes, size_t numBytes)
+{
+  if(nullptr == ptr)
+  {
+    return allocate(numBytes);
+  }
+  if(numBytes == 0)
+  {
+    deallocate(ptr);
+    return nullptr;
+  }
+
+  BlockRecord record;
+  bool isKnown = GetBlockTable().find(ptr, record);
+  bool isMallocBlock = !isKnown || record.kind == BlockKind::Malloc;
+  bool wantsMallocBlock = (m_Alignment <= alignof(std::max_align_t)) && (m_HugePages == HugePageMode::Disabled || numBytes < k_HugePageSize);
+  if(m_FileBacked == FileBackedMode::Always && !m_ScratchDirectory.isEmpty() && numBytes >= m_FileBackedThreshold)
+  {
+    wantsMallocBlock = false;
+  }
+
+  // OS X's realloc does not free memory if the new block is smaller.  This
+  // is a very serious problem and causes huge amount of memory to be
+  // wasted. Do not use realloc on the Mac.
+  bool dontUseRealloc = false;
+#if defined __APPLE__
+  dontUseRealloc = true;
+#endif
+
+  if(isMallocBlock && wantsMallocBlock && !dontUseRealloc)
+  {
+    // Try to reallocate with minimal memory usage and possibly avoid copying.
+    void* newPtr = realloc(ptr, numBytes);
+    if(nullptr == newPtr)
+    {
+      // Out of heap. The general path below may still be able to use a scratch file.
+      if(m_FileBacked != FileBackedMode::OnAllocationFailure)
+      {
+        return nullptr;
+      }
+    }
+    else
+    {
+      if(isKnown)
+      {
+        GetBlockTable().take(ptr, record);
+        record.counters->remove(record.numBytes, false);
+        GetGlobalCounters().remove(record.numBytes, false);
+      }
+      BlockRecord newRecord;
+      newRecord.kind = BlockKind::Malloc;
+      newRecord.numBytes = numBytes;
+      newRecord.counters = m_Counters;
+      GetBlockTable().insert(newPtr, newRecord);
+      m_Counters->add(numBytes, false);
+      GetGlobalCounters().add(numBytes, false);
+      return newPtr;
+    }
+  }
+
+  void* newPtr = allocate(numBytes);
+  if(nullptr == newPtr)
+  {
+    return nullptr;
+  }
+  std::memcpy(newPtr, ptr, std::min(oldNumBytes, numBytes));
+  deallocate(ptr);
+  return newPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::deallocate(void* ptr)
+{
+  if(nullptr == ptr)
+  {
+    return;
+  }
+  BlockRecord record;
+  if(!GetBlockTable().take(ptr, record))
+  {
+    // Not one of ours. By contract this memory came from malloc()
+    free(ptr);
+    return;
+  }
+  bool fileBacked = (record.kind == BlockKind::FileMapped);
+  ReleaseBlock(ptr, record);
+  record.counters->remove(record.numBytes, fileBacked);
+  GetGlobalCounters().remove(record.numBytes, fileBacked);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::firstTouch(void* ptr, size_t numBytes) const
+{
+  size_t pageSize = GetPageSize();
+  size_t numPages = (numBytes + pageSize - 1) / pageSize;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPages);
+  dataAlg.execute(FirstTouchImpl(static_cast<char*>(ptr), numBytes, pageSize));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Statistics DataArrayAllocator::getStatistics() const
+{
+  Statistics stats;
+  stats.bytesLive = m_Counters->bytesLive.load();
+  stats.bytesFileBacked = m_Counters->bytesFileBacked.load();
+  stats.bytesPeak = m_Counters->bytesPeak.load();
+  stats.bytesAllocated = m_Counters->bytesAllocated.load();
+  stats.numAllocations = m_Counters->numAllocations.load();
+  stats.numLiveBlocks = m_Counters->numLiveBlocks.load();
+  return stats;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::resetPeak()
+{
+  m_Counters->bytesPeak.store(m_Counters->bytesLive.load());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataArrayAllocator::getAlignment() const
+{
+  return m_Alignment;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::HugePageMode DataArrayAllocator::getHugePageMode() const
+{
+  return m_HugePages;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataArrayAllocator::getParallelFirstTouch() const
+{
+  return m_ParallelFirstTouch;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::setFileBacking(const QString& scratchDirectory, FileBackedMode mode, size_t thresholdBytes)
+{
+  m_ScratchDirectory = scratchDirectory;
+  m_FileBacked = mode;
+  m_FileBackedThreshold = thresholdBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DataArrayAllocator::getScratchDirectory() const
+{
+  return m_ScratchDirectory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::FileBackedMode DataArrayAllocator::getFileBackedMode() const
+{
+  return m_FileBacked;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataArrayAllocator::getFileBackedThreshold() const
+{
+  return m_FileBackedThreshold;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DataArrayAllocator::getInfoString() const
+{
+  QLocale usa(QLocale::English, QLocale::UnitedStates);
+  Statistics stats = getStatistics();
+
+  QString info;
+  QTextStream ss(&info);
+  ss << "Alignment: " << (m_Alignment == 0 ? QString("Default") : QString::number(m_Alignment)) << "\n";
+  ss << "Huge Pages: ";
+  switch(m_HugePages)
+  {
+  case HugePageMode::Disabled:
+    ss << "Disabled\n";
+    break;
+  case HugePageMode::Transparent:
+    ss << "Transparent\n";
+    break;
+  case HugePageMode::Explicit:
+    ss << "Explicit\n";
+    break;
+  }
+  ss << "Parallel First Touch: " << (m_ParallelFirstTouch ? "On" : "Off") << "\n";
+  if(m_FileBacked != FileBackedMode::Never)
+  {
+    ss << "Scratch Directory: " << m_ScratchDirectory << "\n";
+    ss << "File Backed: " << (m_FileBacked == FileBackedMode::Always ? "Always" : "On Allocation Failure") << "\n";
+  }
+  ss << "Bytes Live: " << usa.toString(static_cast<qulonglong>(stats.bytesLive)) << "\n";
+  ss << "Bytes File Backed: " << usa.toString(static_cast<qulonglong>(stats.bytesFileBacked)) << "\n";
+  ss << "Bytes Peak: " << usa.toString(static_cast<qulonglong>(stats.bytesPeak)) << "\n";
+  ss << "Bytes Allocated: " << usa.toString(static_cast<qulonglong>(stats.bytesAllocated)) << "\n";
+  ss << "Allocations: " << usa.toString(static_cast<qulonglong>(stats.numAllocations)) << "\n";
+  ss << "Live Blocks: " << usa.toString(static_cast<qulonglong>(stats.numLiveBlocks)) << "\n";
+  return info;
+}
@@ -0,0 +1,260 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @class DataArrayAllocator DataArrayAllocator.h SIMPLib/DataArrays/DataArrayAllocator.h
+ * @brief The DataArrayAllocator class is the memory backend that DataArray<T> uses for its
+ * storage. An allocator can hand out memory with a given alignment, back large blocks with
+ * transparent or explicit huge pages and fault in the pages of large blocks from several
+ * threads so that they are distributed across NUMA nodes (first-touch placement).
+ *
+ * Large blocks can also be backed by a memory mapped scratch file instead of anonymous memory,
+ * either always or only when the heap allocation fails. The operating system then pages the
+ * data in and out of the file as needed, which lets arrays grow beyond the physical memory of
+ * the machine. The scratch files are removed as soon as they are created, so nothing is left
+ * behind if the process dies.
+ *
+ * All memory handed out by any allocator is recorded in a process wide table so that a block
+ * can be released or reallocated by a different allocator than the one that created it. This
+ * keeps ownership transfers between arrays (WrapPointer, readH5Data) safe. Memory that was not
+ * created by an allocator is assumed to come from malloc() and is released with free().
+ *
+ * A process wide default allocator is used by every DataArray that was not given one explicitly.
+ * The default allocator uses the natural alignment of malloc() and no huge pages, which matches
+ * the historical behavior of DataArray. If the SIMPL_SCRATCH_DIRECTORY environment variable is set
+ * the default allocator falls back to scratch files in that directory when the heap is exhausted.
+ */
+class SIMPLib_EXPORT DataArrayAllocator
+{
+public:
+  SIMPL_SHARED_POINTERS(DataArrayAllocator)
+
+  /**
+   * @brief How large blocks should be backed by huge pages.
+   * Disabled: Regular pages.
+   * Transparent: Blocks are aligned to the huge page size and the kernel is advised to use
+   * transparent huge pages (Linux only, ignored elsewhere).
+   * Explicit: Blocks are mapped from the preallocated huge page pool (MAP_HUGETLB on Linux). If the
+   * pool is exhausted the allocator falls back to transparent huge pages.
+   */
+  enum class HugePageMode : unsigned int
+  {
+    Disabled = 0,
+    Transparent = 1,
+    Explicit = 2
+  };
+
+  /**
+   * @brief When large blocks should be backed by a memory mapped scratch file.
+   * Never: Blocks always live on the heap.
+   * Always: Blocks at or above the threshold are always backed by a scratch file.
+   * OnAllocationFailure: Blocks at or above the threshold are backed by a scratch file
+   * only if they could not be allocated on the heap.
+   */
+  enum class FileBackedMode : unsigned int
+  {
+    Never = 0,
+    Always = 1,
+    OnAllocationFailure = 2
+  };
+
+  /**
+   * @brief Snapshot of the bytes that were allocated through an allocator. bytesAllocated
+   * and numAllocations are running totals that never go down.
+   */
+  struct Statistics
+  {
+    size_t bytesLive = 0;
+    size_t bytesFileBacked = 0;
+    size_t bytesPeak = 0;
+    size_t bytesAllocated = 0;
+    size_t numAllocations = 0;
+    size_t numLiveBlocks = 0;
+  };
+
+  static const size_t k_DefaultAlignment = 0;
+  static const size_t k_CacheLineAlignment = 64;
+  static const size_t k_HugePageSize = 2 * 1024 * 1024;
+
+  /**
+   * @brief Creates a new allocator
+   * @param alignment The alignment in bytes of every block. Zero uses the natural alignment of malloc().
+   * Must be zero or a power of two.
+   * @param hugePages Whether large blocks should be backed by huge pages
+   * @param parallelFirstTouch Whether the pages of large blocks should be faulted in from several threads
+   * @return
+   */
+  static Pointer New(size_t alignment = k_DefaultAlignment, HugePageMode hugePages = HugePageMode::Disabled, bool parallelFirstTouch = false);
+
+  /**
+   * @brief Creates a new allocator that backs large blocks with memory mapped scratch files
+   * @param scratchDirectory The directory that the scratch files are created in
+   * @param mode When blocks should be backed by a scratch file
+   * @param thresholdBytes Blocks smaller than this always live on the heap
+   * @return
+   */
+  static Pointer NewFileBacked(const QString& scratchDirectory, FileBackedMode mode = FileBackedMode::Always, size_t thresholdBytes = k_HugePageSize);
+
+  virtual ~DataArrayAllocator();
+
+  /**
+   * @brief Returns the allocator that new DataArrays use
+   * @return
+   */
+  static Pointer GetDefault();
+
+  /**
+   * @brief Sets the allocator that new DataArrays use. Passing a null pointer restores the
+   * built in malloc() compatible allocator. Existing arrays keep their allocator.
+   * @param allocator
+   */
+  static void SetDefault(const Pointer& allocator);
+
+  /**
+   * @brief Returns the combined statistics of all allocators in the process.
+   * @return
+   */
+  static Statistics GetGlobalStatistics();
+
+  /**
+   * @brief Allocates a block of at least numBytes bytes.
+   * @param numBytes
+   * @return Pointer to the block or nullptr if the memory could not be allocated
+   */
+  virtual void* allocate(size_t numBytes);
+
+  /**
+   * @brief Resizes a block, keeping the first min(oldNumBytes, numBytes) bytes. The block may
+   * have been created by any allocator or by malloc(). On failure the old block is left untouched.
+   * @param ptr
+   * @param oldNumBytes The number of bytes of the old block that must be preserved
+   * @param numBytes
+   * @return Pointer to the resized block or nullptr if the memory could not be allocated
+   */
+  virtual void* reallocate(void* ptr, size_t oldNumBytes, size_t numBytes);
+
+  /**
+   * @brief Releases a block. The block may have been created by any allocator or by malloc().
+   * @param ptr
+   */
+  virtual void deallocate(void* ptr);
+
+  /**
+   * @brief Returns the statistics of the blocks created by this allocator.
+   * @return
+   */
+  Statistics getStatistics() const;
+
+  /**
+   * @brief Sets the peak statistic back to the bytes that are currently live.
+   */
+  void resetPeak();
+
+  size_t getAlignment() const;
+  HugePageMode getHugePageMode() const;
+  bool getParallelFirstTouch() const;
+
+  /**
+   * @brief Sets up scratch file backing for large blocks. This should be done before the
+   * allocator is handed to any DataArray.
+   * @param scratchDirectory The directory that the scratch files are created in
+   * @param mode When blocks should be backed by a scratch file
+   * @param thresholdBytes Blocks smaller than this always live on the heap
+   */
+  void setFileBacking(const QString& scratchDirectory, FileBackedMode mode, size_t thresholdBytes = k_HugePageSize);
+
+  QString getScratchDirectory() const;
+  FileBackedMode getFileBackedMode() const;
+  size_t getFileBackedThreshold() const;
+
+  /**
+   * @brief Returns a human readable description of the allocator and its statistics
+   * @return
+   */
+  QString getInfoString() const;
+
+  /**
+   * @brief The counters that the blocks of an allocator are accounted against. They are shared
+   * with the allocation table so that blocks can outlive the allocator that created them.
+   */
+  struct Counters
+  {
+    std::atomic<size_t> bytesLive;
+    std::atomic<size_t> bytesFileBacked;
+    std::atomic<size_t> bytesPeak;
+    std::atomic<size_t> bytesAllocated;
+    std::atomic<size_t> numAllocations;
+    std::atomic<size_t> numLiveBlocks;
+
+    Counters();
+    void add(size_t numBytes, bool fileBacked);
+    void remove(size_t numBytes, bool fileBacked);
+  };
+
+protected:
+  DataArrayAllocator(size_t alignment, HugePageMode hugePages, bool parallelFirstTouch);
+
+  /**
+   * @brief Faults in every page of the block from several threads.
+   * @param ptr
+   * @param numBytes
+   */
+  void firstTouch(void* ptr, size_t numBytes) const;
+
+private:
+  size_t m_Alignment = k_DefaultAlignment;
+  HugePageMode m_HugePages = HugePageMode::Disabled;
+  bool m_ParallelFirstTouch = false;
+  QString m_ScratchDirectory;
+  FileBackedMode m_FileBacked = FileBackedMode::Never;
+  size_t m_FileBackedThreshold = k_HugePageSize;
+  std::shared_ptr<Counters> m_Counters;
+
+public:
+  DataArrayAllocator(const DataArrayAllocator&) = delete;            // Copy Constructor Not Implemented
+  DataArrayAllocator(DataArrayAllocator&&) = delete;                 // Move Constructor Not Implemented
+  DataArrayAllocator& operator=(const DataArrayAllocator&) = delete; // Copy Assignment Not Implemented
+  DataArrayAllocator& operator=(DataArrayAllocator&&) = delete;      // Move Assignment Not Implemented
+};
@@ -35,8 +35,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <vector>
 
+#include <QtCore/QVector>
+
 //-- DREAM3D Includes
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/SIMPLib.h"
@@ -44,6 +49,11 @@
 /**
  * @brief The MeshFaceNeighbors class contains arrays of Faces for each Node in the mesh. This allows quick query to the node
  * to determine what Cells the node is a part of.
+ *
+ * All lists share a single contiguous payload buffer that is laid out in compressed sparse row order when the lists
+ * are allocated in bulk through allocateLists(), setLists() or deserializeLinks(). Each ElementList points into that
+ * buffer so there is exactly one allocation for the list headers and one for the payload regardless of the number of
+ * lists. A list that is grown through setElementList() is moved to the end of the payload.
  */
 template <typename T, typename K> class DynamicListArray
 {
@@ -62,22 +72,7 @@ public:
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
-  virtual ~DynamicListArray()
-  {
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
-    {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
-    }
-    // Now delete all the "NeighborLists" structures
-    if(this->m_Array != nullptr)
-    {
-      delete[] this->m_Array;
-    }
-  }
+  virtual ~DynamicListArray() = default;
 
   /**
    * @brief size
@@ -85,7 +80,21 @@ public:
    */
   size_t size()
   {
-    return m_Size;
+    return m_Array.size();
+  }
+
+  /**
+   * @brief Returns the total number of entries over all lists
+   * @return
+   */
+  size_t getTotalNumberOfElements()
+  {
+    size_t total = 0;
+    for(const ElementList& list : m_Array)
+    {
+      total += static_cast<size_t>(list.ncells);
+    }
+    return total;
   }
 
   /**
@@ -96,26 +105,23 @@ public:
   Pointer deepCopy(bool forceNoAllocate = false)
   {
     DynamicListArray::Pointer copy = DynamicListArray::New();
-    std::vector<T> linkCounts(m_Size, 0);
+    std::vector<T> linkCounts(m_Array.size(), 0);
     if(forceNoAllocate)
     {
       copy->allocateLists(linkCounts);
       return copy;
     }
 
-    // Figure out how many entries, and for each entry, how many cells
-    for(size_t ptId = 0; ptId < m_Size; ptId++)
+    // Gather the lists in order so the copy gets a compact payload in one go
+    std::vector<K> elements;
+    elements.reserve(getTotalNumberOfElements());
+    for(size_t ptId = 0; ptId < m_Array.size(); ptId++)
     {
-      linkCounts[ptId] = this->m_Array[ptId].ncells;
-    }
-    // Allocate all that in the copy
-    copy->allocateLists(linkCounts);
-    // Copy the data from the original to the new
-    for(size_t ptId = 0; ptId < m_Size; ptId++)
-    {
-      ElementList& elementList = getElementList(ptId);
-      copy->setElementList(ptId, elementList);
+      const ElementList& elementList = m_Array[ptId];
+      linkCounts[ptId] = elementList.ncells;
+      elements.insert(elements.end(), elementList.cells, elementList.cells + elementList.ncells);
     }
+    copy->setLists(linkCounts, elements);
     return copy;
   }
 
@@ -141,7 +147,8 @@ public:
   }
 
   /**
-   * @brief setElementList
+   * @brief setElementList Copies nCells entries into the list for ptId. Lists that shrink or keep
+   * their size are overwritten in place, larger lists are appended to the end of the payload.
    * @param ptId
    * @param nCells
    * @param data
@@ -149,19 +156,27 @@ public:
    */
   bool setElementList(size_t ptId, T nCells, K* data)
   {
-    if(ptId >= m_Size)
+    if(ptId >= m_Array.size())
     {
       return false;
     }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
+    ElementList& list = m_Array[ptId];
+    if(nCells > list.ncells)
     {
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
+      // The source may be another list of this array which moves if the payload grows
+      size_t dataOffset = 0;
+      bool inPayload = isInPayload(data, dataOffset);
+      list.cells = appendElements(static_cast<size_t>(nCells));
+      if(inPayload)
+      {
+        data = m_Elements.data() + dataOffset;
+      }
+    }
+    list.ncells = nCells;
+    if(nCells > 0)
+    {
+      ::memcpy(list.cells, data, sizeof(K) * nCells);
     }
-    m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
     return true;
   }
 
@@ -173,22 +188,7 @@ public:
    */
   bool setElementList(size_t ptId, ElementList& list)
   {
-    T nCells = list.ncells;
-    K* data = list.cells;
-    if(ptId >= m_Size)
-    {
-      return false;
-    }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
-    {
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
-    }
-    m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
-    return true;
+    return setElementList(ptId, list.ncells, list.cells);
   }
 
   /**
@@ -212,26 +212,32 @@ public:
   }
 
   /**
-   * @brief deserializeLinks
+   * @brief serializeLinks Flattens all lists into a byte buffer where each list is stored as its
+   * count (sizeof(T) bytes) followed by its entries. This is the layout used in the HDF5 files.
    * @param buffer
-   * @param nElements
+   * @param nElements Number of lists to serialize
    */
-  void deserializeLinks(QVector<uint8_t>& buffer, size_t nElements)
+  void serializeLinks(std::vector<uint8_t>& buffer, size_t nElements)
   {
-    size_t offset = 0;
-    allocate(nElements); // Allocate all the links with 0 and nullptr;
+    if(nElements > m_Array.size())
+    {
+      nElements = m_Array.size();
+    }
+    size_t total = 0;
+    for(size_t i = 0; i < nElements; ++i)
+    {
+      total += static_cast<size_t>(m_Array[i].ncells);
+    }
+    buffer.resize(nElements * sizeof(T) + total * sizeof(K));
     uint8_t* bufPtr = buffer.data();
-
-    // Walk the array and allocate all the array links to Zero and nullptr
-    T* ncells = nullptr;
+    size_t offset = 0;
     for(size_t i = 0; i < nElements; ++i)
     {
-      ncells = reinterpret_cast<T*>(bufPtr + offset);
-      this->m_Array[i].ncells = *ncells; // Set the number of cells in this link
-      offset += 2;
-      this->m_Array[i].cells = new K[(*ncells)];                                // Allocate a new chunk of memory to store the list
-      ::memcpy(this->m_Array[i].cells, bufPtr + offset, (*ncells) * sizeof(K)); // Copy from the buffer into the new list memory
-      offset += (*ncells) * sizeof(K);                                          // Increment the offset
+      const ElementList& list = m_Array[i];
+      ::memcpy(bufPtr + offset, &(list.ncells), sizeof(T));
+      offset += sizeof(T);
+      ::memcpy(bufPtr + offset, list.cells, list.ncells * sizeof(K));
+      offset += list.ncells * sizeof(K);
     }
   }
 
@@ -239,25 +245,64 @@ public:
    * @brief deserializeLinks
    * @param buffer
    * @param nElements
+   * @return false if the buffer is too small to hold nElements lists
+   */
+  bool deserializeLinks(QVector<uint8_t>& buffer, size_t nElements)
+  {
+    return deserializeLinks(buffer.data(), static_cast<size_t>(buffer.size()), nElements);
+  }
+
+  /**
+   * @brief deserializeLinks
+   * @param buffer
+   * @param nElements
+   * @return false if the buffer is too small to hold nElements lists
+   */
+  bool deserializeLinks(std::vector<uint8_t>& buffer, size_t nElements)
+  {
+    return deserializeLinks(buffer.data(), buffer.size(), nElements);
+  }
+
+  /**
+   * @brief deserializeLinks Rebuilds all lists from the layout written by serializeLinks(). The buffer
+   * is scanned once for the list sizes so that the payload is allocated a single time.
+   * @param buffer
+   * @param bufferSize Size of the buffer in bytes
+   * @param nElements
+   * @return false if the buffer is too small to hold nElements lists
    */
-  void deserializeLinks(std::vector<uint8_t>& buffer, size_t nElements)
+  bool deserializeLinks(const uint8_t* buffer, size_t bufferSize, size_t nElements)
   {
+    std::vector<T> linkCounts(nElements, 0);
     size_t offset = 0;
-    allocate(nElements); // Allocate all the links with 0 and nullptr;
-    uint8_t* bufPtr = &(buffer.front());
+    for(size_t i = 0; i < nElements; ++i)
+    {
+      if(offset + sizeof(T) > bufferSize)
+      {
+        allocate(0);
+        return false;
+      }
+      ::memcpy(&(linkCounts[i]), buffer + offset, sizeof(T));
+      offset += sizeof(T);
+      // A negative count turns into a huge value here and fails the check as well
+      size_t count = static_cast<size_t>(linkCounts[i]);
+      if(count > (bufferSize - offset) / sizeof(K))
+      {
+        allocate(0);
+        return false;
+      }
+      offset += count * sizeof(K);
+    }
 
-    // Walk the array and allocate all the array links to Zero and nullptr
-    T* ncells = nullptr;
-    // int32_t* cells = nullptr;
+    allocateLists(linkCounts);
+    offset = 0;
     for(size_t i = 0; i < nElements; ++i)
     {
-      ncells = reinterpret_cast<T*>(bufPtr + offset);
-      this->m_Array[i].ncells = *ncells; // Set the number of cells in this link
-      offset += 2;
-      this->m_Array[i].cells = new K[(*ncells)];                                // Allocate a new chunk of memory to store the list
-      ::memcpy(this->m_Array[i].cells, bufPtr + offset, (*ncells) * sizeof(K)); // Copy from the buffer into the new list memory
-      offset += (*ncells) * sizeof(K);                                          // Increment the offset
+      offset += sizeof(T);
+      ::memcpy(m_Array[i].cells, buffer + offset, linkCounts[i] * sizeof(K));
+      offset += linkCounts[i] * sizeof(K);
     }
+    return true;
   }
 
   /**
@@ -266,26 +311,69 @@ public:
    */
   void allocateLists(QVector<T>& linkCounts)
   {
-    allocate(linkCounts.size());
-    for(typename std::vector<T>::size_type i = 0; i < linkCounts.size(); i++)
+    allocateLists(linkCounts.data(), static_cast<size_t>(linkCounts.size()));
+  }
+
+  /**
+   * @brief allocateLists
+   * @param linkCounts
+   */
+  void allocateLists(std::vector<T>& linkCounts)
+  {
+    allocateLists(linkCounts.data(), linkCounts.size());
+  }
+
+  /**
+   * @brief allocateLists Sizes each list i to hold linkCounts[i] entries. The entries are not initialized.
+   * @param linkCounts
+   * @param numLists
+   */
+  void allocateLists(const T* linkCounts, size_t numLists)
+  {
+    size_t total = 0;
+    for(size_t i = 0; i < numLists; i++)
+    {
+      total += static_cast<size_t>(linkCounts[i]);
+    }
+    allocate(numLists);
+    m_Elements.resize(total);
+    K* cells = m_Elements.data();
+    for(size_t i = 0; i < numLists; i++)
     {
       this->m_Array[i].ncells = linkCounts[i];
-      this->m_Array[i].cells = new K[this->m_Array[i].ncells];
+      this->m_Array[i].cells = cells;
+      cells += linkCounts[i];
     }
   }
 
   /**
-   * @brief allocateLists
+   * @brief setLists Replaces all lists in one go. The elements are the concatenation of all lists in order
+   * and become the payload of this array without being copied.
    * @param linkCounts
+   * @param elements
+   * @return false if the total of linkCounts does not match the number of elements
    */
-  void allocateLists(std::vector<T>& linkCounts)
+  bool setLists(const std::vector<T>& linkCounts, std::vector<K>& elements)
   {
+    size_t total = 0;
+    for(T count : linkCounts)
+    {
+      total += static_cast<size_t>(count);
+    }
+    if(total != elements.size())
+    {
+      return false;
+    }
     allocate(linkCounts.size());
-    for(typename std::vector<T>::size_type i = 0; i < linkCounts.size(); i++)
+    m_Elements.swap(elements);
+    K* cells = m_Elements.data();
+    for(size_t i = 0; i < linkCounts.size(); i++)
     {
       this->m_Array[i].ncells = linkCounts[i];
-      this->m_Array[i].cells = new K[this->m_Array[i].ncells];
+      this->m_Array[i].cells = cells;
+      cells += linkCounts[i];
     }
+    return true;
   }
 
 protected:
@@ -298,37 +386,61 @@ protected:
   {
     static typename DynamicListArray<T, K>::ElementList linkInit = {0, nullptr};
 
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
+    // Release the payload of the previous lists
+    std::vector<K>().swap(m_Elements);
+
+    // Initialize each structure to have 0 entries and nullptr pointer.
+    m_Array.assign(sz, linkInit);
+  }
+
+  //----------------------------------------------------------------------------
+  // Reserves count entries at the end of the payload and returns a pointer to them. If the
+  // payload has to grow, every list is re-pointed into the new buffer.
+  K* appendElements(size_t count)
+  {
+    size_t start = m_Elements.size();
+    if(start + count > m_Elements.capacity())
     {
-      if(this->m_Array[i].cells != nullptr)
+      std::vector<size_t> offsets(m_Array.size(), 0);
+      std::vector<bool> rebase(m_Array.size(), false);
+      for(size_t i = 0; i < m_Array.size(); i++)
       {
-        delete[] this->m_Array[i].cells;
+        rebase[i] = isInPayload(m_Array[i].cells, offsets[i]);
+      }
+      m_Elements.reserve(std::max(start + count, 2 * m_Elements.capacity()));
+      K* newData = m_Elements.data();
+      for(size_t i = 0; i < m_Array.size(); i++)
+      {
+        if(rebase[i])
+        {
+          m_Array[i].cells = newData + offsets[i];
+        }
       }
     }
-    // Now delete all the "NeighborLists" structures
-    if(this->m_Array != nullptr)
-    {
-      delete[] this->m_Array;
-    }
-
-    this->m_Size = sz;
-    // Allocate a whole new set of structures
-    this->m_Array = new typename DynamicListArray<T, K>::ElementList[sz];
+    m_Elements.resize(start + count);
+    return m_Elements.data() + start;
+  }
 
-    // Initialize each structure to have 0 entries and nullptr pointer.
-    for(size_t i = 0; i < sz; i++)
+  //----------------------------------------------------------------------------
+  // Returns true if ptr points into (or one past the end of) the payload and sets its offset
+  bool isInPayload(const K* ptr, size_t& offset) const
+  {
+    const K* begin = m_Elements.data();
+    const K* end = begin + m_Elements.size();
+    std::less_equal<const K*> lessEqual;
+    if(ptr == nullptr || begin == nullptr || !lessEqual(begin, ptr) || !lessEqual(ptr, end))
     {
-      this->m_Array[i] = linkInit;
+      return false;
     }
+    offset = static_cast<size_t>(ptr - begin);
+    return true;
   }
 
 private:
-  ElementList* m_Array = nullptr; // pointer to data
-  size_t m_Size = 0;
+  std::vector<ElementList> m_Array; // one entry per list
+  std::vector<K> m_Elements;        // payload of all lists
 };
 
 typedef DynamicListArray<int32_t, int32_t> Int32Int32DynamicListArray;
 typedef DynamicListArray<uint16_t, int64_t> UInt16Int64DynamicListArray;
 typedef DynamicListArray<int64_t, int64_t> Int64Int64DynamicListArray;
-
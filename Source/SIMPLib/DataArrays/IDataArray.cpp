@@ -11,6 +11,8 @@
 
 #include "IDataArray.h"
 
+#include <cstdint>
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -31,6 +33,39 @@ bool IDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourc
   return copyFromArray(destTupleOffset, sourceArray, 0, sourceArray->getNumberOfTuples());
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::mutex& IDataArray::GetCopyOnWriteMutex(const IDataArray* array)
+{
+  static std::mutex mutexes[64];
+  return mutexes[(reinterpret_cast<uintptr_t>(array) / sizeof(void*)) % 64];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::isShared()
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t IDataArray::getSharedByteCount()
+{
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t IDataArray::getUniqueByteCount()
+{
+  return isAllocated() ? getSize() * getTypeSize() : 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 
 
 //-- C++
+#include <mutex>
 #include <vector>
 
 #include <hdf5.h>
@@ -254,6 +255,25 @@ class SIMPLib_EXPORT IDataArray : public IDataStructureNode
      */
     virtual IDataArray::Pointer deepCopy(bool forceNoAllocate = false) = 0;
 
+    /**
+     * @brief Returns true if the memory of this array is shared with other arrays, for example
+     * with a copy that was created by deepCopy() and has not been modified yet.
+     * @return
+     */
+    virtual bool isShared();
+
+    /**
+     * @brief Returns the number of bytes of this array that are shared with other arrays.
+     * @return
+     */
+    virtual size_t getSharedByteCount();
+
+    /**
+     * @brief Returns the number of bytes of this array that are not shared with any other array.
+     * @return
+     */
+    virtual size_t getUniqueByteCount();
+
     /**
      * @brief writeH5Data
      * @param parentId
@@ -294,6 +314,14 @@ class SIMPLib_EXPORT IDataArray : public IDataStructureNode
     virtual QString getInfoString(SIMPL::InfoStringFormat format) = 0;
 
   protected:
+    /**
+     * @brief Returns the mutex that serializes giving the array its own copy of a buffer it
+     * shares with other arrays. Arrays share a small pool of mutexes, which is enough since
+     * the mutex is only taken on the first write after a deepCopy().
+     * @param array
+     * @return
+     */
+    static std::mutex& GetCopyOnWriteMutex(const IDataArray* array);
 
   private:
     IDataArray (const IDataArray&);    //Not Implemented
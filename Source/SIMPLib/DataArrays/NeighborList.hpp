@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include <QtCore/QString>
@@ -56,6 +57,14 @@
 /**
  * @class NeighborList NeighborList.hpp DREAM3DLib/Common/NeighborList.hpp
  * @brief Template class for wrapping raw arrays of data.
+ *
+ * The lists are stored in one of two layouts. The packed layout keeps all values in a single
+ * contiguous array together with an offsets array (compressed sparse row) so that list i is the
+ * range [offsets[i], offsets[i+1]) of the values array. This is the layout that is produced by the
+ * Builder, by readH5Data() and by appending to the last list with addEntry(). The legacy layout keeps
+ * one heap allocated vector per list and is only created on demand when a caller asks for mutable
+ * access to a single list through getListReference(), operator[], getList() or setList(). Read only
+ * access through getListView() and the const accessors never changes the layout.
  * @author mjackson
  * @date July 3, 2008
  * @version 1.0
@@ -249,6 +258,161 @@ class NeighborList : public IDataArray
     using VectorType = std::vector<T>;
     using SharedVectorType = std::shared_ptr<VectorType>;
 
+    /**
+     * @brief Non owning view of a single list. A view is invalidated by any operation that changes
+     * the storage of the NeighborList such as pack(), readH5Data(), resizing or erasing tuples and,
+     * for views into the packed layout, by any call that switches to the per list layout.
+     */
+    template <typename U> class ListViewType
+    {
+    public:
+      ListViewType() = default;
+      ListViewType(U* data, size_t size)
+      : m_Data(data)
+      , m_Size(size)
+      {
+      }
+      template <typename V>
+      ListViewType(const ListViewType<V>& other)
+      : m_Data(other.data())
+      , m_Size(other.size())
+      {
+      }
+
+      U* data() const
+      {
+        return m_Data;
+      }
+      size_t size() const
+      {
+        return m_Size;
+      }
+      bool empty() const
+      {
+        return m_Size == 0;
+      }
+      U* begin() const
+      {
+        return m_Data;
+      }
+      U* end() const
+      {
+        return m_Data + m_Size;
+      }
+      U& operator[](size_t i) const
+      {
+        Q_ASSERT(i < m_Size);
+        return m_Data[i];
+      }
+      U& at(size_t i) const
+      {
+        Q_ASSERT(i < m_Size);
+        return m_Data[i];
+      }
+
+    private:
+      U* m_Data = nullptr;
+      size_t m_Size = 0;
+    };
+
+    using ListView = ListViewType<T>;
+    using ConstListView = ListViewType<const T>;
+
+    /**
+     * @brief Builder assembles the packed layout of a NeighborList in bulk. Values are appended to the
+     * current list with addValue() and each list is closed with endList(). create() hands the buffers
+     * over to a new NeighborList without copying them.
+     * @code
+     *  NeighborList<int32_t>::Builder builder;
+     *  builder.reserve(numFeatures, numValuesEstimate);
+     *  for(...) { builder.addValue(v); ... builder.endList(); }
+     *  NeighborList<int32_t>::Pointer neighbors = builder.create("Neighbors");
+     * @endcode
+     */
+    class Builder
+    {
+    public:
+      Builder()
+      : m_Offsets(1, 0)
+      {
+      }
+
+      /**
+       * @brief Reserves space for the given number of lists and total number of values
+       * @param numLists
+       * @param numValues
+       */
+      void reserve(size_t numLists, size_t numValues)
+      {
+        m_Offsets.reserve(numLists + 1);
+        m_Values.reserve(numValues);
+      }
+
+      /**
+       * @brief Appends a value to the list that is currently being built
+       * @param value
+       */
+      void addValue(T value)
+      {
+        m_Values.push_back(value);
+      }
+
+      /**
+       * @brief Closes the list that is currently being built. Calling this without adding any values
+       * creates an empty list.
+       */
+      void endList()
+      {
+        m_Offsets.push_back(m_Values.size());
+      }
+
+      /**
+       * @brief Appends a complete list
+       * @param values
+       * @param count
+       */
+      void addList(const T* values, size_t count)
+      {
+        m_Values.insert(m_Values.end(), values, values + count);
+        endList();
+      }
+
+      /**
+       * @brief Returns the number of lists that have been closed so far
+       * @return
+       */
+      size_t getNumberOfLists() const
+      {
+        return m_Offsets.size() - 1;
+      }
+
+      /**
+       * @brief Creates the NeighborList from the accumulated values. A list that is still open is closed
+       * first. The builder is empty afterwards and can be reused.
+       * @param name
+       * @return
+       */
+      Pointer create(const QString& name)
+      {
+        if(m_Offsets.back() != m_Values.size())
+        {
+          endList();
+        }
+        Pointer ptr = NeighborList<T>::CreateArray(getNumberOfLists(), name, false);
+        if(nullptr != ptr.get())
+        {
+          ptr->setPackedStorage(std::move(m_Offsets), std::move(m_Values));
+        }
+        m_Offsets.assign(1, 0);
+        m_Values.clear();
+        return ptr;
+      }
+
+    private:
+      std::vector<size_t> m_Offsets;
+      std::vector<T> m_Values;
+    };
+
     // -----------------------------------------------------------------------------
     ~NeighborList() override = default;
 
@@ -351,7 +515,7 @@ class NeighborList : public IDataArray
         return 0;
       }
 
-      size_t arraySize = m_Array.size();
+      size_t arraySize = getListCount();
       // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
       // off the end of the array and return an error code.
       for(std::vector<size_t>::size_type i = 0; i < idxs.size(); ++i)
@@ -359,7 +523,15 @@ class NeighborList : public IDataArray
         if (idxs[i] >= arraySize) { return -100; }
       }
 
-      std::vector<SharedVectorType> replacement(arraySize - idxsSize);
+      std::vector<SharedVectorType> replacement(m_IsPacked ? 0 : arraySize - idxsSize);
+      std::vector<size_t> offsets;
+      std::vector<T> values;
+      if(m_IsPacked)
+      {
+        offsets.reserve(arraySize - idxsSize + 1);
+        offsets.push_back(0);
+        values.reserve(m_Values.size());
+      }
 
       size_t idxsIndex = 0;
       size_t rIdx = 0;
@@ -367,7 +539,15 @@ class NeighborList : public IDataArray
       {
         if (dIdx != idxs[idxsIndex])
         {
-          replacement[rIdx] = m_Array[dIdx];
+          if(m_IsPacked)
+          {
+            values.insert(values.end(), m_Values.begin() + m_Offsets[dIdx], m_Values.begin() + m_Offsets[dIdx + 1]);
+            offsets.push_back(values.size());
+          }
+          else
+          {
+            replacement[rIdx] = m_Array[dIdx];
+          }
           ++rIdx;
         }
         else
@@ -376,8 +556,16 @@ class NeighborList : public IDataArray
           if (idxsIndex == idxsSize ) { idxsIndex--;}
         }
       }
-      m_Array = replacement;
-      m_NumTuples = m_Array.size();
+      if(m_IsPacked)
+      {
+        m_Offsets.swap(offsets);
+        m_Values.swap(values);
+      }
+      else
+      {
+        m_Array = replacement;
+      }
+      m_NumTuples = getListCount();
       return err;
     }
 
@@ -389,6 +577,7 @@ class NeighborList : public IDataArray
      */
     int copyTuple(size_t currentPos, size_t newPos) override
     {
+      unpack();
       m_Array[newPos] = m_Array[currentPos];
       return 0;
     }
@@ -419,9 +608,10 @@ class NeighborList : public IDataArray
     bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override
     {
       if(!m_IsAllocated) { return false; }
-      if(destTupleOffset >= m_Array.size() ) { return false; }
+      if(destTupleOffset >= getListCount() ) { return false; }
       if(!sourceArray->isAllocated()) { return false; }
       Self* source = dynamic_cast<Self*>(sourceArray.get());
+      if(nullptr == source) { return false; }
 
       if(sourceArray->getNumberOfComponents() != getNumberOfComponents())
       {
@@ -433,14 +623,24 @@ class NeighborList : public IDataArray
         return false;
       }
 
-      if(totalSrcTuples * sourceArray->getNumberOfComponents() + destTupleOffset * getNumberOfComponents() > m_Array.size())
+      if(totalSrcTuples * sourceArray->getNumberOfComponents() + destTupleOffset * getNumberOfComponents() > getListCount())
       {
         return false;
       }
 
-      for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
+      unpack();
+      for(size_t i = 0; i < totalSrcTuples; i++)
       {
-        m_Array[destTupleOffset + i] = source->getList(i);
+        size_t srcIdx = srcTupleOffset + i;
+        if(source->m_IsPacked)
+        {
+          ConstListView srcList = source->getListView(srcIdx);
+          m_Array[destTupleOffset + i] = SharedVectorType(new VectorType(srcList.begin(), srcList.end()));
+        }
+        else
+        {
+          m_Array[destTupleOffset + i] = source->m_Array[srcIdx];
+        }
       }
       return true;
 
@@ -492,6 +692,10 @@ class NeighborList : public IDataArray
      */
     size_t getSize() override
     {
+      if(m_IsPacked)
+      {
+        return m_Values.size();
+      }
       size_t total = 0;
       for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
       {
@@ -544,10 +748,23 @@ class NeighborList : public IDataArray
      * @brief initializeWithZeros
      */
     void initializeWithZeros() override {
-      m_Array.clear();
+      releaseStorage();
       m_IsAllocated = false;
     }
 
+    /**
+     * @brief getUniqueByteCount
+     * @return
+     */
+    size_t getUniqueByteCount() override
+    {
+      if(m_IsPacked)
+      {
+        return m_Offsets.size() * sizeof(size_t) + m_Values.size() * sizeof(T);
+      }
+      return m_Array.size() * (sizeof(SharedVectorType) + sizeof(VectorType)) + getSize() * sizeof(T);
+    }
+
     /**
      * @brief deepCopy
      * @return
@@ -562,7 +779,11 @@ class NeighborList : public IDataArray
 
       typename NeighborList<T>::Pointer daCopyPtr = NeighborList<T>::CreateArray(getNumberOfTuples(), getName(), allocate);
 
-      if(m_IsAllocated && !forceNoAllocate)
+      if(m_IsAllocated && !forceNoAllocate && m_IsPacked)
+      {
+        daCopyPtr->setPackedStorage(m_Offsets, m_Values);
+      }
+      else if(m_IsAllocated && !forceNoAllocate)
       {
         size_t count = (m_IsAllocated ? getNumberOfTuples(): 0);
         for(size_t i = 0; i < count; i++)
@@ -582,11 +803,18 @@ class NeighborList : public IDataArray
     int32_t resizeTotalElements(size_t size) override
     {
       //std::cout << "NeighborList::resizeTotalElements(" << size << ")" << std::endl;
-      size_t old = m_Array.size();
-      m_Array.resize(size);
       m_NumTuples = size;
       if (size == 0) { m_IsAllocated = false; }
       else { m_IsAllocated = true; }
+      if(m_IsPacked)
+      {
+        // New lists are empty so they all start where the last current list ends
+        m_Offsets.resize(size + 1, m_Offsets.back());
+        m_Values.resize(m_Offsets.back());
+        return 1;
+      }
+      size_t old = m_Array.size();
+      m_Array.resize(size);
       // Initialize with zero length Vectors
       for (size_t i = old; i < m_Array.size(); ++i)
       {
@@ -607,13 +835,12 @@ class NeighborList : public IDataArray
     //FIXME: These need to be implemented
     void printTuple(QTextStream& out, size_t i, char delimiter = ',') override
     {
-      SharedVectorType sharedVec = m_Array[i];
-      VectorType* vec = sharedVec.get();
-      size_t size = vec->size();
+      ConstListView list = getListView(i);
+      size_t size = list.size();
       out << size;
       for(size_t j = 0; j < size; j++)
       {
-        out << delimiter << vec->at(j);
+        out << delimiter << list[j];
       }
     }
 
@@ -646,13 +873,15 @@ class NeighborList : public IDataArray
       {
         m_NumNeighborsArrayName = getName() + "_NumNeighbors";
       }
-      Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(m_Array.size(), m_NumNeighborsArrayName, true);
+      const size_t numLists = getListCount();
+      Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(numLists, m_NumNeighborsArrayName, true);
       int32_t* numNeighbors = numNeighborsPtr->getPointer(0);
       size_t total = 0;
-      for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+      for(size_t dIdx = 0; dIdx < numLists; ++dIdx)
       {
-        numNeighbors[dIdx] = static_cast<int32_t>(m_Array[dIdx]->size());
-        total += m_Array[dIdx]->size();
+        size_t nEle = getListView(dIdx).size();
+        numNeighbors[dIdx] = static_cast<int32_t>(nEle);
+        total += nEle;
       }
 
       // Check to see if the NumNeighbors is already written to the file
@@ -666,7 +895,7 @@ class NeighborList : public IDataArray
       {
         // The NumNeighbors array is in the dream3d file so read it up into memory and compare with what
         // we have in memory.
-        std::vector<int32_t> fileNumNeigh(m_Array.size());
+        std::vector<int32_t> fileNumNeigh(numLists);
         err = QH5Lite::readVectorDataset(parentId, m_NumNeighborsArrayName, fileNumNeigh);
         if (err < 0)
         {
@@ -694,24 +923,30 @@ class NeighborList : public IDataArray
         numNeighborsPtr->writeH5Data(parentId, tDims);
       }
 
-      // Allocate an array of the proper size so we can concatenate all the arrays together into a single array that
-      // can be written to the HDF5 File. This operation can ballon the memory size temporarily until this operation
+      // The packed layout already is the flattened array that goes into the file. Otherwise allocate an array
+      // of the proper size so we can concatenate all the arrays together into a single array that can be
+      // written to the HDF5 File. This operation can ballon the memory size temporarily until this operation
       // is complete.
-      QVector<T> flat (total);
-      size_t currentStart = 0;
-      for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+      std::vector<T> flat;
+      T* flatPtr = m_Values.data();
+      if(!m_IsPacked)
       {
-        size_t nEle = m_Array[dIdx]->size();
-        if(nEle == 0)
+        flat.resize(total);
+        size_t currentStart = 0;
+        for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
         {
-          continue;
-        }
-        T* start = m_Array[dIdx]->data(); // get the pointer to the front of the array
-        //    T* end = start + nEle; // get the pointer to the end of the array
-        T* dst = flat.data() + currentStart;
-        ::memcpy(dst, start, nEle * sizeof(T));
+          size_t nEle = m_Array[dIdx]->size();
+          if(nEle == 0)
+          {
+            continue;
+          }
+          T* start = m_Array[dIdx]->data(); // get the pointer to the front of the array
+          T* dst = flat.data() + currentStart;
+          ::memcpy(dst, start, nEle * sizeof(T));
 
-        currentStart += m_Array[dIdx]->size();
+          currentStart += m_Array[dIdx]->size();
+        }
+        flatPtr = flat.data();
       }
 
       // Now we can actually write the actual array data.
@@ -719,7 +954,7 @@ class NeighborList : public IDataArray
       hsize_t dims[1] = { total };
       if (total > 0)
       {
-        err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, flat.data());
+        err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, flatPtr);
         if(err < 0)
         {
           return -605;
@@ -830,21 +1065,14 @@ class NeighborList : public IDataArray
     {
       int err = 0;
 
-      std::vector<T> flat;
-      err = QH5Lite::readVectorDataset(parentId, getName(), flat);
-      if(err < 0)
-      {
-        return err;
-      }
-
       // Read the Attribute Off the data set to find the name of the array that holds all the sizes
       err = QH5Lite::readStringAttribute(parentId, getName(), "Linked NumNeighbors Dataset", m_NumNeighborsArrayName);
       if(err < 0)
       {
         return err;
       }
-      // Generate the number of neighbors array and also compute the total number
-      // of elements that would be needed to flatten the array
+      // Read the number of neighbors array first so that the flattened data can be
+      // read in one go into the packed values array.
       std::vector<int32_t> numNeighbors;
 
       // Check to see if the NumNeighbors exists in the file, which it must.
@@ -861,42 +1089,49 @@ class NeighborList : public IDataArray
         return -703;
       }
 
-      // int32_t totalElements = std::accumulate(numNeighbors.begin(), numNeighbors.end(), 0);
-
-      // Loop over all the entries and make new Vectors to hold the incoming data
-      m_Array.resize(numNeighbors.size());
-      m_IsAllocated = true;
-      size_t currentStart = 0;
-      qint32 count = static_cast<qint32>(numNeighbors.size());
-      for(QVector<int32_t>::size_type dIdx = 0; dIdx < count; ++dIdx)
+      std::vector<size_t> offsets(numNeighbors.size() + 1, 0);
+      for(size_t dIdx = 0; dIdx < numNeighbors.size(); ++dIdx)
       {
-        size_t nEle = numNeighbors[dIdx];
-        if(nEle > 0)
-        {
-          m_Array[dIdx] = SharedVectorType(new VectorType(numNeighbors[dIdx]));
-
-          T* dst = m_Array[dIdx]->data(); // get the pointer to the front of the array
-          //    T* end = start + nEle; // get the pointer to the end of the array
-          T* start = flat.data() + currentStart;
-          ::memcpy(dst, start, nEle * sizeof(T));
-          currentStart += nEle;
-        }
-        else
-        {
-          m_Array[dIdx] = SharedVectorType(new VectorType(0));
-        }
+        size_t nEle = (numNeighbors[dIdx] > 0) ? static_cast<size_t>(numNeighbors[dIdx]) : 0;
+        offsets[dIdx + 1] = offsets[dIdx] + nEle;
       }
-      m_NumTuples = m_Array.size(); // Sync up the numTuples property with the size of the internal array
+      std::vector<T> values(offsets.back());
+      err = H5DataArrayReader::ReadDatasetIntoBuffer(parentId, getName(), H5Lite::HDFTypeForPrimitive(static_cast<T>(0)), values.data(), values.size());
+      if(err < 0)
+      {
+        return err;
+      }
+
+      // This also syncs up the numTuples property with the number of lists that were read
+      setPackedStorage(std::move(offsets), std::move(values));
       return err;
     }
 
     /**
-     * @brief addEntry
+     * @brief addEntry Appends a value to the list of the given grain. Appending to the last list (or to a
+     * list past the end) keeps the packed layout, any other grain switches to the per list layout.
      * @param grainId
      * @param value
      */
     void addEntry(int grainId, T value)
     {
+      if(m_IsPacked)
+      {
+        size_t numLists = m_Offsets.size() - 1;
+        if(static_cast<size_t>(grainId) + 1 >= numLists)
+        {
+          if(static_cast<size_t>(grainId) >= numLists)
+          {
+            m_Offsets.resize(grainId + 2, m_Offsets.back());
+          }
+          m_Values.push_back(value);
+          m_Offsets.back()++;
+          m_IsAllocated = true;
+          m_NumTuples = m_Offsets.size() - 1;
+          return;
+        }
+        unpack();
+      }
       if(grainId >= static_cast<int>(m_Array.size()) )
       {
         size_t old = m_Array.size();
@@ -917,7 +1152,7 @@ class NeighborList : public IDataArray
      */
     void clearAllLists()
     {
-      m_Array.clear();
+      releaseStorage();
       m_IsAllocated = false;
     }
 
@@ -929,6 +1164,7 @@ class NeighborList : public IDataArray
      */
     void setList(int grainId, SharedVectorType neighborList)
     {
+      unpack();
       if(grainId >= static_cast<int>(m_Array.size()) )
       {
         size_t old = m_Array.size();
@@ -943,6 +1179,72 @@ class NeighborList : public IDataArray
       m_Array[grainId] = neighborList;
     }
 
+    /**
+     * @brief setPackedStorage Replaces the contents of this NeighborList with the packed layout given
+     * by the offsets and values arrays. List i holds the values [offsets[i], offsets[i+1]).
+     * @param offsets Must start with 0, be non-decreasing and end with values.size()
+     * @param values
+     * @return false if the offsets are not consistent with the values, in which case nothing is changed
+     */
+    bool setPackedStorage(std::vector<size_t> offsets, std::vector<T> values)
+    {
+      if(offsets.empty() || offsets.front() != 0 || offsets.back() != values.size())
+      {
+        return false;
+      }
+      for(size_t i = 1; i < offsets.size(); ++i)
+      {
+        if(offsets[i] < offsets[i - 1])
+        {
+          return false;
+        }
+      }
+      std::vector<SharedVectorType>().swap(m_Array);
+      m_Offsets = std::move(offsets);
+      m_Values = std::move(values);
+      m_IsPacked = true;
+      m_IsAllocated = true;
+      m_NumTuples = m_Offsets.size() - 1;
+      return true;
+    }
+
+    /**
+     * @brief pack Converts the per list layout into the packed layout. References and shared pointers
+     * that were handed out for individual lists are no longer connected to this NeighborList afterwards.
+     */
+    void pack()
+    {
+      if(m_IsPacked)
+      {
+        return;
+      }
+      std::vector<size_t> offsets(m_Array.size() + 1, 0);
+      for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+      {
+        offsets[dIdx + 1] = offsets[dIdx] + m_Array[dIdx]->size();
+      }
+      std::vector<T> values;
+      values.reserve(offsets.back());
+      for(const SharedVectorType& list : m_Array)
+      {
+        values.insert(values.end(), list->begin(), list->end());
+      }
+      bool isAllocated = m_IsAllocated;
+      size_t numTuples = m_NumTuples;
+      setPackedStorage(std::move(offsets), std::move(values));
+      m_IsAllocated = isAllocated;
+      m_NumTuples = numTuples;
+    }
+
+    /**
+     * @brief isPacked
+     * @return true if the lists are stored in the packed (offsets + values) layout
+     */
+    bool isPacked() const
+    {
+      return m_IsPacked;
+    }
+
     /**
      * @brief getValue
      * @param grainId
@@ -953,15 +1255,15 @@ class NeighborList : public IDataArray
     T getValue(int grainId, int index, bool& ok)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+      if (getListCount() > 0u) { Q_ASSERT(grainId < static_cast<int>(getListCount()));}
 #endif
-      SharedVectorType vec = m_Array[grainId];
-      if(index < 0 || static_cast<size_t>(index) >= vec->size())
+      ConstListView list = getListView(grainId);
+      if(index < 0 || static_cast<size_t>(index) >= list.size())
       {
         ok = false;
         return -1;
       }
-      return (*vec)[index];
+      return list[index];
     }
 
     /**
@@ -970,7 +1272,7 @@ class NeighborList : public IDataArray
      */
     int getNumberOfLists()
     {
-      return static_cast<int>(m_Array.size());
+      return static_cast<int>(getListCount());
     }
 
     /**
@@ -981,19 +1283,65 @@ class NeighborList : public IDataArray
     int getListSize(int grainId)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+      if (getListCount() > 0u) { Q_ASSERT(grainId < static_cast<int>(getListCount()));}
 #endif
-      return static_cast<int>(m_Array[grainId]->size());
+      return static_cast<int>(getListView(grainId).size());
     }
 
+    /**
+     * @brief getListView Returns a view of the list that does not change the storage layout. Values
+     * may be modified through the view but the length of the list is fixed.
+     * @param grainId
+     * @return
+     */
+    ListView getListView(size_t grainId)
+    {
+      if(m_IsPacked)
+      {
+        return ListView(m_Values.data() + m_Offsets[grainId], m_Offsets[grainId + 1] - m_Offsets[grainId]);
+      }
+      return ListView(m_Array[grainId]->data(), m_Array[grainId]->size());
+    }
+
+    /**
+     * @brief getListView
+     * @param grainId
+     * @return
+     */
+    ConstListView getListView(size_t grainId) const
+    {
+      if(m_IsPacked)
+      {
+        return ConstListView(m_Values.data() + m_Offsets[grainId], m_Offsets[grainId + 1] - m_Offsets[grainId]);
+      }
+      return ConstListView(m_Array[grainId]->data(), m_Array[grainId]->size());
+    }
+
+    /**
+     * @brief getListReference Returns a resizable reference to the list which requires the per list layout.
+     * Prefer getListView() when the length of the list does not change.
+     * @param grainId
+     * @return
+     */
     VectorType& getListReference(int grainId)
     {
+      unpack();
 #ifndef NDEBUG
       if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
 #endif
       return *(m_Array[grainId]);
     }
 
+    /**
+     * @brief getListReference
+     * @param grainId
+     * @return
+     */
+    ConstListView getListReference(int grainId) const
+    {
+      return getListView(static_cast<size_t>(grainId));
+    }
+
     /**
      * @brief getList
      * @param grainId
@@ -1001,6 +1349,7 @@ class NeighborList : public IDataArray
      */
     SharedVectorType getList(int grainId)
     {
+      unpack();
 #ifndef NDEBUG
       if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
 #endif
@@ -1015,10 +1364,11 @@ class NeighborList : public IDataArray
     VectorType copyOfList(int grainId)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+      if (getListCount() > 0u) { Q_ASSERT(grainId < static_cast<int>(getListCount()));}
 #endif
 
-      VectorType copy(*(m_Array[grainId]));
+      ConstListView list = getListView(grainId);
+      VectorType copy(list.begin(), list.end());
       return copy;
     }
 
@@ -1029,6 +1379,7 @@ class NeighborList : public IDataArray
      */
     VectorType& operator[](int grainId)
     {
+      unpack();
 #ifndef NDEBUG
       if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
 #endif
@@ -1042,6 +1393,7 @@ class NeighborList : public IDataArray
      */
     VectorType& operator[](size_t grainId)
     {
+      unpack();
 #ifndef NDEBUG
       if (m_Array.size() > 0ul) { Q_ASSERT(grainId < m_Array.size());}
 #endif
@@ -1049,6 +1401,26 @@ class NeighborList : public IDataArray
 
     }
 
+    /**
+     * @brief operator []
+     * @param grainId
+     * @return
+     */
+    ConstListView operator[](int grainId) const
+    {
+      return getListView(static_cast<size_t>(grainId));
+    }
+
+    /**
+     * @brief operator []
+     * @param grainId
+     * @return
+     */
+    ConstListView operator[](size_t grainId) const
+    {
+      return getListView(grainId);
+    }
+
 
   protected:
     /**
@@ -1062,8 +1434,51 @@ class NeighborList : public IDataArray
     {
     }
 
+    /**
+     * @brief Returns the number of lists in whichever layout is active
+     * @return
+     */
+    size_t getListCount() const
+    {
+      return m_IsPacked ? m_Offsets.size() - 1 : m_Array.size();
+    }
+
+    /**
+     * @brief Converts the packed layout into one vector per list so that lists can be resized individually
+     */
+    void unpack()
+    {
+      if(!m_IsPacked)
+      {
+        return;
+      }
+      size_t numLists = m_Offsets.size() - 1;
+      m_Array.resize(numLists);
+      for(size_t dIdx = 0; dIdx < numLists; ++dIdx)
+      {
+        m_Array[dIdx] = SharedVectorType(new VectorType(m_Values.begin() + m_Offsets[dIdx], m_Values.begin() + m_Offsets[dIdx + 1]));
+      }
+      std::vector<size_t>().swap(m_Offsets);
+      std::vector<T>().swap(m_Values);
+      m_IsPacked = false;
+    }
+
+    /**
+     * @brief Frees both layouts and leaves an empty packed layout behind
+     */
+    void releaseStorage()
+    {
+      std::vector<SharedVectorType>().swap(m_Array);
+      m_Offsets.assign(1, 0);
+      std::vector<T>().swap(m_Values);
+      m_IsPacked = true;
+    }
+
   private:
     std::vector<SharedVectorType> m_Array;
+    std::vector<size_t> m_Offsets = std::vector<size_t>(1, 0);
+    std::vector<T> m_Values;
+    bool m_IsPacked = true;
     size_t m_NumTuples;
     bool m_IsAllocated;
     T m_InitValue;
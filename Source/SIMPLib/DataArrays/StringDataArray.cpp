@@ -34,9 +34,38 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "StringDataArray.h"
 
+#include <cstring>
+#include <functional>
+
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 
+namespace
+{
+// The arena is only compacted once this many bytes are unreferenced
+const size_t k_MinimumArenaGarbage = 4096;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+void eraseFlagged(std::vector<T>& values, const std::vector<bool>& erase)
+{
+  size_t dest = 0;
+  for(size_t i = 0; i < values.size(); i++)
+  {
+    if(!erase[i])
+    {
+      if(dest != i)
+      {
+        values[dest] = std::move(values[i]);
+      }
+      dest++;
+    }
+  }
+  values.resize(dest);
+}
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -177,7 +206,11 @@ void StringDataArray::releaseOwnership()
 // -----------------------------------------------------------------------------
 void* StringDataArray::getVoidPointer(size_t i)
 {
-  return static_cast<void*>(&(m_Array[i]));
+  if(m_Storage == Storage::Strings)
+  {
+    return static_cast<void*>(&(m_Array[i]));
+  }
+  return static_cast<void*>(const_cast<char*>(getUtf8Value(i)));
 }
 
 // -----------------------------------------------------------------------------
@@ -185,7 +218,15 @@ void* StringDataArray::getVoidPointer(size_t i)
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getNumberOfTuples()
 {
-  return m_Array.size();
+  switch(m_Storage)
+  {
+  case Storage::Arena:
+    return m_Offsets.size();
+  case Storage::Dictionary:
+    return m_Codes.size();
+  default:
+    return m_Array.size();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -193,7 +234,7 @@ size_t StringDataArray::getNumberOfTuples()
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getSize()
 {
-  return m_Array.size();
+  return getNumberOfTuples();
 }
 
 // -----------------------------------------------------------------------------
@@ -236,6 +277,28 @@ size_t StringDataArray::getTypeSize()
   return sizeof(QString);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t StringDataArray::getUniqueByteCount()
+{
+  if(m_Storage == Storage::Strings)
+  {
+    size_t byteCount = m_Array.size() * sizeof(QString);
+    for(const QString& value : m_Array)
+    {
+      byteCount += static_cast<size_t>(value.capacity()) * sizeof(QChar);
+    }
+    return byteCount;
+  }
+  size_t byteCount = m_Arena.size() + m_Offsets.size() * sizeof(size_t) + m_Codes.size() * sizeof(uint32_t);
+  for(const auto& entry : m_Dictionary)
+  {
+    byteCount += entry.first.size() + sizeof(entry);
+  }
+  return byteCount;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -249,8 +312,9 @@ int StringDataArray::eraseTuples(std::vector<size_t>& idxs)
   {
     return 0;
   }
+  size_t numTuples = getNumberOfTuples();
   size_t idxs_size = static_cast<size_t>(idxs.size());
-  if(idxs_size >= getNumberOfTuples())
+  if(idxs_size >= numTuples)
   {
     resizeTuples(0);
     return 0;
@@ -258,35 +322,33 @@ int StringDataArray::eraseTuples(std::vector<size_t>& idxs)
 
   // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
   // off the end of the array and return an error code.
-  // for(std::vector<size_t>::size_type i = 0; i < idxs.size(); ++i)
   for(auto& value : idxs)
   {
-    if(value >= static_cast<size_t>(m_Array.size()))
+    if(value >= numTuples)
     {
       return -100;
     }
   }
 
-  // Create a new Array to copy into
-  std::vector<QString> newArray;
-  std::vector<size_t>::size_type start = 0;
-  for(QVector<QString>::size_type i = 0; i < m_Array.size(); ++i)
+  std::vector<bool> erase(numTuples, false);
+  for(auto& value : idxs)
   {
-    bool keep = true;
-    for(std::vector<size_t>::size_type j = start; j < idxs.size(); ++j)
-    {
-      if(static_cast<size_t>(i) == idxs[j])
-      {
-        keep = false;
-        break;
-      }
-    }
-    if(keep)
-    {
-      newArray.push_back(m_Array[i]);
-    }
+    erase[value] = true;
+  }
+
+  switch(m_Storage)
+  {
+  case Storage::Arena:
+    eraseFlagged(m_Offsets, erase);
+    compactArena();
+    break;
+  case Storage::Dictionary:
+    eraseFlagged(m_Codes, erase);
+    break;
+  default:
+    eraseFlagged(m_Array, erase);
+    break;
   }
-  m_Array = newArray;
   return err;
 }
 
@@ -295,16 +357,40 @@ int StringDataArray::eraseTuples(std::vector<size_t>& idxs)
 // -----------------------------------------------------------------------------
 int StringDataArray::copyTuple(size_t currentPos, size_t newPos)
 {
-  if(currentPos >= m_Array.size())
+  size_t numTuples = getNumberOfTuples();
+  if(currentPos >= numTuples)
   {
     return -1;
   }
-  if(newPos >= m_Array.size())
+  if(newPos >= numTuples)
   {
     return -1;
   }
-  // QString s = m_Array[currentPos];
-  m_Array[newPos] = m_Array[currentPos];
+  switch(m_Storage)
+  {
+  case Storage::Arena:
+  {
+    if(newPos == currentPos)
+    {
+      break;
+    }
+    // Both tuples may share the bytes since values are never modified in place
+    size_t offset = m_Offsets[currentPos];
+    releaseArenaValue(m_Offsets[newPos]);
+    if(offset != 0)
+    {
+      m_SharedOffsets[offset]++;
+    }
+    m_Offsets[newPos] = offset;
+    break;
+  }
+  case Storage::Dictionary:
+    m_Codes[newPos] = m_Codes[currentPos];
+    break;
+  default:
+    m_Array[newPos] = m_Array[currentPos];
+    break;
+  }
   return 0;
 }
 
@@ -313,7 +399,8 @@ int StringDataArray::copyTuple(size_t currentPos, size_t newPos)
 // -----------------------------------------------------------------------------
 bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
 {
-  if(destTupleOffset >= m_Array.size())
+  size_t numTuples = getNumberOfTuples();
+  if(destTupleOffset >= numTuples)
   {
     return false;
   }
@@ -323,19 +410,31 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer
   }
 
   Self* source = dynamic_cast<Self*>(sourceArray.get());
+  if(nullptr == source)
+  {
+    return false;
+  }
 
   if(srcTupleOffset + totalSrcTuples > sourceArray->getNumberOfTuples())
   {
     return false;
   }
-  if(totalSrcTuples + destTupleOffset > m_Array.size())
+  if(totalSrcTuples + destTupleOffset > numTuples)
   {
     return false;
   }
 
-  for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
+  for(size_t i = 0; i < totalSrcTuples; i++)
   {
-    m_Array[destTupleOffset + i] = source->getValue(i);
+    if(source->getStorage() == Storage::Strings)
+    {
+      setValue(destTupleOffset + i, source->getValue(srcTupleOffset + i));
+    }
+    else
+    {
+      const char* value = source->getUtf8Value(srcTupleOffset + i);
+      setUtf8Value(destTupleOffset + i, value, std::strlen(value));
+    }
   }
   return true;
 }
@@ -345,7 +444,7 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeTuple(size_t pos, void* value)
 {
-  m_Array[pos] = *(reinterpret_cast<QString*>(value));
+  setValue(pos, *(reinterpret_cast<QString*>(value)));
 }
 
 // -----------------------------------------------------------------------------
@@ -353,7 +452,7 @@ void StringDataArray::initializeTuple(size_t pos, void* value)
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithZeros()
 {
-  m_Array.assign(m_Array.size(), QString(""));
+  initializeWithValue(QString(""));
 }
 
 // -----------------------------------------------------------------------------
@@ -361,7 +460,31 @@ void StringDataArray::initializeWithZeros()
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithValue(const QString& value)
 {
-  m_Array.assign(m_Array.size(), value);
+  if(m_Storage == Storage::Strings)
+  {
+    m_Array.assign(m_Array.size(), value);
+    return;
+  }
+  size_t numTuples = getNumberOfTuples();
+  resetStorage(numTuples);
+  QByteArray utf8 = value.toUtf8();
+  if(utf8.isEmpty())
+  {
+    return;
+  }
+  if(m_Storage == Storage::Arena)
+  {
+    size_t offset = appendToArena(utf8.constData(), static_cast<size_t>(utf8.size()));
+    m_Offsets.assign(numTuples, offset);
+    if(numTuples > 1)
+    {
+      m_SharedOffsets[offset] = numTuples - 1;
+    }
+  }
+  else
+  {
+    m_Codes.assign(numTuples, findOrAddDictionaryEntry(utf8.constData(), static_cast<size_t>(utf8.size())));
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -369,7 +492,7 @@ void StringDataArray::initializeWithValue(const QString& value)
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithValue(const std::string& value)
 {
-  m_Array.assign(m_Array.size(), QString::fromStdString(value));
+  initializeWithValue(QString::fromStdString(value));
 }
 
 // -----------------------------------------------------------------------------
@@ -378,13 +501,19 @@ void StringDataArray::initializeWithValue(const std::string& value)
 IDataArray::Pointer StringDataArray::deepCopy(bool forceNoAllocate)
 {
   StringDataArray::Pointer daCopy = StringDataArray::CreateArray(getNumberOfTuples(), getName(), true);
-  if(!forceNoAllocate)
+  daCopy->m_Storage = m_Storage;
+  if(forceNoAllocate)
   {
-    for(std::vector<QString>::size_type i = 0; i < m_Array.size(); ++i)
-    {
-      daCopy->setValue(i, m_Array[i]);
-    }
+    daCopy->resetStorage(getNumberOfTuples());
+    return daCopy;
   }
+  daCopy->m_Array = m_Array;
+  daCopy->m_Arena = m_Arena;
+  daCopy->m_Offsets = m_Offsets;
+  daCopy->m_Codes = m_Codes;
+  daCopy->m_Dictionary = m_Dictionary;
+  daCopy->m_ArenaGarbage = m_ArenaGarbage;
+  daCopy->m_SharedOffsets = m_SharedOffsets;
   return daCopy;
 }
 
@@ -393,7 +522,27 @@ IDataArray::Pointer StringDataArray::deepCopy(bool forceNoAllocate)
 // -----------------------------------------------------------------------------
 int32_t StringDataArray::resizeTotalElements(size_t size)
 {
-  m_Array.resize(size);
+  if(size == 0)
+  {
+    resetStorage(0);
+    return 1;
+  }
+  switch(m_Storage)
+  {
+  case Storage::Arena:
+    for(size_t i = size; i < m_Offsets.size(); i++)
+    {
+      releaseArenaValue(m_Offsets[i]);
+    }
+    m_Offsets.resize(size, 0);
+    break;
+  case Storage::Dictionary:
+    m_Codes.resize(size, 0);
+    break;
+  default:
+    m_Array.resize(size);
+    break;
+  }
   return 1;
 }
 
@@ -402,7 +551,7 @@ int32_t StringDataArray::resizeTotalElements(size_t size)
 // -----------------------------------------------------------------------------
 void StringDataArray::resizeTuples(size_t numTuples)
 {
-  m_Array.resize(numTuples);
+  resizeTotalElements(numTuples);
 }
 
 // -----------------------------------------------------------------------------
@@ -410,9 +559,9 @@ void StringDataArray::resizeTuples(size_t numTuples)
 // -----------------------------------------------------------------------------
 void StringDataArray::initialize()
 {
-  if(!m_Array.empty())
+  if(getNumberOfTuples() > 0)
   {
-    m_Array.clear();
+    resetStorage(0);
     this->_ownsData = true;
   }
 }
@@ -422,7 +571,7 @@ void StringDataArray::initialize()
 // -----------------------------------------------------------------------------
 void StringDataArray::printTuple(QTextStream& out, size_t i, char delimiter)
 {
-  out << m_Array[i];
+  out << getValue(i);
 }
 
 // -----------------------------------------------------------------------------
@@ -430,7 +579,7 @@ void StringDataArray::printTuple(QTextStream& out, size_t i, char delimiter)
 // -----------------------------------------------------------------------------
 void StringDataArray::printComponent(QTextStream& out, size_t i, int j)
 {
-  out << m_Array[i];
+  out << getValue(i);
 }
 
 // -----------------------------------------------------------------------------
@@ -446,7 +595,26 @@ QString StringDataArray::getFullNameOfClass()
 // -----------------------------------------------------------------------------
 int StringDataArray::writeH5Data(hid_t parentId, std::vector<size_t> tDims)
 {
-  return H5DataArrayWriter::writeStringDataArray<StringDataArray>(parentId, this);
+  if(m_Storage == Storage::Strings)
+  {
+    return H5DataArrayWriter::writeStringDataArray<StringDataArray>(parentId, this);
+  }
+
+  // Hand HDF5 pointers straight into the arena so the whole array goes out in one write
+  size_t numTuples = getNumberOfTuples();
+  std::vector<const char*> strings(numTuples);
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    strings[i] = getUtf8Value(i);
+  }
+  int err = H5Lite::writeVectorOfCStringsDataset(parentId, getName().toStdString(), strings);
+  if(err < 0)
+  {
+    return err;
+  }
+  std::vector<size_t> arrayTDims(1, numTuples);
+  std::vector<size_t> cDims(1, 1);
+  return H5DataArrayWriter::writeDataArrayAttributes<StringDataArray>(parentId, this, arrayTDims, cDims);
 }
 
 // -----------------------------------------------------------------------------
@@ -492,29 +660,27 @@ QString StringDataArray::getInfoString(SIMPL::InfoStringFormat format)
 // -----------------------------------------------------------------------------
 int StringDataArray::readH5Data(hid_t parentId)
 {
-  int err = 0;
-  this->resizeTuples(0);
-  std::vector<std::string> strings;
-  err = H5Lite::readVectorOfStringDataset(parentId, getName().toStdString(), strings);
-
-  m_Array.resize(strings.size());
-  for(std::vector<QString>::size_type i = 0; i < strings.size(); i++)
+  // Offset 0 of the arena is reserved for the empty string
+  std::vector<char> arena(1, '\0');
+  std::vector<size_t> offsets;
+  int err = H5Lite::readVectorOfStringDataset(parentId, getName().toStdString(), arena, offsets);
+  if(err < 0)
   {
-    m_Array[i] = QString::fromStdString(strings[i]);
+    offsets.clear();
   }
-#if 0
-  IDataArray::Pointer p = H5DataArrayReader::ReadStringDataArray(parentId, getName());
-  if (p.get() == nullptr)
+
+  resetStorage(offsets.size());
+  if(m_Storage == Storage::Arena)
   {
-    return -1;
+    m_Arena.swap(arena);
+    m_Offsets.swap(offsets);
+    return err;
   }
-  StringDataArray::Pointer srcPtr = std::dynamic_pointer_cast<StringDataArray>(p);
-  size_t count = srcPtr->getNumberOfTuples();
-  for (size_t i = 0; i < count; ++i)
+  for(size_t i = 0; i < offsets.size(); i++)
   {
-    m_Array.push_back( srcPtr->getValue(i) );
+    size_t end = (i + 1 < offsets.size()) ? offsets[i + 1] : arena.size();
+    setUtf8Value(i, arena.data() + offsets[i], end - offsets[i] - 1);
   }
-#endif
   return err;
 }
 
@@ -523,7 +689,13 @@ int StringDataArray::readH5Data(hid_t parentId)
 // -----------------------------------------------------------------------------
 void StringDataArray::setValue(size_t i, const QString& value)
 {
-  m_Array[i] = value;
+  if(m_Storage == Storage::Strings)
+  {
+    m_Array[i] = value;
+    return;
+  }
+  QByteArray utf8 = value.toUtf8();
+  setUtf8Value(i, utf8.constData(), static_cast<size_t>(utf8.size()));
 }
 
 // -----------------------------------------------------------------------------
@@ -531,5 +703,275 @@ void StringDataArray::setValue(size_t i, const QString& value)
 // -----------------------------------------------------------------------------
 QString StringDataArray::getValue(size_t i)
 {
-  return m_Array.at(i);
+  switch(m_Storage)
+  {
+  case Storage::Arena:
+    return QString::fromUtf8(m_Arena.data() + m_Offsets.at(i));
+  case Storage::Dictionary:
+    return QString::fromUtf8(m_Arena.data() + m_Offsets[m_Codes.at(i)]);
+  default:
+    return m_Array.at(i);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setUtf8Value(size_t i, const char* value, size_t length)
+{
+  switch(m_Storage)
+  {
+  case Storage::Arena:
+  {
+    size_t newOffset = (length == 0) ? 0 : appendToArena(value, length);
+    releaseArenaValue(m_Offsets[i]);
+    m_Offsets[i] = newOffset;
+    if(m_ArenaGarbage > k_MinimumArenaGarbage && m_ArenaGarbage * 2 > m_Arena.size())
+    {
+      compactArena();
+    }
+    break;
+  }
+  case Storage::Dictionary:
+    m_Codes[i] = findOrAddDictionaryEntry(value, length);
+    break;
+  default:
+    m_Array[i] = QString::fromUtf8(value, static_cast<int>(length));
+    break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const char* StringDataArray::getUtf8Value(size_t i) const
+{
+  switch(m_Storage)
+  {
+  case Storage::Arena:
+    return m_Arena.data() + m_Offsets[i];
+  case Storage::Dictionary:
+    return m_Arena.data() + m_Offsets[m_Codes[i]];
+  default:
+    return nullptr;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setStorage(Storage storage)
+{
+  if(storage == m_Storage)
+  {
+    return;
+  }
+
+  // Build the new layout in a scratch array so the setUtf8Value() logic is shared
+  size_t numTuples = getNumberOfTuples();
+  StringDataArray converted;
+  converted.m_Storage = storage;
+  converted.resetStorage(numTuples);
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    if(m_Storage == Storage::Strings)
+    {
+      QByteArray utf8 = m_Array[i].toUtf8();
+      converted.setUtf8Value(i, utf8.constData(), static_cast<size_t>(utf8.size()));
+    }
+    else
+    {
+      const char* value = getUtf8Value(i);
+      converted.setUtf8Value(i, value, std::strlen(value));
+    }
+  }
+
+  m_Storage = storage;
+  m_Array.swap(converted.m_Array);
+  m_Arena.swap(converted.m_Arena);
+  m_Offsets.swap(converted.m_Offsets);
+  m_Codes.swap(converted.m_Codes);
+  m_Dictionary.swap(converted.m_Dictionary);
+  m_ArenaGarbage = converted.m_ArenaGarbage;
+  m_SharedOffsets.swap(converted.m_SharedOffsets);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+StringDataArray::Storage StringDataArray::getStorage() const
+{
+  return m_Storage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::optimizeStorage()
+{
+  size_t numTuples = getNumberOfTuples();
+  size_t maxDistinct = numTuples / DictionaryCardinalityRatio;
+  if(m_Storage == Storage::Dictionary)
+  {
+    // Entry 0 is the empty string which may not be referenced by any tuple
+    if(m_Dictionary.size() > maxDistinct + 1)
+    {
+      setStorage(Storage::Arena);
+    }
+    return;
+  }
+
+  // Count distinct values, giving up as soon as there are too many for a dictionary
+  bool lowCardinality = (numTuples > 0);
+  std::unordered_map<std::string, uint32_t> distinct;
+  for(size_t i = 0; i < numTuples && lowCardinality; i++)
+  {
+    if(m_Storage == Storage::Strings)
+    {
+      distinct.emplace(m_Array[i].toStdString(), 0);
+    }
+    else
+    {
+      distinct.emplace(std::string(getUtf8Value(i)), 0);
+    }
+    lowCardinality = (distinct.size() <= maxDistinct);
+  }
+  setStorage(lowCardinality ? Storage::Dictionary : Storage::Arena);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t StringDataArray::getDictionarySize() const
+{
+  return (m_Storage == Storage::Dictionary) ? m_Offsets.size() : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::resetStorage(size_t numTuples)
+{
+  std::vector<QString>().swap(m_Array);
+  std::vector<char>().swap(m_Arena);
+  std::vector<size_t>().swap(m_Offsets);
+  std::vector<uint32_t>().swap(m_Codes);
+  m_Dictionary.clear();
+  m_ArenaGarbage = 0;
+  m_SharedOffsets.clear();
+
+  switch(m_Storage)
+  {
+  case Storage::Arena:
+    m_Arena.assign(1, '\0');
+    m_Offsets.assign(numTuples, 0);
+    break;
+  case Storage::Dictionary:
+    m_Arena.assign(1, '\0');
+    m_Offsets.assign(1, 0);
+    m_Codes.assign(numTuples, 0);
+    m_Dictionary.emplace(std::string(), 0);
+    break;
+  default:
+    m_Array.resize(numTuples);
+    break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t StringDataArray::appendToArena(const char* value, size_t length)
+{
+  size_t offset = m_Arena.size();
+  std::less_equal<const char*> lessEqual;
+  if(!m_Arena.empty() && lessEqual(m_Arena.data(), value) && !lessEqual(m_Arena.data() + m_Arena.size(), value))
+  {
+    // The value lives in the arena and would be invalidated by the resize below
+    size_t source = static_cast<size_t>(value - m_Arena.data());
+    m_Arena.resize(offset + length + 1);
+    std::memcpy(m_Arena.data() + offset, m_Arena.data() + source, length);
+  }
+  else
+  {
+    m_Arena.resize(offset + length + 1);
+    std::memcpy(m_Arena.data() + offset, value, length);
+  }
+  m_Arena[offset + length] = '\0';
+  return offset;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint32_t StringDataArray::findOrAddDictionaryEntry(const char* value, size_t length)
+{
+  std::string key(value, length);
+  auto iter = m_Dictionary.find(key);
+  if(iter != m_Dictionary.end())
+  {
+    return iter->second;
+  }
+  uint32_t code = static_cast<uint32_t>(m_Offsets.size());
+  m_Offsets.push_back(appendToArena(value, length));
+  m_Dictionary.emplace(std::move(key), code);
+  return code;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::compactArena()
+{
+  if(m_Storage != Storage::Arena)
+  {
+    return;
+  }
+  // Tuples that shared bytes before compacting keep sharing them afterwards
+  std::vector<char> arena(1, '\0');
+  std::unordered_map<size_t, size_t> moved;
+  std::unordered_map<size_t, size_t> sharedOffsets;
+  for(size_t& offset : m_Offsets)
+  {
+    if(offset == 0)
+    {
+      continue;
+    }
+    auto iter = moved.find(offset);
+    if(iter != moved.end())
+    {
+      offset = iter->second;
+      sharedOffsets[offset]++;
+      continue;
+    }
+    size_t length = std::strlen(m_Arena.data() + offset);
+    size_t newOffset = arena.size();
+    arena.insert(arena.end(), m_Arena.data() + offset, m_Arena.data() + offset + length + 1);
+    moved.emplace(offset, newOffset);
+    offset = newOffset;
+  }
+  m_Arena.swap(arena);
+  m_SharedOffsets.swap(sharedOffsets);
+  m_ArenaGarbage = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::releaseArenaValue(size_t offset)
+{
+  if(offset == 0)
+  {
+    return;
+  }
+  auto iter = m_SharedOffsets.find(offset);
+  if(iter != m_SharedOffsets.end())
+  {
+    if(--iter->second == 0)
+    {
+      m_SharedOffsets.erase(iter);
+    }
+    return;
+  }
+  m_ArenaGarbage += std::strlen(m_Arena.data() + offset) + 1;
 }
@@ -36,6 +36,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <QtCore/QString>
@@ -50,6 +51,12 @@
  * @class StringDataArray StringDataArray.h DREAM3DLib/Common/StringDataArray.h
  * @brief Stores an array of QString objects
  *
+ * The values can be held in one of three layouts selected with setStorage(). The
+ * default keeps a QString per tuple. The Arena layout keeps every value as NUL
+ * terminated UTF-8 in one contiguous buffer with an offset per tuple, and the
+ * Dictionary layout stores each distinct value once in that buffer together with
+ * a 32 bit code per tuple. getValue()/setValue() behave the same in every layout.
+ *
  * @date Nov 13, 2012
  * @version 1.0
  */
@@ -72,6 +79,16 @@ public:
   SIMPL_TYPE_MACRO_SUPER_OVERRIDE(StringDataArray, IDataArray)
   SIMPL_CLASS_VERSION(2)
 
+  /**
+   * @brief The in memory layout of the string values.
+   */
+  enum class Storage : int
+  {
+    Strings = 0,   //!< One QString per tuple
+    Arena = 1,     //!< UTF-8 bytes in one buffer plus one offset per tuple
+    Dictionary = 2 //!< Distinct UTF-8 values in one buffer plus one code per tuple
+  };
+
   /**
    * @brief CreateArray
    * @param numTuples
@@ -166,7 +183,9 @@ public:
   /**
    * @brief Returns a void pointer pointing to the index of the array. nullptr
    * pointers are entirely possible. No checks are performed to make sure
-   * the index is with in the range of the internal data array.
+   * the index is with in the range of the internal data array. With the Strings
+   * storage this points at a QString, otherwise at the NUL terminated UTF-8 bytes
+   * of the value.
    * @param i The index to have the returned pointer pointing to.
    * @return Void Pointer. Possibly nullptr.
    */
@@ -207,6 +226,13 @@ public:
    */
   size_t getTypeSize() override;
 
+  /**
+   * @brief Returns the number of bytes held by this array, including the
+   * character data of the strings.
+   * @return
+   */
+  size_t getUniqueByteCount() override;
+
   /**
    * @brief Removes Tuples from the Array. If the size of the vector is Zero nothing is done. If the size of the
    * vector is greater than or Equal to the number of Tuples then the Array is Resized to Zero. If there are
@@ -366,6 +392,50 @@ public:
    */
   QString getValue(size_t i);
 
+  /**
+   * @brief Converts the values into the given layout. The values themselves are
+   * not changed.
+   * @param storage
+   */
+  void setStorage(Storage storage);
+
+  /**
+   * @brief Returns the current layout of the values.
+   * @return
+   */
+  Storage getStorage() const;
+
+  /**
+   * @brief Switches to the Dictionary layout when no more than 1 in
+   * DictionaryCardinalityRatio of the values are distinct, otherwise to the Arena layout.
+   */
+  void optimizeStorage();
+
+  /**
+   * @brief Returns the number of distinct entries in the dictionary, including the
+   * empty string that is always entry 0. Returns 0 unless the storage is Dictionary.
+   * @return
+   */
+  size_t getDictionarySize() const;
+
+  /**
+   * @brief Returns the NUL terminated UTF-8 bytes of value i. The pointer is valid
+   * until the array is next modified. Returns nullptr with the Strings storage.
+   * @param i
+   * @return
+   */
+  const char* getUtf8Value(size_t i) const;
+
+  /**
+   * @brief Sets value i from length bytes of UTF-8 text.
+   * @param i
+   * @param value
+   * @param length
+   */
+  void setUtf8Value(size_t i, const char* value, size_t length);
+
+  static const size_t DictionaryCardinalityRatio = 4;
+
 protected:
   /**
    * @brief Protected Constructor
@@ -381,6 +451,43 @@ private:
   std::vector<QString> m_Array;
   bool _ownsData;
 
+  Storage m_Storage = Storage::Strings;
+  std::vector<char> m_Arena;     // NUL terminated UTF-8 values. Offset 0 is always the empty string
+  std::vector<size_t> m_Offsets; // Arena: one per tuple. Dictionary: one per dictionary entry
+  std::vector<uint32_t> m_Codes; // Dictionary: one per tuple
+  std::unordered_map<std::string, uint32_t> m_Dictionary;
+  size_t m_ArenaGarbage = 0; // Bytes of the arena no longer referenced by a tuple
+  std::unordered_map<size_t, size_t> m_SharedOffsets; // Arena: offset -> number of tuples beyond the first that reference it
+
+  /**
+   * @brief Releases all values and sets up numTuples empty strings in the current storage.
+   * @param numTuples
+   */
+  void resetStorage(size_t numTuples);
+
+  /**
+   * @brief Appends a NUL terminated copy of the value to the arena. The value may
+   * point into the arena itself.
+   * @return The offset of the copy
+   */
+  size_t appendToArena(const char* value, size_t length);
+
+  /**
+   * @brief Drops one reference to the value at offset. The bytes only count as garbage
+   * once no tuple references them anymore.
+   */
+  void releaseArenaValue(size_t offset);
+
+  /**
+   * @brief Returns the dictionary code for the value, adding it when it is new.
+   */
+  uint32_t findOrAddDictionaryEntry(const char* value, size_t length);
+
+  /**
+   * @brief Rewrites the arena so it holds only the values referenced by a tuple.
+   */
+  void compactArena();
+
 public:
   StringDataArray(const StringDataArray&) = delete;            // Copy Constructor Not Implemented
   StringDataArray(StringDataArray&&) = delete;                 // Move Constructor Not Implemented
@@ -0,0 +1,340 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class BitMaskArrayTest
+{
+public:
+  // Not a multiple of 64 so the last word is only partially used
+  const size_t k_ArraySize = 150;
+
+  BitMaskArrayTest() = default;
+  virtual ~BitMaskArrayTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+    QFile::remove(UnitTest::BitMaskArrayTest::TestFile);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  BoolArrayType::Pointer createReference(size_t modulus)
+  {
+    BoolArrayType::Pointer values = BoolArrayType::CreateArray(k_ArraySize, "Reference", true);
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      values->setValue(i, (i % modulus) == 0);
+    }
+    return values;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSetGetValues()
+  {
+    BitMaskArray::Pointer mask = BitMaskArray::CreateArray(k_ArraySize, "Mask", true);
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfComponents(), 1)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfWords(), 3)
+    DREAM3D_REQUIRE_EQUAL(mask->getUniqueByteCount(), 3 * sizeof(BitMaskArray::WordType))
+    DREAM3D_REQUIRE_EQUAL(mask->getTypeAsString(), SIMPL::TypeNames::BitMaskArray)
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 0)
+
+    mask->setValue(0, true);
+    mask->setValue(63, true);
+    mask->setValue(64, true);
+    mask->setValue(k_ArraySize - 1, true);
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(0), true)
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(1), false)
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(63), true)
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(64), true)
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(k_ArraySize - 1), true)
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 4)
+
+    mask->setValue(63, false);
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(63), false)
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 3)
+
+    // The bits past the last tuple must stay zero
+    mask->initializeWithValue(true);
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(*(mask->getWordPointer(2)), (BitMaskArray::WordType(1) << (k_ArraySize - 128)) - 1)
+
+    mask->initializeWithZeros();
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLogicalOperations()
+  {
+    BoolArrayType::Pointer by2 = createReference(2);
+    BoolArrayType::Pointer by3 = createReference(3);
+    BitMaskArray::Pointer andMask = BitMaskArray::FromBoolArray(by2.get(), "And");
+    BitMaskArray::Pointer orMask = BitMaskArray::FromBoolArray(by2.get(), "Or");
+    BitMaskArray::Pointer other = BitMaskArray::FromBoolArray(by3.get());
+    DREAM3D_REQUIRE_EQUAL(other->getName(), by3->getName())
+
+    DREAM3D_REQUIRE_EQUAL(andMask->andWith(*other), true)
+    DREAM3D_REQUIRE_EQUAL(orMask->orWith(*other), true)
+    size_t andCount = 0;
+    size_t orCount = 0;
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      bool a = by2->getValue(i) && by3->getValue(i);
+      bool o = by2->getValue(i) || by3->getValue(i);
+      DREAM3D_REQUIRE_EQUAL(andMask->getValue(i), a)
+      DREAM3D_REQUIRE_EQUAL(orMask->getValue(i), o)
+      andCount += a ? 1 : 0;
+      orCount += o ? 1 : 0;
+    }
+    DREAM3D_REQUIRE_EQUAL(andMask->countTrue(), andCount)
+    DREAM3D_REQUIRE_EQUAL(orMask->countTrue(), orCount)
+
+    orMask->invert();
+    DREAM3D_REQUIRE_EQUAL(orMask->countTrue(), k_ArraySize - orCount)
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(orMask->getValue(i), !(by2->getValue(i) || by3->getValue(i)))
+    }
+
+    // Masks of different sizes can not be combined
+    BitMaskArray::Pointer small = BitMaskArray::CreateArray(10, "Small", true);
+    DREAM3D_REQUIRE_EQUAL(andMask->andWith(*small), false)
+    DREAM3D_REQUIRE_EQUAL(andMask->orWith(*small), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBoolArrayConversion()
+  {
+    BoolArrayType::Pointer by5 = createReference(5);
+    BitMaskArray::Pointer mask = BitMaskArray::FromBoolArray(by5.get(), "Mask");
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), (k_ArraySize + 4) / 5)
+
+    BoolArrayType::Pointer unpacked = mask->toBoolArray();
+    DREAM3D_REQUIRE_EQUAL(unpacked->getName(), mask->getName())
+    DREAM3D_REQUIRE_EQUAL(unpacked->getNumberOfTuples(), k_ArraySize)
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(unpacked->getValue(i), by5->getValue(i))
+    }
+
+    BoolArrayType::Pointer tooSmall = BoolArrayType::CreateArray(k_ArraySize - 1, "TooSmall", true);
+    DREAM3D_REQUIRE_EQUAL(mask->copyIntoBoolArray(tooSmall.get()), false)
+
+    // copyFromArray accepts both a DataArray<bool> and another mask
+    BitMaskArray::Pointer copy = BitMaskArray::CreateArray(k_ArraySize * 2, "Copy", true);
+    DREAM3D_REQUIRE_EQUAL(copy->copyFromArray(0, by5), true)
+    DREAM3D_REQUIRE_EQUAL(copy->copyFromArray(k_ArraySize, mask), true)
+    DREAM3D_REQUIRE_EQUAL(copy->copyFromArray(k_ArraySize + 1, mask), false)
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(copy->getValue(i), by5->getValue(i))
+      DREAM3D_REQUIRE_EQUAL(copy->getValue(k_ArraySize + i), by5->getValue(i))
+    }
+
+    BitMaskArray::Pointer deep = std::dynamic_pointer_cast<BitMaskArray>(copy->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(deep.get())
+    DREAM3D_REQUIRE_EQUAL(deep->countTrue(), copy->countTrue())
+
+    // A structure-only copy holds no words
+    BitMaskArray::Pointer empty = std::dynamic_pointer_cast<BitMaskArray>(copy->deepCopy(true));
+    DREAM3D_REQUIRE_VALID_POINTER(empty.get())
+    DREAM3D_REQUIRE_EQUAL(empty->isAllocated(), false)
+    DREAM3D_REQUIRE_EQUAL(empty->getNumberOfTuples(), copy->getNumberOfTuples())
+    DREAM3D_REQUIRE_EQUAL(empty->getUniqueByteCount(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestResizeAndErase()
+  {
+    BitMaskArray::Pointer mask = BitMaskArray::CreateArray(k_ArraySize, "Mask", true);
+    mask->initializeWithValue(true);
+
+    // Values that are added by growing the array start out false
+    mask->resizeTuples(70);
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 70)
+    mask->resizeTuples(200);
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfWords(), 4)
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 70)
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(69), true)
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(70), false)
+
+    std::vector<size_t> idxs = {0, 1, 69, 199};
+    DREAM3D_REQUIRE_EQUAL(mask->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), 196)
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 67)
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(66), true)
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(67), false)
+
+    idxs = {196};
+    DREAM3D_REQUIRE_EQUAL(mask->eraseTuples(idxs), -100)
+
+    DREAM3D_REQUIRE_EQUAL(mask->copyTuple(0, 100), 0)
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(100), true)
+    DREAM3D_REQUIRE_EQUAL(mask->copyTuple(0, 196), -1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestThresholdIntoMask()
+  {
+    FloatArrayType::Pointer input = FloatArrayType::CreateArray(k_ArraySize, "Input", true);
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      input->setValue(i, static_cast<float>(i % 10));
+    }
+
+    BoolArrayType::Pointer boolOutput = BoolArrayType::CreateArray(k_ArraySize, "Bool", true);
+    BitMaskArray::Pointer maskOutput = BitMaskArray::CreateArray(k_ArraySize, "Mask", true);
+    maskOutput->initializeWithValue(true);
+
+    ThresholdFilterHelper boolFilter(SIMPL::Comparison::Operator_LessThan, 4.0, boolOutput.get());
+    DREAM3D_REQUIRED(boolFilter.execute(input.get(), boolOutput.get()), >=, 0)
+    ThresholdFilterHelper maskFilter(SIMPL::Comparison::Operator_LessThan, 4.0, maskOutput.get());
+    DREAM3D_REQUIRED(maskFilter.execute(input.get(), maskOutput.get()), >=, 0)
+
+    DREAM3D_REQUIRE_EQUAL(maskOutput->countTrue(), 60)
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(maskOutput->getValue(i), boolOutput->getValue(i))
+    }
+
+    // The mask has to be large enough to hold every value of the input
+    BitMaskArray::Pointer small = BitMaskArray::CreateArray(10, "Small", true);
+    ThresholdFilterHelper smallFilter(SIMPL::Comparison::Operator_LessThan, 4.0, small.get());
+    DREAM3D_REQUIRED(smallFilter.execute(input.get(), small.get()), <, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestH5RoundTrip()
+  {
+    QDir dir(UnitTest::BitMaskArrayTest::TestDir);
+    dir.mkpath(".");
+    hid_t fileId = QH5Utilities::createFile(UnitTest::BitMaskArrayTest::TestFile);
+    DREAM3D_REQUIRED(fileId, >, 0)
+    H5ScopedFileSentinel sentinel(&fileId, false);
+
+    BoolArrayType::Pointer by7 = createReference(7);
+    BitMaskArray::Pointer written = BitMaskArray::FromBoolArray(by7.get(), "Mask");
+    std::vector<size_t> tDims = {10, 15};
+    DREAM3D_REQUIRED(written->writeH5Data(fileId, tDims), >=, 0)
+
+    BitMaskArray::Pointer read = BitMaskArray::CreateArray(0, "Mask", false);
+    DREAM3D_REQUIRED(read->readH5Data(fileId), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(read->getNumberOfTuples(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(read->countTrue(), written->countTrue())
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(read->getValue(i), by7->getValue(i))
+    }
+
+    IDataArray::Pointer iArray = H5DataArrayReader::ReadBitMaskArray(fileId, "Mask", false);
+    BitMaskArray::Pointer fromReader = std::dynamic_pointer_cast<BitMaskArray>(iArray);
+    DREAM3D_REQUIRE_VALID_POINTER(fromReader.get())
+    DREAM3D_REQUIRE_EQUAL(fromReader->countTrue(), written->countTrue())
+
+    iArray = H5DataArrayReader::ReadBitMaskArray(fileId, "Mask", true);
+    DREAM3D_REQUIRE_EQUAL(iArray->getNumberOfTuples(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(iArray->isAllocated(), false)
+
+    // A DataArray<bool> data set is not a packed mask
+    DREAM3D_REQUIRED(by7->writeH5Data(fileId, tDims), >=, 0)
+    BitMaskArray::Pointer wrongType = BitMaskArray::CreateArray(0, "Reference", false);
+    DREAM3D_REQUIRED(wrongType->readH5Data(fileId), <, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### BitMaskArrayTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+#if !REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+    DREAM3D_REGISTER_TEST(TestSetGetValues())
+    DREAM3D_REGISTER_TEST(TestLogicalOperations())
+    DREAM3D_REGISTER_TEST(TestBoolArrayConversion())
+    DREAM3D_REGISTER_TEST(TestResizeAndErase())
+    DREAM3D_REGISTER_TEST(TestThresholdIntoMask())
+    DREAM3D_REGISTER_TEST(TestH5RoundTrip())
+
+#if REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+  }
+
+public:
+  BitMaskArrayTest(const BitMaskArrayTest&) = delete;            // Copy Constructor Not Implemented
+  BitMaskArrayTest(BitMaskArrayTest&&) = delete;                 // Move Constructor Not Implemented
+  BitMaskArrayTest& operator=(const BitMaskArrayTest&) = delete; // Copy Assignment Not Implemented
+  BitMaskArrayTest& operator=(BitMaskArrayTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -33,10 +33,12 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
 #include <map>
+#include <thread>
 #include <vector>
 
 #include <QtCore/QDir>
@@ -44,7 +46,11 @@
 #include <QtCore/QString>
 #include <QtCore/QVector>
 
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/DataArrayAllocator.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
@@ -674,6 +680,128 @@ public:
     TestNeighborListDeepCopyForType<int8_t>();
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNeighborListPacked()
+  {
+    // Lists of length 0, 3, 1, 0, 2
+    Int32NeighborListType::Builder builder;
+    builder.reserve(5, 6);
+    builder.endList();
+    int32_t first[3] = {10, 11, 12};
+    builder.addList(first, 3);
+    builder.addValue(20);
+    builder.endList();
+    builder.endList();
+    builder.addValue(40);
+    builder.addValue(41);
+    DREAM3D_REQUIRE_EQUAL(builder.getNumberOfLists(), 4)
+    Int32NeighborListType::Pointer list = builder.create("Packed");
+    DREAM3D_REQUIRE_VALID_POINTER(list.get())
+    DREAM3D_REQUIRE_EQUAL(builder.getNumberOfLists(), 0)
+
+    DREAM3D_REQUIRE_EQUAL(list->isPacked(), true)
+    DREAM3D_REQUIRE_EQUAL(list->getNumberOfTuples(), 5)
+    DREAM3D_REQUIRE_EQUAL(list->getNumberOfLists(), 5)
+    DREAM3D_REQUIRE_EQUAL(list->getSize(), 6)
+    DREAM3D_REQUIRE_EQUAL(list->getListSize(0), 0)
+    DREAM3D_REQUIRE_EQUAL(list->getListSize(1), 3)
+    DREAM3D_REQUIRE_EQUAL(list->getListSize(4), 2)
+    bool ok = true;
+    DREAM3D_REQUIRE_EQUAL(list->getValue(1, 2, ok), 12)
+    DREAM3D_REQUIRE_EQUAL(ok, true)
+    list->getValue(3, 0, ok);
+    DREAM3D_REQUIRE_EQUAL(ok, false)
+
+    // Views read and write in place without changing the layout
+    Int32NeighborListType::ListView view = list->getListView(1);
+    DREAM3D_REQUIRE_EQUAL(view.size(), 3)
+    view[0] = 15;
+    int32_t sum = 0;
+    for(int32_t value : view)
+    {
+      sum += value;
+    }
+    DREAM3D_REQUIRE_EQUAL(sum, 38)
+    const Int32NeighborListType& constList = *list;
+    DREAM3D_REQUIRE_EQUAL(constList[1][0], 15)
+    DREAM3D_REQUIRE_EQUAL(constList.getListReference(4).size(), 2)
+    DREAM3D_REQUIRE_EQUAL(list->copyOfList(4).back(), 41)
+    DREAM3D_REQUIRE_EQUAL(list->isPacked(), true)
+
+    QString outStr;
+    QTextStream out(&outStr);
+    list->printTuple(out, 1);
+    DREAM3D_REQUIRE_EQUAL(outStr.compare("3,15,11,12"), 0)
+
+    // Appending to the last list keeps the packed layout
+    list->addEntry(4, 42);
+    list->addEntry(6, 60);
+    DREAM3D_REQUIRE_EQUAL(list->isPacked(), true)
+    DREAM3D_REQUIRE_EQUAL(list->getNumberOfLists(), 7)
+    DREAM3D_REQUIRE_EQUAL(list->getListSize(4), 3)
+    DREAM3D_REQUIRE_EQUAL(list->getListSize(5), 0)
+
+    // Erasing compacts the packed arrays
+    std::vector<size_t> eraseElements = {0, 3};
+    DREAM3D_REQUIRE_EQUAL(list->eraseTuples(eraseElements), 0)
+    DREAM3D_REQUIRE_EQUAL(list->isPacked(), true)
+    DREAM3D_REQUIRE_EQUAL(list->getNumberOfLists(), 5)
+    DREAM3D_REQUIRE_EQUAL(list->getSize(), 8)
+    DREAM3D_REQUIRE_EQUAL(list->getListView(2).size(), 3)
+    DREAM3D_REQUIRE_EQUAL(list->getListView(4)[0], 60)
+
+    // Deep copies stay packed and do not share memory
+    Int32NeighborListType::Pointer copy = std::dynamic_pointer_cast<Int32NeighborListType>(list->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(copy.get())
+    DREAM3D_REQUIRE_EQUAL(copy->isPacked(), true)
+    DREAM3D_REQUIRED(copy->getListView(0).data(), !=, list->getListView(0).data())
+    DREAM3D_REQUIRE_EQUAL(copy->getListView(0)[0], 15)
+
+    // Mutable access switches to one vector per list and pack() converts back
+    copy->getListReference(1).push_back(21);
+    (*copy)[static_cast<size_t>(3)].push_back(50);
+    DREAM3D_REQUIRE_EQUAL(copy->isPacked(), false)
+    DREAM3D_REQUIRE_EQUAL(copy->getListSize(1), 2)
+    DREAM3D_REQUIRE_EQUAL(copy->getSize(), 10)
+    copy->pack();
+    DREAM3D_REQUIRE_EQUAL(copy->isPacked(), true)
+    DREAM3D_REQUIRE_EQUAL(copy->getListView(1)[1], 21)
+    DREAM3D_REQUIRE_EQUAL(copy->getListView(3)[0], 50)
+    DREAM3D_REQUIRE_EQUAL(copy->getUniqueByteCount(), 6 * sizeof(size_t) + 10 * sizeof(int32_t))
+
+    // Inconsistent buffers are rejected
+    std::vector<size_t> offsets = {0, 2, 1};
+    DREAM3D_REQUIRE_EQUAL(copy->setPackedStorage(offsets, std::vector<int32_t>(1, 0)), false)
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfLists(), 5)
+
+    // The packed arrays are written and read as they are
+    QDir dir(UnitTest::DataArrayTest::TestDir);
+    dir.mkpath(".");
+    hid_t fileId = QH5Utilities::createFile(UnitTest::DataArrayTest::TestDir + "/NeighborListTest.h5");
+    DREAM3D_REQUIRED(fileId, >, 0)
+    H5ScopedFileSentinel sentinel(&fileId, false);
+    std::vector<size_t> tDims = {5};
+    DREAM3D_REQUIRED(copy->writeH5Data(fileId, tDims), >=, 0)
+
+    Int32NeighborListType::Pointer read = Int32NeighborListType::CreateArray(0, copy->getName(), false);
+    DREAM3D_REQUIRED(read->readH5Data(fileId), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(read->isPacked(), true)
+    DREAM3D_REQUIRE_EQUAL(read->getNumberOfTuples(), 5)
+    DREAM3D_REQUIRE_EQUAL(read->getSize(), 10)
+    for(size_t i = 0; i < 5; i++)
+    {
+      Int32NeighborListType::ConstListView expected = copy->getListView(i);
+      Int32NeighborListType::ConstListView actual = read->getListView(i);
+      DREAM3D_REQUIRE_EQUAL(actual.size(), expected.size())
+      for(size_t j = 0; j < expected.size(); j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(actual[j], expected[j])
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1245,6 +1373,353 @@ true);
     TestSetTupleForType<double>();
   }
 
+  // -----------------------------------------------------------------------------
+  template <typename T> void TestCapacityForType()
+  {
+    DataArray<T> array(0, "Capacity Array", static_cast<T>(0));
+    DREAM3D_REQUIRE_EQUAL(array.capacity(), 0)
+
+    // Appending one element at a time should only reallocate a logarithmic number of times
+    size_t numReallocs = 0;
+    size_t lastCapacity = array.capacity();
+    for(size_t i = 0; i < 1000; i++)
+    {
+      array.push_back(static_cast<T>(i % 100));
+      DREAM3D_REQUIRE_EQUAL(array.getSize(), i + 1)
+      DREAM3D_REQUIRED(array.capacity(), >=, array.getSize())
+      if(array.capacity() != lastCapacity)
+      {
+        numReallocs++;
+        lastCapacity = array.capacity();
+      }
+    }
+    DREAM3D_REQUIRED(numReallocs, <, 30)
+    for(size_t i = 0; i < 1000; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(array[i], static_cast<T>(i % 100))
+    }
+
+    // Shrinking keeps the capacity, shrink_to_fit() gives it back
+    array.resizeTuples(10);
+    DREAM3D_REQUIRE_EQUAL(array.getNumberOfTuples(), 10)
+    DREAM3D_REQUIRE_EQUAL(array.getSize(), 10)
+    DREAM3D_REQUIRED(array.capacity(), >=, 1000)
+    array.shrink_to_fit();
+    DREAM3D_REQUIRE_EQUAL(array.capacity(), 10)
+    DREAM3D_REQUIRE_EQUAL(array[9], static_cast<T>(9))
+
+    // Growing back inside the reserved capacity initializes the new values
+    array.reserve(500);
+    DREAM3D_REQUIRE_EQUAL(array.capacity(), 500)
+    DREAM3D_REQUIRE_EQUAL(array.getSize(), 10)
+    T* ptr = array.getPointer(0);
+    array.resizeTuples(500);
+    DREAM3D_REQUIRE_EQUAL(array.getNumberOfTuples(), 500)
+    DREAM3D_REQUIRE_EQUAL(array.getPointer(0), ptr)
+    DREAM3D_REQUIRE_EQUAL(array[499], static_cast<T>(0))
+
+    // reserve() never shrinks
+    array.reserve(5);
+    DREAM3D_REQUIRE_EQUAL(array.capacity(), 500)
+
+    // Wrapped memory is copied before it is grown
+    std::vector<T> external(8, static_cast<T>(3));
+    typename DataArray<T>::Pointer wrapped = DataArray<T>::WrapPointer(external.data(), 8, std::vector<size_t>(1, 1), "Wrapped", false);
+    DREAM3D_REQUIRE_EQUAL(wrapped->capacity(), 8)
+    wrapped->push_back(static_cast<T>(4));
+    DREAM3D_REQUIRE_EQUAL(wrapped->getSize(), 9)
+    DREAM3D_REQUIRED(wrapped->getPointer(0), !=, external.data())
+    DREAM3D_REQUIRE_EQUAL(wrapped->getValue(7), static_cast<T>(3))
+    DREAM3D_REQUIRE_EQUAL(wrapped->getValue(8), static_cast<T>(4))
+
+    array.clear();
+    DREAM3D_REQUIRE_EQUAL(array.capacity(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestCapacity()
+  {
+    TestCapacityForType<uint8_t>();
+    TestCapacityForType<int8_t>();
+    TestCapacityForType<uint16_t>();
+    TestCapacityForType<int16_t>();
+    TestCapacityForType<uint32_t>();
+    TestCapacityForType<int32_t>();
+    TestCapacityForType<uint64_t>();
+    TestCapacityForType<int64_t>();
+    TestCapacityForType<float>();
+    TestCapacityForType<double>();
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestAllocator()
+  {
+    DataArrayAllocator::Pointer aligned = DataArrayAllocator::New(DataArrayAllocator::k_CacheLineAlignment, DataArrayAllocator::HugePageMode::Transparent, true);
+    DREAM3D_REQUIRE_EQUAL(aligned->getAlignment(), DataArrayAllocator::k_CacheLineAlignment)
+    DREAM3D_REQUIRE_EQUAL(aligned->getStatistics().bytesLive, 0)
+
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(0, std::vector<size_t>(1, 3), "Aligned Array", false);
+    array->setAllocator(aligned);
+    array->resizeTuples(1000);
+    DREAM3D_REQUIRE_EQUAL(reinterpret_cast<size_t>(array->getPointer(0)) % DataArrayAllocator::k_CacheLineAlignment, 0)
+    DREAM3D_REQUIRE_EQUAL(aligned->getStatistics().bytesLive, array->capacity() * sizeof(float))
+    DREAM3D_REQUIRE_EQUAL(aligned->getStatistics().numLiveBlocks, 1)
+
+    for(size_t i = 0; i < array->getSize(); i++)
+    {
+      array->setValue(i, static_cast<float>(i));
+    }
+    // Growing keeps the alignment and the values
+    array->resizeTuples(200000);
+    DREAM3D_REQUIRE_EQUAL(reinterpret_cast<size_t>(array->getPointer(0)) % DataArrayAllocator::k_CacheLineAlignment, 0)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(2999), 2999.0f)
+    size_t peak = aligned->getStatistics().bytesPeak;
+    DREAM3D_REQUIRED(peak, >=, array->capacity() * sizeof(float))
+
+    // Ownership can be handed to an array that uses a different allocator
+    FloatArrayType::Pointer wrapped = FloatArrayType::WrapPointer(array->getPointer(0), array->getNumberOfTuples(), array->getComponentDimensions(), "Wrapped", true);
+    array->releaseOwnership();
+    array = FloatArrayType::NullPointer();
+    DREAM3D_REQUIRE_EQUAL(aligned->getStatistics().numLiveBlocks, 1)
+    wrapped = FloatArrayType::NullPointer();
+    DREAM3D_REQUIRE_EQUAL(aligned->getStatistics().bytesLive, 0)
+    DREAM3D_REQUIRE_EQUAL(aligned->getStatistics().numLiveBlocks, 0)
+    DREAM3D_REQUIRE_EQUAL(aligned->getStatistics().bytesPeak, peak)
+
+    aligned->resetPeak();
+    DREAM3D_REQUIRE_EQUAL(aligned->getStatistics().bytesPeak, 0)
+
+    // Changing the default allocator affects new arrays only
+    DataArrayAllocator::SetDefault(aligned);
+    Int32ArrayType::Pointer i32Array = Int32ArrayType::CreateArray(10, "Int32 Array", true);
+    DREAM3D_REQUIRE_EQUAL(i32Array->getAllocator().get(), aligned.get())
+    DREAM3D_REQUIRE_EQUAL(aligned->getStatistics().numLiveBlocks, 1)
+    DataArrayAllocator::SetDefault(DataArrayAllocator::NullPointer());
+    DREAM3D_REQUIRED(DataArrayAllocator::GetDefault().get(), !=, aligned.get())
+    i32Array = Int32ArrayType::NullPointer();
+    DREAM3D_REQUIRE_EQUAL(aligned->getStatistics().numLiveBlocks, 0)
+
+    // Arrays created, grown and released from several threads at once are all accounted for
+    DataArrayAllocator::SetDefault(aligned);
+    std::vector<std::thread> threads;
+    std::atomic<size_t> numWrongValues(0);
+    for(size_t t = 0; t < 8; t++)
+    {
+      threads.emplace_back([&numWrongValues, t] {
+        for(size_t i = 0; i < 2000; i++)
+        {
+          Int32ArrayType::Pointer threadArray = Int32ArrayType::CreateArray(1 + i % 97, "Thread Array", true);
+          threadArray->setValue(0, static_cast<int32_t>(t));
+          threadArray->resizeTuples(200 + i % 311);
+          numWrongValues += (threadArray->getValue(0) != static_cast<int32_t>(t)) ? 1 : 0;
+        }
+      });
+    }
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+    DataArrayAllocator::SetDefault(DataArrayAllocator::NullPointer());
+    DREAM3D_REQUIRE_EQUAL(numWrongValues.load(), 0)
+    DREAM3D_REQUIRE_EQUAL(aligned->getStatistics().numLiveBlocks, 0)
+    DREAM3D_REQUIRE_EQUAL(aligned->getStatistics().bytesLive, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestFileBackedArray()
+  {
+    QDir dir(UnitTest::DataArrayTest::TestDir);
+    dir.mkpath(".");
+
+    DataArrayAllocator::Pointer fileBacked = DataArrayAllocator::NewFileBacked(UnitTest::DataArrayTest::TestDir, DataArrayAllocator::FileBackedMode::Always, 0);
+    DREAM3D_REQUIRE_EQUAL(fileBacked->getScratchDirectory(), UnitTest::DataArrayTest::TestDir)
+    DREAM3D_REQUIRE_EQUAL(fileBacked->getStatistics().bytesFileBacked, 0)
+
+    Int64ArrayType::Pointer array = Int64ArrayType::CreateArray(0, std::vector<size_t>(1, 2), "File Backed Array", false);
+    array->setAllocator(fileBacked);
+    array->resizeTuples(5000);
+    for(size_t i = 0; i < array->getSize(); i++)
+    {
+      array->setValue(i, static_cast<int64_t>(i));
+    }
+    DREAM3D_REQUIRED(fileBacked->getStatistics().bytesFileBacked, >=, array->capacity() * sizeof(int64_t))
+
+    // Growing a mapped block keeps the values
+    array->resizeTuples(100000);
+    DREAM3D_REQUIRE_EQUAL(array->getValue(9999), 9999)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(array->getSize() - 1), 0)
+
+    // Deep copies read straight out of the mapped block
+    IDataArray::Pointer copy = array->deepCopy();
+    DREAM3D_REQUIRE_EQUAL(std::dynamic_pointer_cast<Int64ArrayType>(copy)->getValue(1234), 1234)
+    copy = IDataArray::NullPointer();
+
+    array->resizeTuples(10);
+    DREAM3D_REQUIRE_EQUAL(array->getValue(19), 19)
+    array = Int64ArrayType::NullPointer();
+    DREAM3D_REQUIRE_EQUAL(fileBacked->getStatistics().bytesFileBacked, 0)
+    DREAM3D_REQUIRE_EQUAL(fileBacked->getStatistics().numLiveBlocks, 0)
+
+    // The scratch files are unlinked as soon as they are mapped
+    DREAM3D_REQUIRE_EQUAL(dir.entryList(QDir::Files).filter("SIM").size(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestCopyOnWrite()
+  {
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(1000, std::vector<size_t>(1, 3), "Original", true);
+    for(size_t i = 0; i < array->getSize(); i++)
+    {
+      array->setValue(i, static_cast<int32_t>(i));
+    }
+    DREAM3D_REQUIRE_EQUAL(array->isShared(), false)
+
+    // The copy shares the buffer until it is written to
+    Int32ArrayType::Pointer copy = std::dynamic_pointer_cast<Int32ArrayType>(array->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(copy.get())
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfTuples(), 1000)
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfComponents(), 3)
+    DREAM3D_REQUIRE_EQUAL(array->isShared(), true)
+    DREAM3D_REQUIRE_EQUAL(copy->isShared(), true)
+    DREAM3D_REQUIRE_EQUAL(copy->getConstPointer(0), array->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(copy->getSharedByteCount(), 3000 * sizeof(int32_t))
+    DREAM3D_REQUIRE_EQUAL(copy->getUniqueByteCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(2999), 2999)
+
+    copy->setValue(5, -5);
+    DREAM3D_REQUIRE_EQUAL(copy->isShared(), false)
+    DREAM3D_REQUIRE_EQUAL(array->isShared(), false)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(5), -5)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(5), 5)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(2999), 2999)
+    DREAM3D_REQUIRE_EQUAL(copy->getUniqueByteCount(), 3000 * sizeof(int32_t))
+
+    // Writing to the original detaches it and leaves the copy untouched
+    copy = std::dynamic_pointer_cast<Int32ArrayType>(array->deepCopy());
+    int32_t* ptr = array->getPointer(0);
+    ptr[0] = 100;
+    DREAM3D_REQUIRED(ptr, !=, copy->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(0), 0)
+
+    // Resizing and erasing a shared array
+    copy = std::dynamic_pointer_cast<Int32ArrayType>(array->deepCopy());
+    copy->resizeTuples(2000);
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(2999), 2999)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(5999), 0)
+    DREAM3D_REQUIRE_EQUAL(array->getNumberOfTuples(), 1000)
+    copy = std::dynamic_pointer_cast<Int32ArrayType>(array->deepCopy());
+    std::vector<size_t> idxs = {0, 1};
+    DREAM3D_REQUIRE_EQUAL(copy->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(0), 6)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(0), 100)
+    DREAM3D_REQUIRE_EQUAL(array->isShared(), false)
+
+    // The last reference takes the buffer back without copying it
+    copy = std::dynamic_pointer_cast<Int32ArrayType>(array->deepCopy());
+    const int32_t* shared = array->getConstPointer(0);
+    array = Int32ArrayType::NullPointer();
+    DREAM3D_REQUIRE_EQUAL(copy->isShared(), false)
+    DREAM3D_REQUIRE_EQUAL(copy->getPointer(0), shared)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(1), 1)
+
+    // Attribute matrices report the shared memory of their arrays
+    std::vector<size_t> tDims(1, 1000);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "AttributeMatrix", AttributeMatrix::Type::Cell);
+    am->insertOrAssign(copy);
+    AttributeMatrix::Pointer amCopy = am->deepCopy(false);
+    DREAM3D_REQUIRE_EQUAL(am->getUniqueByteCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(amCopy->getSharedByteCount(), 3000 * sizeof(int32_t))
+    copy->initializeWithZeros();
+    DREAM3D_REQUIRE_EQUAL(am->getSharedByteCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(amCopy->getUniqueByteCount(), 3000 * sizeof(int32_t))
+
+    // Threads that write to a fresh copy and to the original at the same time detach each
+    // array exactly once
+    for(int run = 0; run < 20; run++)
+    {
+      Int32ArrayType::Pointer source = copy;
+      Int32ArrayType::Pointer target = std::dynamic_pointer_cast<Int32ArrayType>(source->deepCopy());
+      DREAM3D_REQUIRE_EQUAL(target->isShared(), true)
+      std::vector<std::thread> threads;
+      for(size_t t = 0; t < 8; t++)
+      {
+        threads.emplace_back([t, source, target] {
+          for(size_t i = t; i < 3000; i += 8)
+          {
+            (*target)[i] = static_cast<int32_t>(i) + 1;
+            source->setValue(i, -static_cast<int32_t>(i));
+          }
+        });
+      }
+      for(std::thread& thread : threads)
+      {
+        thread.join();
+      }
+      DREAM3D_REQUIRE_EQUAL(target->isShared(), false)
+      DREAM3D_REQUIRE_EQUAL(source->isShared(), false)
+      DREAM3D_REQUIRED(target->getConstPointer(0), !=, source->getConstPointer(0))
+      for(size_t i = 0; i < 3000; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(target->getValue(i), static_cast<int32_t>(i) + 1)
+        DREAM3D_REQUIRE_EQUAL(source->getValue(i), -static_cast<int32_t>(i))
+      }
+      DREAM3D_REQUIRE_EQUAL(target->getUniqueByteCount(), 3000 * sizeof(int32_t))
+      DREAM3D_REQUIRE_EQUAL(source->getUniqueByteCount(), 3000 * sizeof(int32_t))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestReadH5Data()
+  {
+    QDir dir(UnitTest::DataArrayTest::TestDir);
+    dir.mkpath(".");
+    hid_t fileId = QH5Utilities::createFile(UnitTest::DataArrayTest::TestDir + "/DataArrayReadTest.h5");
+    DREAM3D_REQUIRED(fileId, >, 0)
+    H5ScopedFileSentinel sentinel(&fileId, false);
+
+    // 5 slices of 4 x 3 tuples
+    std::vector<size_t> tDims = {4, 3, 5};
+    Int32ArrayType::Pointer written = Int32ArrayType::CreateArray(tDims, std::vector<size_t>(1, 2), "Data", true);
+    for(size_t i = 0; i < written->getSize(); i++)
+    {
+      written->setValue(i, static_cast<int32_t>(i));
+    }
+    DREAM3D_REQUIRED(written->writeH5Data(fileId, tDims), >=, 0)
+
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(0, "Data", false);
+    DREAM3D_REQUIRED(array->readH5Data(fileId), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(array->getNumberOfTuples(), 60)
+    DREAM3D_REQUIRE_EQUAL(array->getNumberOfComponents(), 2)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(119), 119)
+
+    // Memory that is already large enough is read into directly
+    array->setValue(0, -1);
+    int32_t* ptr = array->getPointer(0);
+    DREAM3D_REQUIRED(array->readH5Data(fileId), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(array->getPointer(0), ptr)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(0), 0)
+
+    std::vector<int32_t> buffer(120, -1);
+    Int32ArrayType::Pointer wrapped = Int32ArrayType::WrapPointer(buffer.data(), 60, std::vector<size_t>(1, 2), "Data", false);
+    DREAM3D_REQUIRED(wrapped->readH5Data(fileId), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(buffer[119], 119)
+    wrapped = Int32ArrayType::NullPointer();
+
+    // Values are converted to the type of the array while reading
+    FloatArrayType::Pointer floats = FloatArrayType::CreateArray(0, "Data", false);
+    DREAM3D_REQUIRED(floats->readH5Data(fileId), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(floats->getValue(7), 7.0f)
+
+    // Read slices 1 and 2 only
+    Int32ArrayType::Pointer slab = Int32ArrayType::CreateArray(0, "Data", false);
+    DREAM3D_REQUIRED(slab->readH5Hyperslab(fileId, 12, 24), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(slab->getNumberOfTuples(), 24)
+    DREAM3D_REQUIRE_EQUAL(slab->getValue(0), 24)
+    DREAM3D_REQUIRE_EQUAL(slab->getValue(47), 71)
+    DREAM3D_REQUIRED(slab->readH5Hyperslab(fileId, 5, 12), <, 0)
+    DREAM3D_REQUIRED(slab->readH5Hyperslab(fileId, 48, 24), <, 0)
+  }
+
   // -----------------------------------------------------------------------------
   void STLInterfaceTest()
   {
@@ -1410,9 +1885,15 @@ true);
     DREAM3D_REGISTER_TEST(TestcopyTuples())
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
     DREAM3D_REGISTER_TEST(TestNeighborList())
+    DREAM3D_REGISTER_TEST(TestNeighborListPacked())
     DREAM3D_REGISTER_TEST(TestWrapPointer())
     DREAM3D_REGISTER_TEST(TestPrintDataArray())
     DREAM3D_REGISTER_TEST(TestSetTuple())
+    DREAM3D_REGISTER_TEST(TestCapacity())
+    DREAM3D_REGISTER_TEST(TestAllocator())
+    DREAM3D_REGISTER_TEST(TestFileBackedArray())
+    DREAM3D_REGISTER_TEST(TestCopyOnWrite())
+    DREAM3D_REGISTER_TEST(TestReadH5Data())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -0,0 +1,189 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/DynamicListArray.hpp"
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DynamicListArrayTest
+{
+public:
+  DynamicListArrayTest() = default;
+  virtual ~DynamicListArrayTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAllocateLists()
+  {
+    ElementDynamicList::Pointer lists = ElementDynamicList::New();
+    std::vector<uint16_t> linkCounts = {2, 0, 3};
+    lists->allocateLists(linkCounts);
+    DREAM3D_REQUIRE_EQUAL(lists->size(), 3)
+    DREAM3D_REQUIRE_EQUAL(lists->getTotalNumberOfElements(), 5)
+
+    // All lists live in one buffer in order
+    DREAM3D_REQUIRE_EQUAL(lists->getElementListPointer(2), lists->getElementListPointer(0) + 2)
+    for(size_t i = 0; i < 5; i++)
+    {
+      size_t list = (i < 2) ? 0 : 2;
+      size_t pos = (i < 2) ? i : i - 2;
+      lists->insertCellReference(list, pos, 10 + i);
+    }
+    DREAM3D_REQUIRE_EQUAL(lists->getElementList(0).cells[1], 11)
+    DREAM3D_REQUIRE_EQUAL(lists->getElementList(2).cells[0], 12)
+    DREAM3D_REQUIRE_EQUAL(lists->getNumberOfElements(1), 0)
+
+    // Shrinking stays in place, growing moves the list and keeps the others intact
+    MeshIndexType shorter[1] = {20};
+    DREAM3D_REQUIRE_EQUAL(lists->setElementList(2, 1, shorter), true)
+    DREAM3D_REQUIRE_EQUAL(lists->getElementListPointer(2), lists->getElementListPointer(0) + 2)
+    MeshIndexType longer[4] = {30, 31, 32, 33};
+    DREAM3D_REQUIRE_EQUAL(lists->setElementList(1, 4, longer), true)
+    DREAM3D_REQUIRE_EQUAL(lists->getNumberOfElements(1), 4)
+    DREAM3D_REQUIRE_EQUAL(lists->getElementList(1).cells[3], 33)
+    DREAM3D_REQUIRE_EQUAL(lists->getElementList(0).cells[0], 10)
+    DREAM3D_REQUIRE_EQUAL(lists->getElementList(2).cells[0], 20)
+
+    // Grow a list from the contents of another list
+    DREAM3D_REQUIRE_EQUAL(lists->setElementList(0, lists->getElementList(1)), true)
+    DREAM3D_REQUIRE_EQUAL(lists->getNumberOfElements(0), 4)
+    DREAM3D_REQUIRE_EQUAL(lists->getElementList(0).cells[2], 32)
+    DREAM3D_REQUIRE_EQUAL(lists->setElementList(3, 1, shorter), false)
+
+    ElementDynamicList::Pointer copy = lists->deepCopy();
+    DREAM3D_REQUIRE_EQUAL(copy->size(), 3)
+    DREAM3D_REQUIRE_EQUAL(copy->getTotalNumberOfElements(), 9)
+    DREAM3D_REQUIRE_EQUAL(copy->getElementListPointer(1), copy->getElementListPointer(0) + 4)
+    DREAM3D_REQUIRE_EQUAL(copy->getElementList(1).cells[0], 30)
+    DREAM3D_REQUIRE_EQUAL(copy->getElementList(2).cells[0], 20)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSerializeLinks()
+  {
+    ElementDynamicList::Pointer lists = ElementDynamicList::New();
+    std::vector<uint16_t> linkCounts = {1, 3, 0, 2};
+    std::vector<MeshIndexType> elements = {5, 6, 7, 8, 9, 10};
+    DREAM3D_REQUIRE_EQUAL(lists->setLists(linkCounts, elements), true)
+    DREAM3D_REQUIRE_EQUAL(lists->getElementList(3).cells[1], 10)
+
+    std::vector<uint8_t> buffer;
+    lists->serializeLinks(buffer, lists->size());
+    DREAM3D_REQUIRE_EQUAL(buffer.size(), 4 * sizeof(uint16_t) + 6 * sizeof(MeshIndexType))
+
+    ElementDynamicList::Pointer read = ElementDynamicList::New();
+    DREAM3D_REQUIRE_EQUAL(read->deserializeLinks(buffer, 4), true)
+    DREAM3D_REQUIRE_EQUAL(read->size(), 4)
+    for(size_t i = 0; i < 4; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(read->getNumberOfElements(i), linkCounts[i])
+      for(uint16_t j = 0; j < linkCounts[i]; j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(read->getElementList(i).cells[j], lists->getElementList(i).cells[j])
+      }
+    }
+
+    // A truncated buffer is rejected
+    buffer.resize(buffer.size() - 1);
+    DREAM3D_REQUIRE_EQUAL(read->deserializeLinks(buffer, 4), false)
+    DREAM3D_REQUIRE_EQUAL(read->size(), 0)
+
+    std::vector<MeshIndexType> tooFew = {1};
+    DREAM3D_REQUIRE_EQUAL(read->setLists(linkCounts, tooFew), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConnectivity()
+  {
+    // Three triangles in a strip: (0,1,2), (1,3,2), (2,3,4)
+    MeshIndexArrayType::Pointer tris = MeshIndexArrayType::CreateArray(3, std::vector<size_t>(1, 3), "Triangles", true);
+    MeshIndexType verts[9] = {0, 1, 2, 1, 3, 2, 2, 3, 4};
+    for(size_t i = 0; i < 9; i++)
+    {
+      tris->setValue(i, verts[i]);
+    }
+
+    ElementDynamicList::Pointer containing = ElementDynamicList::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, MeshIndexType>(tris, containing, 5);
+    DREAM3D_REQUIRE_EQUAL(containing->size(), 5)
+    DREAM3D_REQUIRE_EQUAL(containing->getTotalNumberOfElements(), 9)
+    DREAM3D_REQUIRE_EQUAL(containing->getNumberOfElements(2), 3)
+    DREAM3D_REQUIRE_EQUAL(containing->getElementList(3).cells[0], 1)
+    DREAM3D_REQUIRE_EQUAL(containing->getElementList(3).cells[1], 2)
+
+    ElementDynamicList::Pointer neighbors = ElementDynamicList::New();
+    int err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, MeshIndexType>(tris, containing, neighbors, IGeometry::Type::Triangle);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(neighbors->size(), 3)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(0), 1)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getElementList(0).cells[0], 1)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(1), 2)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getElementList(1).cells[0], 0)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getElementList(1).cells[1], 2)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(2), 1)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getElementList(2).cells[0], 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DynamicListArrayTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestAllocateLists())
+    DREAM3D_REGISTER_TEST(TestSerializeLinks())
+    DREAM3D_REGISTER_TEST(TestConnectivity())
+  }
+
+public:
+  DynamicListArrayTest(const DynamicListArrayTest&) = delete;            // Copy Constructor Not Implemented
+  DynamicListArrayTest(DynamicListArrayTest&&) = delete;                 // Move Constructor Not Implemented
+  DynamicListArrayTest& operator=(const DynamicListArrayTest&) = delete; // Copy Assignment Not Implemented
+  DynamicListArrayTest& operator=(DynamicListArrayTest&&) = delete;      // Move Assignment Not Implemented
+};
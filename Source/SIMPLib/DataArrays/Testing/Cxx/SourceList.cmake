@@ -1,6 +1,8 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
+  BitMaskArrayTest
   DataArrayTest
+  DynamicListArrayTest
   StringDataArrayTest
   StructArrayTest
 )
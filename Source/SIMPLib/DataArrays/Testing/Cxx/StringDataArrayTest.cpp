@@ -38,8 +38,15 @@
 #include <iostream>
 #include <string>
 
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/StringDataArray.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Geometry/MeshStructs.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -103,6 +110,11 @@ public:
   // -----------------------------------------------------------------------------
   void RemoveTestFiles()
   {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::StringDataArrayTest::TestFile);
+    QDir tempDir(UnitTest::StringDataArrayTest::TestDir);
+    tempDir.removeRecursively();
+#endif
   }
 
   // -----------------------------------------------------------------------------
@@ -379,6 +391,193 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestArenaStorage()
+  {
+    StringDataArray::Pointer nodes = initializeStringDataArray();
+    QString unicode = QString::fromUtf8("gr\xC3\xBC\xC3\x9F \xE2\x82\xAC");
+    nodes->setValue(3, unicode);
+    nodes->setStorage(StringDataArray::Storage::Arena);
+    DREAM3D_REQUIRE_EQUAL(static_cast<int>(nodes->getStorage()), static_cast<int>(StringDataArray::Storage::Arena))
+    DREAM3D_REQUIRE_EQUAL(nodes->getNumberOfTuples(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(0), ::_0)
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(3), unicode)
+    DREAM3D_REQUIRE_EQUAL(QByteArray(nodes->getUtf8Value(3)), unicode.toUtf8())
+    DREAM3D_REQUIRE_EQUAL(nodes->getVoidPointer(9), static_cast<void*>(const_cast<char*>(nodes->getUtf8Value(9))))
+
+    nodes->setValue(1, QString("a longer replacement value"));
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(1), QString("a longer replacement value"))
+    DREAM3D_REQUIRE_EQUAL(nodes->copyTuple(1, 2), 0)
+    nodes->setValue(1, QString(""));
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(1), QString(""))
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(2), QString("a longer replacement value"))
+
+    std::vector<size_t> idxs = {0, 5};
+    DREAM3D_REQUIRE_EQUAL(nodes->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(nodes->getNumberOfTuples(), k_ArraySize - 2)
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(1), QString("a longer replacement value"))
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(2), unicode)
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(4), ::_6)
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(7), ::_9)
+
+    StringDataArray::Pointer copy = std::dynamic_pointer_cast<StringDataArray>(nodes->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(static_cast<int>(copy->getStorage()), static_cast<int>(StringDataArray::Storage::Arena))
+    for(size_t i = 0; i < nodes->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(nodes->getValue(i), copy->getValue(i))
+    }
+
+    // Copying between arrays in different storage keeps the values
+    StringDataArray::Pointer strings = initializeStringDataArray();
+    DREAM3D_REQUIRE_EQUAL(copy->copyFromArray(0, strings, 5, 3), true)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(0), ::_5)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(2), ::_7)
+    DREAM3D_REQUIRE_EQUAL(strings->copyFromArray(0, nodes, 2, 1), true)
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(0), unicode)
+
+    nodes->resizeTuples(k_ArraySize);
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(k_ArraySize - 1), QString(""))
+    nodes->initializeWithValue(QString("same"));
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(nodes->getValue(i), QString("same"))
+    }
+
+    // Replaced values are reclaimed instead of growing the arena without bound
+    for(size_t i = 0; i < 10000; i++)
+    {
+      nodes->setValue(i % k_ArraySize, QString::number(static_cast<int>(i)));
+    }
+    DREAM3D_REQUIRED(nodes->getUniqueByteCount(), <, 16384)
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(3), QString("9993"))
+
+    // A value shared by several tuples is garbage only once the last of them is replaced
+    QString shared(5000, QChar('s'));
+    nodes->initializeWithValue(shared);
+    DREAM3D_REQUIRE_EQUAL(nodes->copyTuple(0, 1), 0)
+    for(size_t i = 0; i + 1 < k_ArraySize; i++)
+    {
+      nodes->setValue(i, QString::number(static_cast<int>(i)));
+    }
+    DREAM3D_REQUIRED(nodes->getUniqueByteCount(), >, 5000)
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(k_ArraySize - 1), shared)
+    nodes->setValue(k_ArraySize - 1, QString("last"));
+    DREAM3D_REQUIRED(nodes->getUniqueByteCount(), <, 1024)
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(k_ArraySize - 1), QString("last"))
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(1), QString("1"))
+
+    nodes->setStorage(StringDataArray::Storage::Strings);
+    DREAM3D_REQUIRE_EQUAL(nodes->getUtf8Value(0) == nullptr, true)
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(9), QString("9999"))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDictionaryStorage()
+  {
+    const QString phases[3] = {QString("Austenite"), QString("Ferrite"), QString("Martensite")};
+    const size_t numTuples = 100;
+    StringDataArray::Pointer labels = StringDataArray::CreateArray(numTuples, kArrayName, true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      labels->setValue(i, phases[i % 3]);
+    }
+    size_t stringBytes = labels->getUniqueByteCount();
+
+    labels->optimizeStorage();
+    DREAM3D_REQUIRE_EQUAL(static_cast<int>(labels->getStorage()), static_cast<int>(StringDataArray::Storage::Dictionary))
+    // The empty string is always entry 0
+    DREAM3D_REQUIRE_EQUAL(labels->getDictionarySize(), 4)
+    DREAM3D_REQUIRED(labels->getUniqueByteCount(), <, stringBytes)
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(labels->getValue(i), phases[i % 3])
+    }
+    DREAM3D_REQUIRE_EQUAL(labels->getUtf8Value(0), labels->getUtf8Value(3))
+
+    labels->setValue(7, QString("Cementite"));
+    labels->setValue(8, QString("Cementite"));
+    DREAM3D_REQUIRE_EQUAL(labels->getDictionarySize(), 5)
+    DREAM3D_REQUIRE_EQUAL(labels->getValue(8), QString("Cementite"))
+
+    std::vector<size_t> idxs = {0};
+    DREAM3D_REQUIRE_EQUAL(labels->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(labels->getNumberOfTuples(), numTuples - 1)
+    DREAM3D_REQUIRE_EQUAL(labels->getValue(0), phases[1])
+    DREAM3D_REQUIRE_EQUAL(labels->getValue(6), QString("Cementite"))
+
+    labels->setStorage(StringDataArray::Storage::Arena);
+    DREAM3D_REQUIRE_EQUAL(labels->getDictionarySize(), 0)
+    DREAM3D_REQUIRE_EQUAL(labels->getValue(6), QString("Cementite"))
+    DREAM3D_REQUIRE_EQUAL(labels->getValue(8), phases[0])
+
+    // Every value distinct so a dictionary does not pay off
+    StringDataArray::Pointer nodes = initializeStringDataArray();
+    nodes->optimizeStorage();
+    DREAM3D_REQUIRE_EQUAL(static_cast<int>(nodes->getStorage()), static_cast<int>(StringDataArray::Storage::Arena))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestH5ReadWrite()
+  {
+    QDir dir(UnitTest::StringDataArrayTest::TestDir);
+    dir.mkpath(".");
+    hid_t fileId = QH5Utilities::createFile(UnitTest::StringDataArrayTest::TestFile);
+    DREAM3D_REQUIRED(fileId, >, 0)
+    H5ScopedFileSentinel sentinel(&fileId, false);
+
+    StringDataArray::Pointer nodes = initializeStringDataArray();
+    nodes->setValue(4, QString(""));
+    std::vector<size_t> tDims = {k_ArraySize};
+    DREAM3D_REQUIRED(nodes->writeH5Data(fileId, tDims), >=, 0)
+
+    const size_t numTuples = 64;
+    StringDataArray::Pointer labels = StringDataArray::CreateArray(numTuples, QString("Labels"), true);
+    labels->setStorage(StringDataArray::Storage::Arena);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      labels->setValue(i, (i % 2 == 0) ? ::_0 : ::_1);
+    }
+    tDims = {numTuples};
+    DREAM3D_REQUIRED(labels->writeH5Data(fileId, tDims), >=, 0)
+
+    // Reading into the default storage gives back QStrings
+    StringDataArray::Pointer strings = StringDataArray::CreateArray(0, kArrayName, true);
+    DREAM3D_REQUIRED(strings->readH5Data(fileId), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(static_cast<int>(strings->getStorage()), static_cast<int>(StringDataArray::Storage::Strings))
+    DREAM3D_REQUIRE_EQUAL(strings->getNumberOfTuples(), k_ArraySize)
+
+    // The reader keeps QStrings unless the caller asks for the optimized storage
+    StringDataArray::Pointer read = std::dynamic_pointer_cast<StringDataArray>(H5DataArrayReader::ReadStringDataArray(fileId, kArrayName));
+    DREAM3D_REQUIRE_VALID_POINTER(read.get())
+    DREAM3D_REQUIRE_EQUAL(static_cast<int>(read->getStorage()), static_cast<int>(StringDataArray::Storage::Strings))
+    DREAM3D_REQUIRE_EQUAL(*reinterpret_cast<QString*>(read->getVoidPointer(1)), nodes->getValue(1))
+
+    read = std::dynamic_pointer_cast<StringDataArray>(H5DataArrayReader::ReadStringDataArray(fileId, kArrayName, false, true));
+    DREAM3D_REQUIRE_VALID_POINTER(read.get())
+    DREAM3D_REQUIRE_EQUAL(static_cast<int>(read->getStorage()), static_cast<int>(StringDataArray::Storage::Arena))
+    DREAM3D_REQUIRE_EQUAL(read->getNumberOfTuples(), k_ArraySize)
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(read->getValue(i), nodes->getValue(i))
+      DREAM3D_REQUIRE_EQUAL(strings->getValue(i), nodes->getValue(i))
+    }
+
+    read = std::dynamic_pointer_cast<StringDataArray>(H5DataArrayReader::ReadStringDataArray(fileId, QString("Labels"), false, true));
+    DREAM3D_REQUIRE_VALID_POINTER(read.get())
+    DREAM3D_REQUIRE_EQUAL(static_cast<int>(read->getStorage()), static_cast<int>(StringDataArray::Storage::Dictionary))
+    DREAM3D_REQUIRE_EQUAL(read->getNumberOfTuples(), numTuples)
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(read->getValue(i), labels->getValue(i))
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -397,6 +596,9 @@ public:
     DREAM3D_REGISTER_TEST(TestTupleCopy())
     DREAM3D_REGISTER_TEST(TestTupleErase())
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
+    DREAM3D_REGISTER_TEST(TestArenaStorage())
+    DREAM3D_REGISTER_TEST(TestDictionaryStorage())
+    DREAM3D_REGISTER_TEST(TestH5ReadWrite())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -526,6 +526,34 @@ AttributeMatrix::Pointer AttributeMatrix::deepCopy(bool forceNoAllocate)
 
   return newAttrMat;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t AttributeMatrix::getSharedByteCount()
+{
+  size_t numBytes = 0;
+  const auto& dataArrays = getChildren();
+  for(const auto& d : dataArrays)
+  {
+    numBytes += d->getSharedByteCount();
+  }
+  return numBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t AttributeMatrix::getUniqueByteCount()
+{
+  size_t numBytes = 0;
+  const auto& dataArrays = getChildren();
+  for(const auto& d : dataArrays)
+  {
+    numBytes += d->getUniqueByteCount();
+  }
+  return numBytes;
+}
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -572,6 +600,14 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, const QString& nam
       dPtr->resizeTuples(getNumberOfTuples());
     }
   }
+  else if(classType.compare(SIMPL::TypeNames::BitMaskArray) == 0)
+  {
+    dPtr = H5DataArrayReader::ReadBitMaskArray(gid, name, preflight);
+    if(preflight && nullptr != dPtr.get())
+    {
+      dPtr->resizeTuples(getNumberOfTuples());
+    }
+  }
   else if(classType.compare("vector") == 0)
   {
   }
@@ -629,6 +665,10 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
     {
       dPtr = H5DataArrayReader::ReadStringDataArray(amGid, daToRead.getName(), preflight);
     }
+    else if(classType.compare(SIMPL::TypeNames::BitMaskArray) == 0)
+    {
+      dPtr = H5DataArrayReader::ReadBitMaskArray(amGid, daToRead.getName(), preflight);
+    }
     else if(classType.compare("vector") == 0)
     {
     }
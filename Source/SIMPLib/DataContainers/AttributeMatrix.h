@@ -610,6 +610,19 @@ public:
     */
     virtual AttributeMatrix::Pointer deepCopy(bool forceNoAllocate = false);
 
+    /**
+     * @brief Returns the number of bytes of the attribute arrays that are shared with arrays in
+     * other attribute matrices, for example with copies created by deepCopy() that were not modified yet.
+     * @return
+     */
+    size_t getSharedByteCount();
+
+    /**
+     * @brief Returns the number of bytes of the attribute arrays that belong to this attribute matrix only.
+     * @return
+     */
+    size_t getUniqueByteCount();
+
     /**
      * @brief writeAttributeArraysToHDF5
      * @param parentId
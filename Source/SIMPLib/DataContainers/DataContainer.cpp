@@ -712,8 +712,8 @@ int DataContainer::readMeshDataFromHDF5(hid_t dcGid, bool preflight)
     {
       setGeometry(geomPtr);
     }
-    // If no error in previous steps.
-    if(err >= 0)
+    // If no error in previous steps. DataContainers without a geometry are stored as an unknown geometry.
+    if(err >= 0 && nullptr != m_Geometry.get())
     {
       err = m_Geometry->IGeometry::readGeometryFromHDF5(geometryId, preflight);
     }
@@ -455,6 +455,40 @@ DataContainerArray::Pointer DataContainerArray::deepCopy(bool forceNoAllocate)
   return dcaCopy;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataContainerArray::getSharedByteCount()
+{
+  size_t numBytes = 0;
+  const Container dcs = getDataContainers();
+  for(const auto& dc : dcs)
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      numBytes += am->getSharedByteCount();
+    }
+  }
+  return numBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataContainerArray::getUniqueByteCount()
+{
+  size_t numBytes = 0;
+  const Container dcs = getDataContainers();
+  for(const auto& dc : dcs)
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      numBytes += am->getUniqueByteCount();
+    }
+  }
+  return numBytes;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
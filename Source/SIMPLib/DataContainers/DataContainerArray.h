@@ -771,6 +771,19 @@ public:
      */
     DataContainerArray::Pointer deepCopy(bool forceNoAllocate = false);
 
+    /**
+     * @brief Returns the number of bytes of all attribute arrays that are shared with other arrays,
+     * for example between this DataContainerArray and a copy of it created by deepCopy().
+     * @return
+     */
+    size_t getSharedByteCount();
+
+    /**
+     * @brief Returns the number of bytes of all attribute arrays that are not shared with any other array.
+     * @return
+     */
+    size_t getUniqueByteCount();
+
   protected:
     DataContainerArray();
 
@@ -36,6 +36,14 @@
 #include "AbstractFilter.h"
 
 
+#include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
+#include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
+#include "SIMPLib/FilterParameters/ImportHDF5DatasetFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputPathFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
+#include "SIMPLib/FilterParameters/ReadASCIIDataFilterParameter.h"
 #include "SIMPLib/Messages/FilterErrorMessage.h"
 #include "SIMPLib/Messages/FilterProgressMessage.h"
 #include "SIMPLib/Messages/FilterStatusMessage.h"
@@ -149,6 +157,40 @@ void AbstractFilter::preflight()
   setErrorCondition(-3016, "AbstractFilter does not implement a preflight method. Please use a subclass instead.");
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayPath AbstractFilter::getElementWiseAttributeMatrixPath()
+{
+  return DataArrayPath();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementWiseKernel::Pointer AbstractFilter::createElementWiseKernel()
+{
+  return ElementWiseKernel::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool AbstractFilter::getAccessesFiles()
+{
+  for(const FilterParameter::Pointer& parameter : getFilterParameters())
+  {
+    FilterParameter* p = parameter.get();
+    if(nullptr != dynamic_cast<InputFileFilterParameter*>(p) || nullptr != dynamic_cast<OutputFileFilterParameter*>(p) || nullptr != dynamic_cast<InputPathFilterParameter*>(p) ||
+       nullptr != dynamic_cast<OutputPathFilterParameter*>(p) || nullptr != dynamic_cast<DataContainerReaderFilterParameter*>(p) ||
+       nullptr != dynamic_cast<ImportHDF5DatasetFilterParameter*>(p) || nullptr != dynamic_cast<FileListInfoFilterParameter*>(p) || nullptr != dynamic_cast<ReadASCIIDataFilterParameter*>(p))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -535,7 +577,7 @@ void AbstractFilter::setErrorCondition(int code, const QString &messageText)
 {
   m_ErrorCode = code;
   FilterErrorMessage::Pointer pm = FilterErrorMessage::New(getNameOfClass(), getHumanLabel(), getPipelineIndex(), messageText, code);
-  emit messageGenerated(pm);
+  sendMessage(pm);
 }
 
 // -----------------------------------------------------------------------------
@@ -544,7 +586,7 @@ void AbstractFilter::setErrorCondition(int code, const QString &messageText)
 void AbstractFilter::notifyStatusMessage(const QString& messageText)
 {
   FilterStatusMessage::Pointer pm = FilterStatusMessage::New(getNameOfClass(), getHumanLabel(), getPipelineIndex(), messageText);
-  emit messageGenerated(pm);
+  sendMessage(pm);
 }
 
 // -----------------------------------------------------------------------------
@@ -554,7 +596,7 @@ void AbstractFilter::setWarningCondition(int code, const QString& messageText)
 {
   m_WarningCode = code;
   FilterWarningMessage::Pointer pm = FilterWarningMessage::New(getNameOfClass(), getHumanLabel(), getPipelineIndex(), messageText, code);
-  emit messageGenerated(pm);
+  sendMessage(pm);
 }
 
 // -----------------------------------------------------------------------------
@@ -562,8 +604,12 @@ void AbstractFilter::setWarningCondition(int code, const QString& messageText)
 // -----------------------------------------------------------------------------
 void AbstractFilter::notifyProgressMessage(int progress, const QString& messageText)
 {
+  if(isProgressQueued(progress, messageText))
+  {
+    return;
+  }
   FilterProgressMessage::Pointer pm = FilterProgressMessage::New(getNameOfClass(), getHumanLabel(), getPipelineIndex(), messageText, progress);
-  emit messageGenerated(pm);
+  sendMessage(pm);
 }
 
 // -----------------------------------------------------------------------------
@@ -45,6 +45,7 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/DataContainers/RenameDataPath.h"
 #include "SIMPLib/FilterParameters/FilterParameter.h"
+#include "SIMPLib/Filtering/ElementWiseKernel.h"
 #include "SIMPLib/SIMPLib.h"
 
 class AbstractFilterParametersReader;
@@ -221,6 +222,33 @@ public:
    */
   virtual void preflight();
 
+  /**
+   * @brief Returns the AttributeMatrix the filter works on if each tuple of its output only
+   * depends on the same tuple of its inputs, otherwise an empty path. FilterPipeline fuses
+   * runs of such filters on the same AttributeMatrix into one pass over the data, see
+   * ElementWiseFusion. The default returns an empty path.
+   * @return
+   */
+  virtual DataArrayPath getElementWiseAttributeMatrixPath();
+
+  /**
+   * @brief Does what execute() does before it walks the tuples and returns a kernel that
+   * does that walk for a range of tuples. Returns nullptr if the error condition was set or
+   * if the filter needs to be executed on its own, which is what the default does.
+   * @return
+   */
+  virtual ElementWiseKernel::Pointer createElementWiseKernel();
+
+  /**
+   * @brief Returns true if the filter reads or writes files while it executes. FilterPipeline
+   * never runs such a filter at the same time as another filter: the HDF5 library is usually
+   * not built thread safe, and the DataContainerArray does not show which filters share a file.
+   * The default returns true if any of the filter parameters is a file, path or HDF5 import
+   * parameter. Filters that reach files some other way should override this.
+   * @return
+   */
+  virtual bool getAccessesFiles();
+
   /**
    * @brief getPluginInstance Returns an instance of the filter's plugin
    * @return
@@ -0,0 +1,170 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ArrayLivenessAnalysis.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/PipelineDependencyGraph.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::set<DataArrayPath> collectArrayPaths(const DataContainerArray::Pointer& dca)
+{
+  std::set<DataArrayPath> paths;
+  for(const DataContainer::Pointer& dc : dca->getDataContainers())
+  {
+    for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+    {
+      for(const QString& daName : am->getAttributeArrayNames())
+      {
+        paths.insert(DataArrayPath(dc->getName(), am->getName(), daName));
+      }
+    }
+  }
+  return paths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Container>
+bool overlapsAny(const DataArrayPath& path, const Container& paths)
+{
+  return std::any_of(paths.begin(), paths.end(), [&path](const DataArrayPath& other) { return PipelineDependencyGraph::PathsOverlap(path, other); });
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ArrayLivenessAnalysis::ArrayLivenessAnalysis() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ArrayLivenessAnalysis::~ArrayLivenessAnalysis() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayLivenessAnalysis::analyze(const QList<AbstractFilter::Pointer>& filters, const QVector<DataArrayPath>& keptPaths)
+{
+  const size_t numFilters = static_cast<size_t>(filters.size());
+  m_Releases.assign(numFilters, PathList());
+
+  // Each array that currently exists, mapped to the last filter that read it so far
+  std::map<DataArrayPath, size_t> lastUse;
+  for(size_t i = 0; i < numFilters; i++)
+  {
+    AbstractFilter* filter = filters[static_cast<int>(i)].get();
+    if(!filter->getEnabled())
+    {
+      continue;
+    }
+
+    DataContainerArray::Pointer dca = filter->getDataContainerArray();
+    if(nullptr == dca.get())
+    {
+      // Not preflighted so nothing is known about what it creates or reads
+      m_Releases.assign(numFilters, PathList());
+      return;
+    }
+
+    std::set<DataArrayPath> paths = collectArrayPaths(dca);
+    PipelineDependencyGraph::PathList referenced = PipelineDependencyGraph::FindReferencedPaths(filter);
+    for(auto iter = lastUse.begin(); iter != lastUse.end();)
+    {
+      if(paths.find(iter->first) == paths.end())
+      {
+        // Deleted by this filter, which then owns releasing it
+        iter = lastUse.erase(iter);
+        continue;
+      }
+      if(referenced.empty() || overlapsAny(iter->first, referenced))
+      {
+        iter->second = i;
+      }
+      ++iter;
+    }
+    for(const DataArrayPath& path : paths)
+    {
+      // Arrays that appear here are created by this filter
+      lastUse.insert(std::make_pair(path, i));
+    }
+  }
+
+  for(const auto& entry : lastUse)
+  {
+    if(!overlapsAny(entry.first, keptPaths))
+    {
+      m_Releases[entry.second].push_back(entry.first);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ArrayLivenessAnalysis::size() const
+{
+  return m_Releases.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const ArrayLivenessAnalysis::PathList& ArrayLivenessAnalysis::getReleasesAfter(size_t index) const
+{
+  return m_Releases[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ArrayLivenessAnalysis::getReleaseCount() const
+{
+  size_t count = 0;
+  for(const PathList& releases : m_Releases)
+  {
+    count += releases.size();
+  }
+  return count;
+}
@@ -0,0 +1,100 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QList>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The ArrayLivenessAnalysis class works out, for a preflighted pipeline, after
+ * which filter each attribute array created by the pipeline is no longer needed.
+ *
+ * An array is live from the filter that creates it up to the last enabled filter that
+ * reads it. A filter reads every array that lies inside one of the paths held in its
+ * properties (see PipelineDependencyGraph::FindReferencedPaths). A filter without any
+ * path properties, such as a writer that saves the whole DataContainerArray, reads every
+ * array. Arrays that a later filter deletes are left to that filter and arrays inside
+ * one of the kept paths are never released.
+ */
+class SIMPLib_EXPORT ArrayLivenessAnalysis
+{
+public:
+  using PathList = std::vector<DataArrayPath>;
+
+  ArrayLivenessAnalysis();
+  virtual ~ArrayLivenessAnalysis();
+
+  /**
+   * @brief Analyzes the filters. The filters must still hold the DataContainerArray
+   * each one was left with by FilterPipeline::preflightPipeline().
+   * @param filters
+   * @param keptPaths DataContainer, AttributeMatrix or attribute array paths whose arrays must survive the pipeline
+   */
+  void analyze(const QList<AbstractFilter::Pointer>& filters, const QVector<DataArrayPath>& keptPaths);
+
+  /**
+   * @brief Returns the number of filters that were analyzed
+   * @return
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the arrays that may be released once the filter at index has executed
+   * @param index
+   * @return
+   */
+  const PathList& getReleasesAfter(size_t index) const;
+
+  /**
+   * @brief Returns the number of arrays the analysis releases before the end of the pipeline
+   * @return
+   */
+  size_t getReleaseCount() const;
+
+private:
+  std::vector<PathList> m_Releases;
+
+public:
+  ArrayLivenessAnalysis(const ArrayLivenessAnalysis&) = delete;            // Copy Constructor Not Implemented
+  ArrayLivenessAnalysis(ArrayLivenessAnalysis&&) = delete;                 // Move Constructor Not Implemented
+  ArrayLivenessAnalysis& operator=(const ArrayLivenessAnalysis&) = delete; // Copy Assignment Not Implemented
+  ArrayLivenessAnalysis& operator=(ArrayLivenessAnalysis&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,154 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ElementWiseFusion.h"
+
+#include <algorithm>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+/**
+ * @brief Runs all kernels on one block of tuples before moving on to the next block
+ */
+class FusedKernelsImpl
+{
+public:
+  FusedKernelsImpl(const ElementWiseFusion::KernelList& kernels)
+  : m_Kernels(kernels)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t blockStart = range.min(); blockStart < range.max(); blockStart += ElementWiseFusion::k_BlockSize)
+    {
+      size_t blockEnd = std::min(blockStart + ElementWiseFusion::k_BlockSize, range.max());
+      for(const ElementWiseKernel::Pointer& kernel : m_Kernels)
+      {
+        kernel->process(blockStart, blockEnd);
+      }
+    }
+  }
+
+private:
+  const ElementWiseFusion::KernelList& m_Kernels;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementWiseFusion::ElementWiseFusion() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementWiseFusion::~ElementWiseFusion() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ElementWiseFusion::analyze(const QList<AbstractFilter::Pointer>& filters)
+{
+  m_Groups.clear();
+
+  Group current;
+  auto closeGroup = [this, &current] {
+    if(current.FilterIndices.size() > 1)
+    {
+      m_Groups.push_back(current);
+    }
+    current = Group();
+  };
+
+  for(int i = 0; i < filters.size(); i++)
+  {
+    const AbstractFilter::Pointer& filter = filters[i];
+    DataArrayPath amPath;
+    if(filter->getEnabled())
+    {
+      amPath = filter->getElementWiseAttributeMatrixPath();
+    }
+    if(amPath.isEmpty() || amPath != current.AttributeMatrixPath)
+    {
+      closeGroup();
+    }
+    if(!amPath.isEmpty())
+    {
+      current.AttributeMatrixPath = amPath;
+      current.FilterIndices.push_back(static_cast<size_t>(i));
+    }
+  }
+  closeGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const ElementWiseFusion::GroupList& ElementWiseFusion::getGroups() const
+{
+  return m_Groups;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const ElementWiseFusion::Group* ElementWiseFusion::getGroupStartingAt(size_t index) const
+{
+  for(const Group& group : m_Groups)
+  {
+    if(group.FilterIndices.front() == index)
+    {
+      return &group;
+    }
+  }
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ElementWiseFusion::Execute(const KernelList& kernels, size_t numTuples)
+{
+  if(kernels.empty() || numTuples == 0)
+  {
+    return;
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  dataAlg.execute(FusedKernelsImpl(kernels));
+}
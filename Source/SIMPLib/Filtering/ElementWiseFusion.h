@@ -0,0 +1,115 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QList>
+
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/ElementWiseKernel.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The ElementWiseFusion class finds the runs of filters in a pipeline that can be
+ * executed as one pass over their data. A run is two or more consecutive enabled filters
+ * that each return the same path from AbstractFilter::getElementWiseAttributeMatrixPath().
+ *
+ * Execute() walks the tuples of the AttributeMatrix once, in blocks of k_BlockSize tuples
+ * that are spread over the available threads, and calls every kernel of the run on each
+ * block in pipeline order. As every kernel only reads and writes the tuples of the block
+ * it is given, each tuple goes through the same steps in the same order as when the filters
+ * execute one after the other, while the arrays are read from memory once.
+ */
+class SIMPLib_EXPORT ElementWiseFusion
+{
+public:
+  /**
+   * @brief The pipeline indices of the filters of one run and the AttributeMatrix they work on
+   */
+  struct Group
+  {
+    std::vector<size_t> FilterIndices;
+    DataArrayPath AttributeMatrixPath;
+  };
+
+  using GroupList = std::vector<Group>;
+  using KernelList = std::vector<ElementWiseKernel::Pointer>;
+
+  /**
+   * @brief The number of tuples each kernel processes before the next kernel takes over.
+   * Small enough that the block of a few arrays stays in the cache between the kernels.
+   */
+  static const size_t k_BlockSize = 8192;
+
+  ElementWiseFusion();
+  virtual ~ElementWiseFusion();
+
+  /**
+   * @brief Finds the runs of element-wise filters
+   * @param filters
+   */
+  void analyze(const QList<AbstractFilter::Pointer>& filters);
+
+  /**
+   * @brief Returns the runs in pipeline order
+   * @return
+   */
+  const GroupList& getGroups() const;
+
+  /**
+   * @brief Returns the run that starts with the filter at index or nullptr if none does
+   * @param index
+   * @return
+   */
+  const Group* getGroupStartingAt(size_t index) const;
+
+  /**
+   * @brief Runs the kernels block by block over the tuples [0, numTuples)
+   * @param kernels
+   * @param numTuples
+   */
+  static void Execute(const KernelList& kernels, size_t numTuples);
+
+private:
+  GroupList m_Groups;
+
+public:
+  ElementWiseFusion(const ElementWiseFusion&) = delete;            // Copy Constructor Not Implemented
+  ElementWiseFusion(ElementWiseFusion&&) = delete;                 // Move Constructor Not Implemented
+  ElementWiseFusion& operator=(const ElementWiseFusion&) = delete; // Copy Assignment Not Implemented
+  ElementWiseFusion& operator=(ElementWiseFusion&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,76 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The ElementWiseKernel class is the per tuple work of an element-wise filter,
+ * one whose output for a tuple only depends on the same tuple of its inputs. A filter
+ * returns one from AbstractFilter::createElementWiseKernel() once it has checked its
+ * inputs and created its outputs. FilterPipeline then walks the tuples once for a whole
+ * run of such filters and calls each kernel on the same block of tuples in pipeline
+ * order, see ElementWiseFusion.
+ *
+ * process() is called from several threads at once for ranges that do not overlap. A
+ * range may start at any tuple.
+ */
+class SIMPLib_EXPORT ElementWiseKernel
+{
+public:
+  SIMPL_SHARED_POINTERS(ElementWiseKernel)
+  SIMPL_TYPE_MACRO(ElementWiseKernel)
+
+  virtual ~ElementWiseKernel();
+
+  /**
+   * @brief Processes the tuples from start up to but not including end
+   * @param start
+   * @param end
+   */
+  virtual void process(size_t start, size_t end) const = 0;
+
+protected:
+  ElementWiseKernel();
+
+public:
+  ElementWiseKernel(const ElementWiseKernel&) = delete;            // Copy Constructor Not Implemented
+  ElementWiseKernel(ElementWiseKernel&&) = delete;                 // Move Constructor Not Implemented
+  ElementWiseKernel& operator=(const ElementWiseKernel&) = delete; // Copy Assignment Not Implemented
+  ElementWiseKernel& operator=(ElementWiseKernel&&) = delete;      // Move Assignment Not Implemented
+};
@@ -35,6 +35,18 @@
 
 #include "FilterPipeline.h"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <QtCore/QStringList>
+
+#include "SIMPLib/Common/MessageBus.h"
 #include "SIMPLib/Messages/AbstractMessageHandler.h"
 #include "SIMPLib/Messages/FilterProgressMessage.h"
 #include "SIMPLib/Messages/FilterErrorMessage.h"
@@ -45,12 +57,15 @@
 #include "SIMPLib/Messages/PipelineStatusMessage.h"
 #include "SIMPLib/Messages/PipelineWarningMessage.h"
 #include "SIMPLib/CoreFilters/EmptyFilter.h"
+#include "SIMPLib/Filtering/ArrayLivenessAnalysis.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/PipelineDependencyGraph.h"
 
 #include "SIMPLib/CoreFilters/DataContainerReader.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Utilities/StringOperations.h"
+#include "SIMPLib/Utilities/ThreadScheduler.h"
 
 #define RENAME_ENABLED 1
 
@@ -90,7 +105,8 @@ class PipelineIdleException : public std::exception
 //
 // -----------------------------------------------------------------------------
 FilterPipeline::FilterPipeline()
-: m_PipelineName("")
+: m_FuseElementWiseFilters(false)
+, m_PipelineName("")
 , m_Dca(nullptr)
 {
 }
@@ -233,10 +249,14 @@ void FilterPipeline::fromJson(const QJsonObject& json, IObserver* obs)
   // Clear the pipeline first
   clear();
 
-  // Store FilterManager
+  // Store FilterManager. Only register the EmptyFilter factory once so pipelines can be
+  // read on several threads after the first one.
   FilterManager* filtManager = FilterManager::Instance();
-  FilterFactory<EmptyFilter>::Pointer emptyFilterFactory = FilterFactory<EmptyFilter>::New();
-  filtManager->addFilterFactory("EmptyFilter", emptyFilterFactory);
+  if(nullptr == filtManager->getFactoryFromClassName("EmptyFilter").get())
+  {
+    FilterFactory<EmptyFilter>::Pointer emptyFilterFactory = FilterFactory<EmptyFilter>::New();
+    filtManager->addFilterFactory("EmptyFilter", emptyFilterFactory);
+  }
 
   QJsonObject builderObj = json[SIMPL::Settings::PipelineBuilderGroup].toObject();
   int filterCount = builderObj[SIMPL::Settings::NumFilters].toInt();
@@ -351,6 +371,14 @@ void FilterPipeline::cancel()
   {
     m_CurrentFilter->setCancel(true);
   }
+  if(m_ExecutionMode == FilterPipeline::ExecutionMode::Parallel)
+  {
+    // Any number of filters may be running so tell all of them
+    for(const auto& filt : m_Pipeline)
+    {
+      filt->setCancel(true);
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -714,6 +742,14 @@ void FilterPipeline::disconnectFilterNotifications(AbstractFilter* filter)
 //
 // -----------------------------------------------------------------------------
 int FilterPipeline::preflightPipeline()
+{
+  return preflightFilters(true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FilterPipeline::preflightFilters(bool useCache)
 {
   if(m_State != FilterPipeline::State::Idle)
   {
@@ -724,33 +760,93 @@ int FilterPipeline::preflightPipeline()
     return err;
   }
 
-  // Create the DataContainer object
-  DataContainerArray::Pointer dca = DataContainerArray::New();
+  // The working DataContainerArray is only created, or copied from the last cached
+  // snapshot, once a filter actually has to be preflighted
+  DataContainerArray::Pointer dca;
+  DataContainerArray::Pointer snapshot = DataContainerArray::New();
+  QByteArray structureKey = PreflightCache::CreateStructureKey(snapshot);
 
   clearErrorCode();
   int preflightError = 0;
 
   DataArrayPath::RenameContainer renamedPaths;
 
+  m_PreflightCache.truncate(static_cast<size_t>(m_Pipeline.size()));
+
   // Start looping through each filter in the Pipeline and preflight everything
-  for(const auto& filter : m_Pipeline)
+  for(int i = 0; i < m_Pipeline.size(); i++)
   {
+    const AbstractFilter::Pointer& filter = m_Pipeline[i];
     // Do not preflight disabled filters
     if(filter->getEnabled())
     {
-      filter->setDataContainerArray(dca);
+      filter->setDataContainerArray(nullptr != dca.get() ? dca : snapshot);
 #if RENAME_ENABLED
       filter->renameDataArrayPaths(renamedPaths);
 #endif
       setCurrentFilter(filter);
-      connectFilterNotifications(filter.get());
-      filter->clearRenamedPaths();
-      filter->preflight();
-      disconnectFilterNotifications(filter.get());
+      QByteArray parameterKey = PreflightCache::CreateParameterKey(filter.get());
+      const PreflightCache::Entry* entry = useCache ? m_PreflightCache.find(static_cast<size_t>(i), filter, parameterKey, structureKey) : nullptr;
+      if(nullptr != entry)
+      {
+        // Same parameters and same incoming structure so hand back the last result
+        filter->clearErrorCode();
+        filter->clearWarningCode();
+        connectFilterNotifications(filter.get());
+        for(const auto& warning : entry->Warnings)
+        {
+          filter->setWarningCondition(warning.first, warning.second);
+        }
+        disconnectFilterNotifications(filter.get());
+
+        snapshot = entry->Snapshot;
+        structureKey = entry->OutputStructure;
+        dca.reset();
+        filter->setDataContainerArray(snapshot);
+      }
+      else
+      {
+        if(nullptr == dca.get())
+        {
+          dca = snapshot->deepCopy(false);
+          filter->setDataContainerArray(dca);
+        }
+
+        PreflightCache::Entry newEntry;
+        newEntry.Filter = filter;
+        newEntry.InputStructure = structureKey;
+
+        connectFilterNotifications(filter.get());
+        connect(filter.get(), &AbstractFilter::messageGenerated, [&newEntry](const AbstractMessage::Pointer& msg) {
+          auto warning = std::dynamic_pointer_cast<FilterWarningMessage>(msg);
+          if(nullptr != warning)
+          {
+            newEntry.Warnings.push_back(std::make_pair(warning->getCode(), warning->getMessageText()));
+          }
+        });
+        filter->clearRenamedPaths();
+        filter->preflight();
+        disconnectFilterNotifications(filter.get());
+
+        filter->setCancel(false); // Reset the cancel flag
+        snapshot = dca->deepCopy(false);
+        structureKey = PreflightCache::CreateStructureKey(snapshot);
+        filter->setDataContainerArray(snapshot);
 
-      filter->setCancel(false); // Reset the cancel flag
+        if(filter->getErrorCode() < 0)
+        {
+          m_PreflightCache.remove(static_cast<size_t>(i));
+        }
+        else
+        {
+          // Some filters update their own parameters while preflighting
+          newEntry.Parameters = PreflightCache::CreateParameterKey(filter.get());
+          newEntry.OutputStructure = structureKey;
+          newEntry.Snapshot = snapshot;
+          m_PreflightCache.store(static_cast<size_t>(i), std::move(newEntry));
+        }
+      }
       preflightError |= filter->getErrorCode();
-      filter->setDataContainerArray(dca->deepCopy(false));
 #if RENAME_ENABLED
       const std::list<DataArrayPath> deletedPaths = filter->getDeletedPaths();
 
@@ -793,7 +889,7 @@ int FilterPipeline::preflightPipeline()
     else
     {
       // Some widgets require the updated path to be valid before it can be set in the widget
-      filter->setDataContainerArray(dca->deepCopy(false));
+      filter->setDataContainerArray(snapshot);
       filter->renameDataArrayPaths(renamedPaths);
 
       // Undo filter renaming
@@ -813,6 +909,14 @@ int FilterPipeline::preflightPipeline()
   return preflightError;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::clearPreflightCache()
+{
+  m_PreflightCache.clear();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -838,6 +942,43 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
 
   int err = 0;
 
+  // The parallel algorithms of the filters run in this arena, which keeps them within the thread limit
+  ThreadScheduler* scheduler = ThreadScheduler::Instance();
+  uint32_t maxThreads = (m_MaxThreads > 0) ? m_MaxThreads : scheduler->getMaxThreadsPerPipeline();
+  m_ThreadArena = (maxThreads > 0) ? scheduler->createArena(maxThreads) : ThreadScheduler::CurrentArena();
+  ThreadScheduler::Scope threadScope(m_ThreadArena);
+
+  if(nullptr != m_Profile.get())
+  {
+    m_Profile->start(getName());
+  }
+
+  m_ReleasedArrayCount = 0;
+  m_ReleasedBytes = 0;
+  m_PeakBytesSaved = 0;
+  m_PeakResidentBytes = 0;
+  m_PeakUnreleasedBytes = 0;
+  m_CoalescedMessageCount = 0;
+  m_DroppedMessageCount = 0;
+
+  PipelineDependencyGraph graph;
+  bool useGraph = (m_ExecutionMode == FilterPipeline::ExecutionMode::Parallel) && nullptr == m_ResultCache.get() && getFilterConcurrency() > 1 && buildDependencyGraph(graph);
+
+  // The liveness analysis reads the structure each filter leaves behind from its preflight
+  ArrayLivenessAnalysis liveness;
+  if(m_ReleaseUnusedArrays && (useGraph || preflightQuietly()))
+  {
+    liveness.analyze(m_Pipeline, m_KeptArrayPaths);
+  }
+
+  // Fused filters run in one pass, which the result cache cannot record filter by filter
+  ElementWiseFusion fusion;
+  m_FusedFilterGroups.clear();
+  if(m_FuseElementWiseFilters && !useGraph && nullptr == m_ResultCache.get())
+  {
+    fusion.analyze(m_Pipeline);
+  }
+
   connectSignalsSlots();
 
   m_ExecutionResult = FilterPipeline::ExecutionResult::Invalid;
@@ -846,57 +987,132 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
 
   m_Dca = dca;
 
-  // Start looping through the Pipeline
-  for(const auto& filt : m_Pipeline)
+  if(useGraph)
   {
-    int filtIndex = filt->getPipelineIndex();
-    QString ss = QObject::tr("[%1/%2] %3").arg(filtIndex+1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
-    notifyStatusMessage(ss);
-
-    emit filt->filterInProgress(filt.get());
-
-    // Do not execute disabled filters
-    if(filt->getEnabled())
+    if(!executeFilterGraph(graph, liveness))
     {
-//      filt->setMessagePrefix(ss);
-      connectFilterNotifications(filt.get());
-      filt->setDataContainerArray(m_Dca);
-      setCurrentFilter(filt);
-      filt->execute();
-      disconnectFilterNotifications(filt.get());
-      filt->setDataContainerArray(DataContainerArray::NullPointer());
-      err = filt->getErrorCode();
-      if(err < 0)
+      return m_Dca;
+    }
+  }
+  else
+  {
+    // Start looping through the Pipeline
+    size_t fusedFiltersLeft = 0;
+    for(const auto& filt : m_Pipeline)
+    {
+      int filtIndex = filt->getPipelineIndex();
+      if(fusedFiltersLeft > 0)
+      {
+        // Already executed as part of the fused run before it
+        fusedFiltersLeft--;
+        continue;
+      }
+      const ElementWiseFusion::Group* group = fusion.getGroupStartingAt(static_cast<size_t>(filtIndex));
+      if(nullptr != group)
       {
-        ss = QObject::tr("[%1/%2] %3 caused an error during execution.").arg(filtIndex+1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
-        setErrorCondition(err, ss);
+        if(!executeFusedGroup(*group, liveness))
+        {
+          return m_Dca;
+        }
+        if(m_State == FilterPipeline::State::Canceling)
+        {
+          for(size_t index : group->FilterIndices)
+          {
+            m_Pipeline[static_cast<int>(index)]->setCancel(false);
+          }
+          break;
+        }
+        fusedFiltersLeft = group->FilterIndices.size() - 1;
+        continue;
+      }
+
+      QString ss = QObject::tr("[%1/%2] %3").arg(filtIndex+1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
+      notifyStatusMessage(ss);
 
-        notifyProgressMessage(100, "");
+      emit filt->filterInProgress(filt.get());
 
-        emit filt->filterCompleted(filt.get());
-        emit pipelineFinished();
-        disconnectSignalsSlots();
-        m_State = FilterPipeline::State::Idle;
-        m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
-        return m_Dca;
+      // Do not execute disabled filters
+      if(filt->getEnabled())
+      {
+//      filt->setMessagePrefix(ss);
+        connectFilterNotifications(filt.get());
+        filt->setDataContainerArray(m_Dca);
+        setCurrentFilter(filt);
+        PipelineProfile::Sample begin;
+        if(nullptr != m_Profile.get())
+        {
+          begin = m_Profile->takeSample();
+        }
+        QByteArray resultKey;
+        if(nullptr != m_ResultCache.get())
+        {
+          resultKey = m_ResultCache->createKey(filt.get(), m_Dca);
+        }
+        bool restored = !resultKey.isEmpty() && m_ResultCache->restore(resultKey, m_Dca);
+        if(restored)
+        {
+          filt->clearErrorCode();
+          filt->clearWarningCode();
+          notifyStatusMessage(QObject::tr("%1 was restored from the result cache").arg(ss));
+        }
+        else
+        {
+          std::list<DataArrayPath> pathsBefore;
+          if(!resultKey.isEmpty())
+          {
+            pathsBefore = m_Dca->getDescendantPaths();
+          }
+          executeFilter(filt.get());
+          if(!resultKey.isEmpty() && filt->getErrorCode() >= 0 && m_State != FilterPipeline::State::Canceling)
+          {
+            m_ResultCache->store(resultKey, filt.get(), pathsBefore, m_Dca);
+          }
+        }
+        if(nullptr != m_Profile.get())
+        {
+          m_Profile->addFilterRecord(filt.get(), begin, m_Profile->takeSample(), 1, PipelineProfile::CountArrays(m_Dca), restored);
+        }
+        disconnectFilterNotifications(filt.get());
+        filt->setDataContainerArray(DataContainerArray::NullPointer());
+        err = filt->getErrorCode();
+        if(err < 0)
+        {
+          notifyFilterFailed(filt);
+          return m_Dca;
+        }
+        if(liveness.size() > 0)
+        {
+          sampleMemoryUsage();
+          releaseArrays(liveness.getReleasesAfter(static_cast<size_t>(filtIndex)));
+        }
       }
-    }
 
-    if(m_State == FilterPipeline::State::Canceling)
-    {
-      // Clear cancel filter state
-      filt->setCancel(false);
-      break;
-    }
+      if(m_State == FilterPipeline::State::Canceling)
+      {
+        // Clear cancel filter state
+        filt->setCancel(false);
+        break;
+      }
 
-    // Emit that the filter is completed for those objects that care, even the disabled ones.
-    emit filt->filterCompleted(filt.get());
+      // Emit that the filter is completed for those objects that care, even the disabled ones.
+      emit filt->filterCompleted(filt.get());
 
-    notifyProgressMessage(static_cast<int>(static_cast<float>(filtIndex + 1) / (m_Pipeline.size()) * 100.0f), "");
+      notifyProgressMessage(static_cast<int>(static_cast<float>(filtIndex + 1) / (m_Pipeline.size()) * 100.0f), "");
+    }
   }
 
   disconnectSignalsSlots();
 
+  if(m_ReleasedArrayCount > 0)
+  {
+    sampleMemoryUsage();
+    m_PeakBytesSaved = m_PeakUnreleasedBytes - m_PeakResidentBytes;
+    notifyStatusMessage(QObject::tr("Released %1 unused arrays (%2 MB) early, lowering the peak memory use by %3 MB")
+                            .arg(m_ReleasedArrayCount)
+                            .arg(static_cast<double>(m_ReleasedBytes) / (1024.0 * 1024.0), 0, 'f', 2)
+                            .arg(static_cast<double>(m_PeakBytesSaved) / (1024.0 * 1024.0), 0, 'f', 2));
+  }
+
   switch(m_State)
   {
   case FilterPipeline::State::Canceling:
@@ -914,11 +1130,497 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
 
   m_State = FilterPipeline::State::Idle;
 
+  if(nullptr != m_Profile.get())
+  {
+    m_Profile->finish();
+  }
+
   emit pipelineFinished();
 
   return m_Dca;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::executeFilter(AbstractFilter* filter)
+{
+  if(m_MessageDrainInterval <= 0)
+  {
+    filter->execute();
+    return;
+  }
+
+  MessageBus bus;
+  filter->setMessageBus(&bus);
+
+  std::mutex mutex;
+  std::condition_variable finishedCondition;
+  bool finished = false;
+  ThreadScheduler::Arena::Pointer arena = ThreadScheduler::CurrentArena();
+  std::thread worker([&mutex, &finishedCondition, &finished, filter, arena]() {
+    ThreadScheduler::Scope threadScope(arena);
+    filter->execute();
+    std::lock_guard<std::mutex> lock(mutex);
+    finished = true;
+    finishedCondition.notify_one();
+  });
+
+  // Deliver from this thread so the receivers see the messages where they always have
+  bool done = false;
+  while(!done)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      finishedCondition.wait_for(lock, std::chrono::milliseconds(m_MessageDrainInterval), [&finished] { return finished; });
+      done = finished;
+    }
+    bus.drain();
+  }
+  worker.join();
+
+  filter->setMessageBus(nullptr);
+  m_CoalescedMessageCount += bus.getCoalescedCount();
+  m_DroppedMessageCount += bus.getDroppedCount();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::notifyFilterFailed(const AbstractFilter::Pointer& filt)
+{
+  int filtIndex = filt->getPipelineIndex();
+  QString ss = QObject::tr("[%1/%2] %3 caused an error during execution.").arg(filtIndex+1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
+  setErrorCondition(filt->getErrorCode(), ss);
+
+  notifyProgressMessage(100, "");
+
+  if(nullptr != m_Profile.get())
+  {
+    m_Profile->finish();
+  }
+
+  emit filt->filterCompleted(filt.get());
+  emit pipelineFinished();
+  disconnectSignalsSlots();
+  m_State = FilterPipeline::State::Idle;
+  m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t FilterPipeline::getFilterConcurrency() const
+{
+  size_t hardwareThreads = ThreadScheduler::Instance()->getMaxConcurrency();
+  if(m_MaxConcurrentFilters == 0)
+  {
+    return hardwareThreads;
+  }
+  return std::min(static_cast<size_t>(m_MaxConcurrentFilters), hardwareThreads);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::preflightQuietly()
+{
+  // The preflight only gathers what each filter touches so keep its messages from the receivers
+  QVector<QObject*> messageReceivers;
+  messageReceivers.swap(m_MessageReceivers);
+  int err = preflightFilters(false);
+  messageReceivers.swap(m_MessageReceivers);
+  return err >= 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::buildDependencyGraph(PipelineDependencyGraph& graph)
+{
+  if(!preflightQuietly())
+  {
+    return false;
+  }
+
+  graph.build(m_Pipeline);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::executeFilterGraph(const PipelineDependencyGraph& graph, const ArrayLivenessAnalysis& liveness)
+{
+  const size_t numFilters = static_cast<size_t>(m_Pipeline.size());
+  const size_t maxRunning = getFilterConcurrency();
+
+  // Shared with the filter threads
+  std::mutex mutex;
+  std::condition_variable finishedCondition;
+  std::deque<size_t> finished;
+  std::vector<std::vector<AbstractMessage::Pointer>> messages(numFilters);
+
+  std::vector<std::thread> threads(numFilters);
+  // Only the collecting connection is removed when a filter finishes, observers of the filter stay connected
+  std::vector<QMetaObject::Connection> collectors(numFilters);
+  // The filter threads run their parallel algorithms in the arena of the pipeline
+  ThreadScheduler::Arena::Pointer arena = ThreadScheduler::CurrentArena();
+  // Profile samples are written by the filter's thread and read once it is joined
+  PipelineProfile* profile = m_Profile.get();
+  std::vector<PipelineProfile::Sample> profileBegins(numFilters);
+  std::vector<PipelineProfile::Sample> profileEnds(numFilters);
+  std::vector<size_t> arrayCounts(numFilters, 0);
+  std::vector<int> lanes(numFilters, 0);
+  std::vector<bool> lanesInUse(maxRunning, false);
+  std::vector<size_t> pendingDependencies(numFilters, 0);
+  std::vector<bool> done(numFilters, false);
+  std::set<size_t> ready;
+  for(size_t i = 0; i < numFilters; i++)
+  {
+    if(!m_Pipeline[static_cast<int>(i)]->getEnabled())
+    {
+      done[i] = true;
+      continue;
+    }
+    pendingDependencies[i] = graph.getDependencies(i).size();
+    if(pendingDependencies[i] == 0)
+    {
+      ready.insert(i);
+    }
+  }
+
+  // Arrays whose last reader has finished. Removing an array changes its AttributeMatrix,
+  // so it waits until no running filter works inside that AttributeMatrix and filters
+  // that would work there are not started until it is done.
+  std::vector<DataArrayPath> pendingReleases;
+  auto touchesArray = [&graph](size_t index, const DataArrayPath& path) {
+    if(graph.isBarrier(index))
+    {
+      return true;
+    }
+    DataArrayPath amPath(path.getDataContainerName(), path.getAttributeMatrixName(), "");
+    const PipelineDependencyGraph::PathList& footprint = graph.getFootprint(index);
+    return std::any_of(footprint.begin(), footprint.end(), [&amPath](const DataArrayPath& other) { return PipelineDependencyGraph::PathsOverlap(amPath, other); });
+  };
+
+  size_t running = 0;
+  size_t nextToReport = 0;
+  size_t failedIndex = numFilters;
+  bool stopReporting = false;
+  while(true)
+  {
+    if(!pendingReleases.empty())
+    {
+      if(running == 0)
+      {
+        // Walking the whole DataContainerArray is only safe while no filter is running
+        sampleMemoryUsage();
+      }
+      std::vector<DataArrayPath> releasable;
+      std::vector<DataArrayPath> blocked;
+      for(const DataArrayPath& path : pendingReleases)
+      {
+        bool busy = false;
+        for(size_t i = 0; i < numFilters && !busy; i++)
+        {
+          busy = threads[i].joinable() && touchesArray(i, path);
+        }
+        if(busy)
+        {
+          blocked.push_back(path);
+        }
+        else
+        {
+          releasable.push_back(path);
+        }
+      }
+      releaseArrays(releasable);
+      pendingReleases.swap(blocked);
+    }
+
+    // Start ready filters lowest index first. Once a filter has failed only the filters
+    // before it still run, so the reported failure is the one a serial run would hit.
+    for(auto iter = ready.begin(); iter != ready.end() && running < maxRunning && m_State != FilterPipeline::State::Canceling && *iter < failedIndex;)
+    {
+      size_t index = *iter;
+      if(std::any_of(pendingReleases.begin(), pendingReleases.end(), [&touchesArray, index](const DataArrayPath& path) { return touchesArray(index, path); }))
+      {
+        ++iter;
+        continue;
+      }
+      iter = ready.erase(iter);
+      AbstractFilter::Pointer filt = m_Pipeline[static_cast<int>(index)];
+      if(nullptr != profile)
+      {
+        // The preflight structure is what the filter leaves behind, counting m_Dca would race the running filters
+        arrayCounts[index] = PipelineProfile::CountArrays(filt->getDataContainerArray());
+        size_t lane = static_cast<size_t>(std::distance(lanesInUse.begin(), std::find(lanesInUse.begin(), lanesInUse.end(), false)));
+        lanesInUse[lane] = true;
+        lanes[index] = static_cast<int>(lane) + 1;
+      }
+      filt->setDataContainerArray(m_Dca);
+      collectors[index] = connect(filt.get(), &AbstractFilter::messageGenerated, [&mutex, &messages, index](const AbstractMessage::Pointer& msg) {
+        std::lock_guard<std::mutex> lock(mutex);
+        messages[index].push_back(msg);
+      });
+      running++;
+      threads[index] = std::thread([&mutex, &finished, &finishedCondition, &profileBegins, &profileEnds, profile, filt, index, arena]() {
+        ThreadScheduler::Scope threadScope(arena);
+        if(nullptr != profile)
+        {
+          profileBegins[index] = profile->takeSample();
+        }
+        filt->execute();
+        if(nullptr != profile)
+        {
+          profileEnds[index] = profile->takeSample();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        finished.push_back(index);
+        finishedCondition.notify_one();
+      });
+    }
+
+    // Deliver everything the finished filters said, in pipeline order
+    while(!stopReporting && nextToReport < numFilters && done[nextToReport])
+    {
+      const auto& filt = m_Pipeline[static_cast<int>(nextToReport)];
+      int filtIndex = filt->getPipelineIndex();
+      QString ss = QObject::tr("[%1/%2] %3").arg(filtIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
+      notifyStatusMessage(ss);
+
+      emit filt->filterInProgress(filt.get());
+
+      if(filt->getEnabled())
+      {
+        setCurrentFilter(filt);
+        connectFilterNotifications(filt.get());
+        for(const auto& msg : messages[nextToReport])
+        {
+          emit filt->messageGenerated(msg);
+        }
+        disconnectFilterNotifications(filt.get());
+        messages[nextToReport].clear();
+        if(filt->getErrorCode() < 0)
+        {
+          stopReporting = true;
+          break;
+        }
+      }
+
+      if(m_State == FilterPipeline::State::Canceling)
+      {
+        stopReporting = true;
+        break;
+      }
+
+      // Emit that the filter is completed for those objects that care, even the disabled ones.
+      emit filt->filterCompleted(filt.get());
+
+      notifyProgressMessage(static_cast<int>(static_cast<float>(filtIndex + 1) / (m_Pipeline.size()) * 100.0f), "");
+      nextToReport++;
+    }
+
+    if(running == 0)
+    {
+      break;
+    }
+
+    std::deque<size_t> completed;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      finishedCondition.wait(lock, [&finished] { return !finished.empty(); });
+      completed.swap(finished);
+    }
+    for(size_t index : completed)
+    {
+      threads[index].join();
+      running--;
+      done[index] = true;
+      AbstractFilter::Pointer filt = m_Pipeline[static_cast<int>(index)];
+      disconnect(collectors[index]);
+      filt->setDataContainerArray(DataContainerArray::NullPointer());
+      if(nullptr != profile)
+      {
+        profile->addFilterRecord(filt.get(), profileBegins[index], profileEnds[index], lanes[index], arrayCounts[index], false);
+        lanesInUse[static_cast<size_t>(lanes[index] - 1)] = false;
+      }
+      if(filt->getErrorCode() < 0)
+      {
+        failedIndex = std::min(failedIndex, index);
+        continue;
+      }
+      for(size_t dependent : graph.getDependents(index))
+      {
+        pendingDependencies[dependent]--;
+        if(pendingDependencies[dependent] == 0)
+        {
+          ready.insert(dependent);
+        }
+      }
+      if(liveness.size() > 0)
+      {
+        const ArrayLivenessAnalysis::PathList& releases = liveness.getReleasesAfter(index);
+        pendingReleases.insert(pendingReleases.end(), releases.begin(), releases.end());
+      }
+    }
+  }
+
+  if(m_State == FilterPipeline::State::Canceling)
+  {
+    // Clear cancel filter state
+    for(const auto& filt : m_Pipeline)
+    {
+      filt->setCancel(false);
+    }
+  }
+  if(failedIndex < numFilters && nextToReport == failedIndex)
+  {
+    notifyFilterFailed(m_Pipeline[static_cast<int>(failedIndex)]);
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::executeFusedGroup(const ElementWiseFusion::Group& group, const ArrayLivenessAnalysis& liveness)
+{
+  const size_t numFilters = group.FilterIndices.size();
+  std::vector<PipelineProfile::Sample> begins(numFilters);
+  std::vector<PipelineProfile::Sample> ends(numFilters);
+  ElementWiseFusion::KernelList kernels;
+  QStringList labels;
+
+  auto executeKernels = [this, &group, &kernels] {
+    AttributeMatrix::Pointer am = m_Dca->getAttributeMatrix(group.AttributeMatrixPath);
+    ElementWiseFusion::Execute(kernels, nullptr != am.get() ? am->getNumberOfTuples() : 0);
+    kernels.clear();
+  };
+
+  // Every filter checks its inputs and creates its outputs before the single pass runs
+  for(size_t i = 0; i < numFilters; i++)
+  {
+    const AbstractFilter::Pointer& filt = m_Pipeline[static_cast<int>(group.FilterIndices[i])];
+    QString ss = QObject::tr("[%1/%2] %3").arg(filt->getPipelineIndex() + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
+    notifyStatusMessage(ss);
+    labels.push_back(ss);
+
+    emit filt->filterInProgress(filt.get());
+
+    connectFilterNotifications(filt.get());
+    filt->setDataContainerArray(m_Dca);
+    setCurrentFilter(filt);
+    if(nullptr != m_Profile.get())
+    {
+      begins[i] = m_Profile->takeSample();
+    }
+
+    ElementWiseKernel::Pointer kernel = filt->createElementWiseKernel();
+    if(nullptr != kernel.get())
+    {
+      kernels.push_back(kernel);
+    }
+    else if(filt->getErrorCode() >= 0)
+    {
+      // The filter has to execute on its own, after the kernels of the filters before it
+      executeKernels();
+      filt->execute();
+    }
+    if(i + 1 == numFilters && filt->getErrorCode() >= 0)
+    {
+      executeKernels();
+    }
+
+    if(nullptr != m_Profile.get())
+    {
+      ends[i] = m_Profile->takeSample();
+    }
+    if(filt->getErrorCode() < 0)
+    {
+      // Run on their own the filters before this one would have completed, so finish their
+      // pass instead of leaving the arrays they created allocated but never filled
+      executeKernels();
+      for(size_t j = 0; j <= i; j++)
+      {
+        const AbstractFilter::Pointer& done = m_Pipeline[static_cast<int>(group.FilterIndices[j])];
+        disconnectFilterNotifications(done.get());
+        done->setDataContainerArray(DataContainerArray::NullPointer());
+      }
+      notifyFilterFailed(filt);
+      return false;
+    }
+  }
+
+  notifyStatusMessage(QObject::tr("Fused %1 into one pass over %2").arg(labels.join(", ")).arg(group.AttributeMatrixPath.serialize()));
+  m_FusedFilterGroups.push_back(group);
+
+  for(size_t i = 0; i < numFilters; i++)
+  {
+    const AbstractFilter::Pointer& filt = m_Pipeline[static_cast<int>(group.FilterIndices[i])];
+    if(nullptr != m_Profile.get())
+    {
+      m_Profile->addFilterRecord(filt.get(), begins[i], ends[i], 1, PipelineProfile::CountArrays(m_Dca), false);
+    }
+    disconnectFilterNotifications(filt.get());
+    filt->setDataContainerArray(DataContainerArray::NullPointer());
+  }
+
+  if(liveness.size() > 0)
+  {
+    sampleMemoryUsage();
+    for(size_t index : group.FilterIndices)
+    {
+      releaseArrays(liveness.getReleasesAfter(index));
+    }
+  }
+
+  if(m_State == FilterPipeline::State::Canceling)
+  {
+    return true;
+  }
+
+  for(size_t index : group.FilterIndices)
+  {
+    const AbstractFilter::Pointer& filt = m_Pipeline[static_cast<int>(index)];
+    emit filt->filterCompleted(filt.get());
+    notifyProgressMessage(static_cast<int>(static_cast<float>(index + 1) / (m_Pipeline.size()) * 100.0f), "");
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::releaseArrays(const std::vector<DataArrayPath>& paths)
+{
+  for(const DataArrayPath& path : paths)
+  {
+    AttributeMatrix::Pointer am = m_Dca->getAttributeMatrix(path);
+    if(nullptr == am.get() || !am->doesAttributeArrayExist(path.getDataArrayName()))
+    {
+      continue;
+    }
+    IDataArray::Pointer array = am->removeAttributeArray(path.getDataArrayName());
+    m_ReleasedBytes += array->getUniqueByteCount();
+    m_ReleasedArrayCount++;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::sampleMemoryUsage()
+{
+  size_t residentBytes = m_Dca->getUniqueByteCount();
+  m_PeakResidentBytes = std::max(m_PeakResidentBytes, residentBytes);
+  // Without the releases the released arrays would still be resident
+  m_PeakUnreleasedBytes = std::max(m_PeakUnreleasedBytes, residentBytes + m_ReleasedBytes);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
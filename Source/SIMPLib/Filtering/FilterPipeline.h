@@ -35,19 +35,30 @@
 
 #pragma once
 
+#include <vector>
+
 #include <QtCore/QJsonObject>
 #include <QtCore/QList>
 #include <QtCore/QObject>
 #include <QtCore/QString>
 #include <QtCore/QTextStream>
+#include <QtCore/QVector>
 
 #include "SIMPLib/Common/Observer.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/ElementWiseFusion.h"
+#include "SIMPLib/Filtering/PipelineProfile.h"
+#include "SIMPLib/Filtering/PipelineResultCache.h"
+#include "SIMPLib/Filtering/PreflightCache.h"
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ThreadScheduler.h"
 
 class IObserver;
 class FilterPipelineMessageHandler;
+class PipelineDependencyGraph;
+class ArrayLivenessAnalysis;
 
 /**
  * @class FilterPipeline FilterPipeline.h DREAM3DLib/Common/FilterPipeline.h
@@ -106,6 +117,19 @@ public:
     Failed
   };
 
+  /**
+   * @brief Serial runs the filters one at a time in pipeline order. Parallel runs
+   * filters that do not touch the same parts of the DataContainerArray at the same
+   * time, see PipelineDependencyGraph. Filters that read or write files always run on
+   * their own. Messages and errors are still delivered in pipeline order, each filter's
+   * after the filters before it have finished.
+   */
+  enum class ExecutionMode : unsigned int
+  {
+    Serial,
+    Parallel
+  };
+
   typedef QList<AbstractFilter::Pointer> FilterContainerType;
 
   SIMPL_GET_PROPERTY(FilterPipeline::ExecutionResult, ExecutionResult)
@@ -114,6 +138,108 @@ public:
   SIMPL_GET_PROPERTY(int, WarningCode)
   SIMPL_INSTANCE_PROPERTY(AbstractFilter::Pointer, CurrentFilter)
 
+  /**
+   * @brief How execute() schedules the filters. The default is Serial.
+   */
+  SIMPL_INSTANCE_PROPERTY(FilterPipeline::ExecutionMode, ExecutionMode)
+
+  /**
+   * @brief The most filters that run at the same time in Parallel mode. 0 uses the
+   * thread limit of the pipeline, larger values are reduced to it.
+   */
+  SIMPL_INSTANCE_PROPERTY(uint32_t, MaxConcurrentFilters)
+
+  /**
+   * @brief The most threads the parallel algorithms of the filters use at once while
+   * execute() runs, counting the thread that calls it. 0, the default, uses
+   * ThreadScheduler::getMaxThreadsPerPipeline(), and when that is 0 as well the pipeline
+   * shares the threads of the arena it is executed from. Pipelines that run at the same
+   * time each get an arena of their own.
+   */
+  SIMPL_INSTANCE_PROPERTY(uint32_t, MaxThreads)
+
+  /**
+   * @brief The ThreadScheduler arena the last execute() ran in, whose statistics tell how
+   * busy its threads were
+   */
+  SIMPL_GET_PROPERTY(ThreadScheduler::Arena::Pointer, ThreadArena)
+
+  /**
+   * @brief When set, execute() restores filter results from the cache instead of
+   * executing filters whose inputs are unchanged and stores the results of the filters
+   * it does execute. Filters then run one at a time even in Parallel mode.
+   */
+  SIMPL_INSTANCE_PROPERTY(PipelineResultCache::Pointer, ResultCache)
+
+  /**
+   * @brief When set, execute() removes each attribute array the pipeline creates right
+   * after the last filter that reads it has executed, see ArrayLivenessAnalysis. Arrays
+   * no later filter reads are removed too, so list the arrays the caller needs from the
+   * returned DataContainerArray in KeptArrayPaths.
+   */
+  SIMPL_INSTANCE_PROPERTY(bool, ReleaseUnusedArrays)
+
+  /**
+   * @brief DataContainer, AttributeMatrix or attribute array paths whose arrays
+   * ReleaseUnusedArrays never removes
+   */
+  SIMPL_INSTANCE_PROPERTY(QVector<DataArrayPath>, KeptArrayPaths)
+
+  /**
+   * @brief The number of arrays the last execute() removed early, their size in bytes
+   * and how much that lowered the peak size of the DataContainerArray. Sizes count the
+   * bytes that are not shared with other arrays.
+   */
+  SIMPL_GET_PROPERTY(size_t, ReleasedArrayCount)
+  SIMPL_GET_PROPERTY(size_t, ReleasedBytes)
+  SIMPL_GET_PROPERTY(size_t, PeakBytesSaved)
+
+  /**
+   * @brief When set, execute() records the time and memory each filter it executes
+   * takes in the profile, replacing what an earlier run recorded there.
+   */
+  SIMPL_INSTANCE_PROPERTY(PipelineProfile::Pointer, Profile)
+
+  /**
+   * @brief When set, execute() runs consecutive element-wise filters
+   * on the same AttributeMatrix, such as ConditionalSetValue, ReplaceValueInArray and
+   * MultiThresholdObjects2, as one multithreaded pass over the tuples instead of one pass
+   * per filter, see ElementWiseFusion. The results are the same either way. Filters are only
+   * fused while they run one at a time, so not with a ResultCache or when Parallel mode runs
+   * the dependency graph. A PipelineProfile charges each fused pass to the filter that
+   * completed it, usually the last one of the run. If a filter of a fused run fails, the
+   * filters before it still complete, just as when each filter executes on its own. The
+   * default is false.
+   */
+  SIMPL_INSTANCE_PROPERTY(bool, FuseElementWiseFilters)
+
+  /**
+   * @brief The runs of filters the last execute() fused, each with the pipeline index of
+   * its filters and the AttributeMatrix it walked
+   */
+  SIMPL_GET_PROPERTY(ElementWiseFusion::GroupList, FusedFilterGroups)
+
+  /**
+   * @brief When above 0, execute() runs each filter it executes one at a time on a worker
+   * thread that sends its messages through a MessageBus, and delivers them from the calling
+   * thread every MessageDrainInterval milliseconds, with repeated progress messages
+   * coalesced. The filter and its parallel algorithms may then report from any thread
+   * without waiting on the receivers. 0, the default, delivers every message as it is sent.
+   * Parallel mode keeps its own buffering of the filters it runs from the dependency graph.
+   */
+  SIMPL_INSTANCE_PROPERTY(int, MessageDrainInterval)
+
+  /**
+   * @brief The number of progress messages the last execute() coalesced into later ones
+   */
+  SIMPL_GET_PROPERTY(uint64_t, CoalescedMessageCount)
+
+  /**
+   * @brief The number of status and progress messages the last execute() dropped because
+   * the MessageBus of a filter was full
+   */
+  SIMPL_GET_PROPERTY(uint64_t, DroppedMessageCount)
+
   /**
    * @brief Returns true if the pipeline is executing
    * @return
@@ -145,10 +271,19 @@ public:
 
   /**
    * @brief This will preflight the pipeline and report any errors that would occur during
-   * execution of the pipeline
+   * execution of the pipeline. Filters whose parameters and incoming structure are
+   * unchanged since the last preflight are not preflighted again, see PreflightCache.
+   * Such filters keep the internal state of their earlier preflight, so execute() never
+   * relies on this: every preflight it runs itself preflights all filters.
    */
   virtual int preflightPipeline();
 
+  /**
+   * @brief Forgets the results of earlier preflights so the next preflightPipeline()
+   * preflights every filter
+   */
+  void clearPreflightCache();
+
   /**
    * @brief
    */
@@ -309,13 +444,101 @@ private:
   QVector<QObject*> m_MessageReceivers;
 
   DataContainerArray::Pointer m_Dca;
+  PreflightCache m_PreflightCache;
 
   int m_ErrorCode = 0;
   int m_WarningCode = 0;
 
+  size_t m_ReleasedArrayCount = 0;
+  size_t m_ReleasedBytes = 0;
+  size_t m_PeakBytesSaved = 0;
+  size_t m_PeakResidentBytes = 0;
+  size_t m_PeakUnreleasedBytes = 0;
+
+  ElementWiseFusion::GroupList m_FusedFilterGroups;
+
+  ThreadScheduler::Arena::Pointer m_ThreadArena;
+
+  uint64_t m_CoalescedMessageCount = 0;
+  uint64_t m_DroppedMessageCount = 0;
+
   void connectSignalsSlots();
   void disconnectSignalsSlots();
 
+  /**
+   * @brief Returns the number of filters Parallel mode may run at once
+   * @return
+   */
+  size_t getFilterConcurrency() const;
+
+  /**
+   * @brief Preflights the filters, see preflightPipeline()
+   * @param useCache Whether filters may be skipped when the PreflightCache has their
+   * result. Without the cache every filter runs its own preflight, so its internal state
+   * matches the DataContainerArray it is left with; the results are still cached.
+   * @return
+   */
+  int preflightFilters(bool useCache);
+
+  /**
+   * @brief Preflights every filter of the pipeline, without using the PreflightCache and
+   * without notifying the message receivers, so the filters hold the DataContainerArray
+   * they will leave behind.
+   * @return false if the pipeline did not preflight cleanly
+   */
+  bool preflightQuietly();
+
+  /**
+   * @brief Preflights the pipeline without notifying the message receivers and
+   * builds the dependency graph from the result.
+   * @param graph
+   * @return false if the pipeline did not preflight cleanly
+   */
+  bool buildDependencyGraph(PipelineDependencyGraph& graph);
+
+  /**
+   * @brief Runs the filters as their dependencies allow, reporting them in pipeline order.
+   * @param graph
+   * @param liveness The arrays to release after each filter, empty if none are
+   * @return false if a filter failed
+   */
+  bool executeFilterGraph(const PipelineDependencyGraph& graph, const ArrayLivenessAnalysis& liveness);
+
+  /**
+   * @brief Executes a run of element-wise filters as one pass over their AttributeMatrix,
+   * reporting each filter as the serial loop does.
+   * @param group
+   * @param liveness The arrays to release after each filter, empty if none are
+   * @return false if a filter failed
+   */
+  bool executeFusedGroup(const ElementWiseFusion::Group& group, const ArrayLivenessAnalysis& liveness);
+
+  /**
+   * @brief Executes the filter, on a worker thread whose messages are delivered every
+   * MessageDrainInterval milliseconds when that is above 0
+   * @param filter
+   */
+  void executeFilter(AbstractFilter* filter);
+
+  /**
+   * @brief Removes the arrays that still exist from the DataContainerArray being
+   * executed and adds them to the release statistics
+   * @param paths
+   */
+  void releaseArrays(const std::vector<DataArrayPath>& paths);
+
+  /**
+   * @brief Records the current size of the DataContainerArray being executed for
+   * the PeakBytesSaved statistic
+   */
+  void sampleMemoryUsage();
+
+  /**
+   * @brief Reports the filter's error and returns the pipeline to the idle state
+   * @param filt
+   */
+  void notifyFilterFailed(const AbstractFilter::Pointer& filt);
+
 public:
   FilterPipeline(const FilterPipeline&) = delete;            // Copy Constructor Not Implemented
   FilterPipeline(FilterPipeline&&) = delete;                 // Move Constructor Not Implemented
@@ -0,0 +1,385 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineBatch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#include <hdf5.h>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/DataArrays/DataArrayAllocator.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Messages/AbstractErrorMessage.h"
+#include "SIMPLib/Messages/AbstractWarningMessage.h"
+#include "SIMPLib/Utilities/StringOperations.h"
+
+namespace
+{
+/**
+ * @brief Keeps the errors of one job instead of printing them, since the output of
+ * jobs running at the same time would interleave
+ */
+class JobObserver : public Observer
+{
+public:
+  JobObserver() = default;
+  ~JobObserver() override = default;
+
+  void processPipelineMessage(const AbstractMessage::Pointer& pm) override
+  {
+    if(nullptr != std::dynamic_pointer_cast<AbstractErrorMessage>(pm).get())
+    {
+      m_Errors.push_back(pm->generateMessageString());
+    }
+    else if(nullptr != std::dynamic_pointer_cast<AbstractWarningMessage>(pm).get())
+    {
+      m_WarningCount++;
+    }
+  }
+
+  QStringList m_Errors;
+  int m_WarningCount = 0;
+
+public:
+  JobObserver(const JobObserver&) = delete;            // Copy Constructor Not Implemented
+  JobObserver(JobObserver&&) = delete;                 // Move Constructor Not Implemented
+  JobObserver& operator=(const JobObserver&) = delete; // Copy Assignment Not Implemented
+  JobObserver& operator=(JobObserver&&) = delete;      // Move Assignment Not Implemented
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineBatch::PipelineBatch(const QJsonObject& pipelineJson)
+: m_FuseElementWiseFilters(false)
+, m_PipelineJson(pipelineJson)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineBatch::~PipelineBatch() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineBatch::Pointer PipelineBatch::New(const QJsonObject& pipelineJson)
+{
+  Pointer sharedPtr(new PipelineBatch(pipelineJson));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatch::addJob(const Job& job)
+{
+  m_Jobs.push_back(job);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<PipelineBatch::Job>& PipelineBatch::getJobs() const
+{
+  return m_Jobs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<PipelineBatch::Result>& PipelineBatch::getResults() const
+{
+  return m_Results;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelineBatch::getJobConcurrency() const
+{
+#ifdef H5_HAVE_THREADSAFE
+  size_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  size_t jobs = (m_MaxConcurrentJobs == 0) ? hardwareThreads : static_cast<size_t>(m_MaxConcurrentJobs);
+  return std::max(std::min(jobs, m_Jobs.size()), static_cast<size_t>(1));
+#else
+  // Two jobs calling into a non thread safe HDF5 library at the same time corrupt its state
+  return 1;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<PipelineBatch::Result> PipelineBatch::run()
+{
+  auto start = std::chrono::steady_clock::now();
+  m_Results.assign(m_Jobs.size(), Result());
+
+  // Reading a pipeline registers the placeholder factory for unknown filters with the
+  // FilterManager. Do it once here so the workers only ever read the FilterManager.
+  FilterPipeline::FromJson(m_PipelineJson);
+
+  std::mutex mutex;
+  std::condition_variable jobFinished;
+  size_t nextJob = 0;
+  size_t runningJobs = 0;
+  auto overMemoryBudget = [this]() { return m_MaxMemoryBytes > 0 && DataArrayAllocator::GetGlobalStatistics().bytesLive >= m_MaxMemoryBytes; };
+
+  auto worker = [&]() {
+    while(true)
+    {
+      size_t index = 0;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        // The running jobs free memory without telling anyone, so check again now and then
+        while(nextJob < m_Jobs.size() && runningJobs > 0 && overMemoryBudget())
+        {
+          jobFinished.wait_for(lock, std::chrono::milliseconds(100));
+        }
+        if(nextJob >= m_Jobs.size())
+        {
+          return;
+        }
+        index = nextJob++;
+        runningJobs++;
+      }
+
+      runJob(m_Jobs[index], m_Results[index]);
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        runningJobs--;
+      }
+      jobFinished.notify_all();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  const size_t numWorkers = getJobConcurrency();
+  for(size_t i = 0; i < numWorkers; i++)
+  {
+    workers.emplace_back(worker);
+  }
+  for(auto& thread : workers)
+  {
+    thread.join();
+  }
+
+  m_WallTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+  return m_Results;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatch::runJob(const Job& job, Result& result) const
+{
+  auto start = std::chrono::steady_clock::now();
+  result.Name = job.Name;
+  result.StartTime = QDateTime::currentDateTime().toString(Qt::ISODate);
+  result.Status = "Failed";
+
+  QString errorMessage;
+  QJsonObject pipelineJson = ApplyOverrides(m_PipelineJson, job.Overrides, errorMessage);
+  FilterPipeline::Pointer pipeline;
+  if(errorMessage.isEmpty())
+  {
+    pipeline = FilterPipeline::FromJson(pipelineJson);
+    if(nullptr == pipeline.get())
+    {
+      errorMessage = QObject::tr("The pipeline could not be created from the pipeline JSON");
+    }
+  }
+  if(!errorMessage.isEmpty())
+  {
+    result.ErrorCode = -1;
+    result.Errors.push_back(errorMessage);
+    result.WallTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    return;
+  }
+
+  pipeline->setFuseElementWiseFilters(m_FuseElementWiseFilters);
+
+  JobObserver obs;
+  pipeline->addMessageReceiver(&obs);
+  int err = pipeline->preflightPipeline();
+  if(err >= 0)
+  {
+    pipeline->execute();
+    err = pipeline->getErrorCode();
+    switch(pipeline->getExecutionResult())
+    {
+    case FilterPipeline::ExecutionResult::Completed:
+      result.Status = "Completed";
+      break;
+    case FilterPipeline::ExecutionResult::Canceled:
+      result.Status = "Canceled";
+      break;
+    default:
+      break;
+    }
+  }
+  pipeline->removeMessageReceiver(&obs);
+
+  result.ErrorCode = err;
+  result.WarningCount = obs.m_WarningCount;
+  result.Errors = obs.m_Errors;
+  result.WallTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineBatch::getSummary() const
+{
+  QJsonArray jobs;
+  int completed = 0;
+  for(const Result& result : m_Results)
+  {
+    QJsonObject jobObj;
+    jobObj["Name"] = result.Name;
+    jobObj["Status"] = result.Status;
+    jobObj["ErrorCode"] = result.ErrorCode;
+    jobObj["StartTime"] = result.StartTime;
+    jobObj["WallTime"] = static_cast<double>(result.WallTime);
+    jobObj["WarningCount"] = result.WarningCount;
+    jobObj["Errors"] = QJsonArray::fromStringList(result.Errors);
+    jobs.append(jobObj);
+    if(result.Status == "Completed")
+    {
+      completed++;
+    }
+  }
+
+  QJsonObject summary;
+  summary["JobCount"] = static_cast<int>(m_Results.size());
+  summary["CompletedCount"] = completed;
+  summary["FailedCount"] = static_cast<int>(m_Results.size()) - completed;
+  summary["WallTime"] = static_cast<double>(m_WallTime);
+  summary["Jobs"] = jobs;
+  return summary;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<PipelineBatch::Job> PipelineBatch::ReadManifest(const QString& filePath, QString& errorMessage)
+{
+  std::vector<Job> jobs;
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    errorMessage = QObject::tr("The manifest '%1' could not be opened: %2").arg(filePath).arg(file.errorString());
+    return jobs;
+  }
+
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError)
+  {
+    errorMessage = QObject::tr("The manifest '%1' is not valid JSON: %2").arg(filePath).arg(parseError.errorString());
+    return jobs;
+  }
+
+  QJsonValue jobsValue = doc.object()["Jobs"];
+  if(!jobsValue.isArray())
+  {
+    errorMessage = QObject::tr("The manifest '%1' has no 'Jobs' array").arg(filePath);
+    return jobs;
+  }
+
+  QJsonArray jobsArray = jobsValue.toArray();
+  for(int i = 0; i < jobsArray.size(); i++)
+  {
+    QJsonObject jobObj = jobsArray[i].toObject();
+    Job job;
+    job.Name = jobObj["Name"].toString(QString("Job %1").arg(i + 1));
+    job.Overrides = jobObj["Overrides"].toObject();
+    jobs.push_back(job);
+  }
+  return jobs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineBatch::ApplyOverrides(const QJsonObject& pipelineJson, const QJsonObject& overrides, QString& errorMessage)
+{
+  QJsonObject result = pipelineJson;
+  int filterCount = pipelineJson[SIMPL::Settings::PipelineBuilderGroup].toObject()[SIMPL::Settings::NumFilters].toInt();
+  for(auto filterIter = overrides.begin(); filterIter != overrides.end(); ++filterIter)
+  {
+    // Older pipeline files pad the filter index with zeros
+    QString filterKey = filterIter.key();
+    bool isIndex = false;
+    int filterIndex = filterKey.toInt(&isIndex);
+    if(!result.contains(filterKey) && isIndex)
+    {
+      filterKey = StringOperations::GenerateIndexString(filterIndex, filterCount);
+    }
+    if(!result[filterKey].isObject() || !filterIter.value().isObject())
+    {
+      errorMessage = QObject::tr("The pipeline has no filter '%1' to override").arg(filterIter.key());
+      return QJsonObject();
+    }
+
+    QJsonObject filterObj = result[filterKey].toObject();
+    QJsonObject parameters = filterIter.value().toObject();
+    for(auto paramIter = parameters.begin(); paramIter != parameters.end(); ++paramIter)
+    {
+      if(!filterObj.contains(paramIter.key()))
+      {
+        errorMessage = QObject::tr("Filter '%1' has no parameter '%2' to override").arg(filterIter.key()).arg(paramIter.key());
+        return QJsonObject();
+      }
+      filterObj[paramIter.key()] = paramIter.value();
+    }
+    result[filterKey] = filterObj;
+  }
+  return result;
+}
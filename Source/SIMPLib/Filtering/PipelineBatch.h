@@ -0,0 +1,196 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The PipelineBatch class runs one pipeline over many inputs in a single process.
+ * Each Job names a set of overrides that replace filter parameter values in the pipeline
+ * JSON, keyed the same way as the pipeline file: the filter index, then the parameter
+ * name. Up to MaxConcurrentJobs copies of the pipeline run at the same time on worker
+ * threads that share the loaded plugins, and a Result is kept for every job.
+ *
+ * The parallel algorithms inside the filters all draw on the one ThreadScheduler of the
+ * process, so the jobs do not add threads beyond the workers themselves, and
+ * ThreadScheduler::setMaxThreadsPerPipeline() keeps each job to that many. MaxMemoryBytes
+ * holds back new jobs while the DataArrays of the process are at or above it. It is one
+ * budget for the whole process rather than one per job, so a single large job holds back
+ * every other job until it finishes. A job that is already running is never stopped, so
+ * the budget can be exceeded by the jobs that were admitted below it.
+ *
+ * Jobs that read or write HDF5 files at the same time need an HDF5 library built thread
+ * safe. Without one the jobs run one at a time whatever MaxConcurrentJobs is.
+ */
+class SIMPLib_EXPORT PipelineBatch
+{
+public:
+  SIMPL_SHARED_POINTERS(PipelineBatch)
+  SIMPL_TYPE_MACRO(PipelineBatch)
+
+  /**
+   * @brief Creates a batch for the pipeline, given as the JSON object of a pipeline file
+   * @param pipelineJson
+   * @return
+   */
+  static Pointer New(const QJsonObject& pipelineJson);
+
+  virtual ~PipelineBatch();
+
+  struct Job
+  {
+    QString Name;
+    QJsonObject Overrides;
+  };
+
+  /**
+   * @brief What happened to one job. Status is Completed, Failed or Canceled. WallTime is
+   * in milliseconds and StartTime is an ISO 8601 date.
+   */
+  struct Result
+  {
+    QString Name;
+    QString Status;
+    int ErrorCode = 0;
+    QString StartTime;
+    int64_t WallTime = 0;
+    int WarningCount = 0;
+    QStringList Errors;
+  };
+
+  /**
+   * @brief The most jobs that run at the same time. 0 uses the hardware concurrency.
+   * Ignored unless the HDF5 library is thread safe, see getJobConcurrency().
+   */
+  SIMPL_INSTANCE_PROPERTY(uint32_t, MaxConcurrentJobs)
+
+  /**
+   * @brief New jobs wait while the live DataArray bytes of the process are at or above
+   * this, 0 for no limit. At least one job always runs. The bytes are those of every
+   * DataArray in the process, including the ones of the running jobs and of the caller.
+   */
+  SIMPL_INSTANCE_PROPERTY(uint64_t, MaxMemoryBytes)
+
+  /**
+   * @brief Passed on to FilterPipeline::setFuseElementWiseFilters() for every job. The
+   * default is false.
+   */
+  SIMPL_INSTANCE_PROPERTY(bool, FuseElementWiseFilters)
+
+  /**
+   * @brief Adds a job to the end of the batch
+   * @param job
+   */
+  void addJob(const Job& job);
+
+  /**
+   * @brief Returns the jobs of the batch
+   * @return
+   */
+  const std::vector<Job>& getJobs() const;
+
+  /**
+   * @brief Runs every job and waits for all of them to finish
+   * @return The results in the order of the jobs
+   */
+  std::vector<Result> run();
+
+  /**
+   * @brief Returns the results of the last run()
+   * @return
+   */
+  const std::vector<Result>& getResults() const;
+
+  /**
+   * @brief Returns the results of the last run() and their totals as a JSON object
+   * @return
+   */
+  QJsonObject getSummary() const;
+
+  /**
+   * @brief Reads the jobs from a manifest file of the form
+   * {"Jobs": [{"Name": "...", "Overrides": {"0": {"InputFile": "..."}}}]}
+   * @param filePath
+   * @param errorMessage Set to the reason if the manifest could not be read
+   * @return The jobs, empty if the manifest could not be read
+   */
+  static std::vector<Job> ReadManifest(const QString& filePath, QString& errorMessage);
+
+  /**
+   * @brief Returns a copy of the pipeline JSON with the overrides applied
+   * @param pipelineJson
+   * @param overrides Filter index keys holding objects of parameter name keys
+   * @param errorMessage Set to the reason if an override does not match the pipeline
+   * @return
+   */
+  static QJsonObject ApplyOverrides(const QJsonObject& pipelineJson, const QJsonObject& overrides, QString& errorMessage);
+
+  /**
+   * @brief Returns the number of jobs that run at once. This is always 1 when the HDF5
+   * library is not built thread safe, since nearly every pipeline reads or writes HDF5 files.
+   * @return
+   */
+  size_t getJobConcurrency() const;
+
+protected:
+  PipelineBatch(const QJsonObject& pipelineJson);
+
+  /**
+   * @brief Runs one job on the calling thread
+   * @param job
+   * @param result
+   */
+  void runJob(const Job& job, Result& result) const;
+
+private:
+  QJsonObject m_PipelineJson;
+  std::vector<Job> m_Jobs;
+  std::vector<Result> m_Results;
+  int64_t m_WallTime = 0;
+
+public:
+  PipelineBatch(const PipelineBatch&) = delete;            // Copy Constructor Not Implemented
+  PipelineBatch(PipelineBatch&&) = delete;                 // Move Constructor Not Implemented
+  PipelineBatch& operator=(const PipelineBatch&) = delete; // Copy Assignment Not Implemented
+  PipelineBatch& operator=(PipelineBatch&&) = delete;      // Move Assignment Not Implemented
+};
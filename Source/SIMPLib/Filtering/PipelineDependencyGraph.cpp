@@ -0,0 +1,280 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineDependencyGraph.h"
+
+#include <algorithm>
+#include <set>
+
+#include <QtCore/QMetaProperty>
+#include <QtCore/QVariant>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::set<DataArrayPath> collectPaths(const DataContainerArray::Pointer& dca)
+{
+  std::set<DataArrayPath> paths;
+  if(nullptr == dca.get())
+  {
+    return paths;
+  }
+  for(const DataContainer::Pointer& dc : dca->getDataContainers())
+  {
+    paths.insert(DataArrayPath(dc->getName(), "", ""));
+    for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+    {
+      paths.insert(DataArrayPath(dc->getName(), am->getName(), ""));
+      for(const QString& daName : am->getAttributeArrayNames())
+      {
+        paths.insert(DataArrayPath(dc->getName(), am->getName(), daName));
+      }
+    }
+  }
+  return paths;
+}
+
+// -----------------------------------------------------------------------------
+// Creating or deleting an object modifies the container that holds it
+// -----------------------------------------------------------------------------
+DataArrayPath parentPath(const DataArrayPath& path)
+{
+  if(!path.getDataArrayName().isEmpty())
+  {
+    return DataArrayPath(path.getDataContainerName(), path.getAttributeMatrixName(), "");
+  }
+  if(!path.getAttributeMatrixName().isEmpty())
+  {
+    return DataArrayPath(path.getDataContainerName(), "", "");
+  }
+  return DataArrayPath("", "", "");
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineDependencyGraph::PipelineDependencyGraph() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineDependencyGraph::~PipelineDependencyGraph() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDependencyGraph::build(const QList<AbstractFilter::Pointer>& filters)
+{
+  const size_t numFilters = static_cast<size_t>(filters.size());
+  m_Dependencies.assign(numFilters, IndexList());
+  m_Dependents.assign(numFilters, IndexList());
+  m_Footprints.assign(numFilters, PathList());
+  m_Barriers.assign(numFilters, false);
+
+  std::vector<size_t> enabled;
+  std::set<DataArrayPath> previousPaths;
+  for(size_t i = 0; i < numFilters; i++)
+  {
+    AbstractFilter* filter = filters[static_cast<int>(i)].get();
+    if(!filter->getEnabled())
+    {
+      continue;
+    }
+    enabled.push_back(i);
+
+    DataContainerArray::Pointer dca = filter->getDataContainerArray();
+    if(nullptr == dca.get())
+    {
+      // Not preflighted so nothing is known about what it touches
+      m_Barriers[i] = true;
+      continue;
+    }
+
+    std::set<DataArrayPath> footprint;
+    std::set<DataArrayPath> paths = collectPaths(dca);
+    for(const DataArrayPath& path : paths)
+    {
+      if(previousPaths.find(path) == previousPaths.end())
+      {
+        footprint.insert(parentPath(path));
+      }
+    }
+    for(const DataArrayPath& path : previousPaths)
+    {
+      if(paths.find(path) == paths.end())
+      {
+        footprint.insert(parentPath(path));
+      }
+    }
+    for(const DataArrayPath& path : FindReferencedPaths(filter))
+    {
+      footprint.insert(path);
+    }
+    previousPaths.swap(paths);
+
+    m_Barriers[i] = footprint.empty() || footprint.find(DataArrayPath("", "", "")) != footprint.end() || filter->getAccessesFiles();
+    m_Footprints[i].assign(footprint.begin(), footprint.end());
+  }
+
+  for(size_t j = 0; j < enabled.size(); j++)
+  {
+    const size_t later = enabled[j];
+    for(size_t i = 0; i < j; i++)
+    {
+      const size_t earlier = enabled[i];
+      bool dependent = m_Barriers[earlier] || m_Barriers[later];
+      for(size_t a = 0; a < m_Footprints[earlier].size() && !dependent; a++)
+      {
+        for(size_t b = 0; b < m_Footprints[later].size() && !dependent; b++)
+        {
+          dependent = PathsOverlap(m_Footprints[earlier][a], m_Footprints[later][b]);
+        }
+      }
+      if(dependent)
+      {
+        m_Dependencies[later].push_back(earlier);
+        m_Dependents[earlier].push_back(later);
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelineDependencyGraph::size() const
+{
+  return m_Dependencies.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const PipelineDependencyGraph::IndexList& PipelineDependencyGraph::getDependencies(size_t index) const
+{
+  return m_Dependencies[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const PipelineDependencyGraph::IndexList& PipelineDependencyGraph::getDependents(size_t index) const
+{
+  return m_Dependents[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const PipelineDependencyGraph::PathList& PipelineDependencyGraph::getFootprint(size_t index) const
+{
+  return m_Footprints[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDependencyGraph::isBarrier(size_t index) const
+{
+  return m_Barriers[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineDependencyGraph::PathList PipelineDependencyGraph::FindReferencedPaths(AbstractFilter* filter)
+{
+  PathList paths;
+  const QMetaObject* metaObject = filter->metaObject();
+  const int pathTypeId = qMetaTypeId<DataArrayPath>();
+  const int pathVectorTypeId = qMetaTypeId<QVector<DataArrayPath>>();
+  for(int i = 0; i < metaObject->propertyCount(); i++)
+  {
+    QMetaProperty property = metaObject->property(i);
+    if(property.userType() == pathTypeId)
+    {
+      DataArrayPath path = property.read(filter).value<DataArrayPath>();
+      if(!path.isEmpty())
+      {
+        paths.push_back(path);
+      }
+    }
+    else if(property.userType() == pathVectorTypeId)
+    {
+      QVector<DataArrayPath> pathVector = property.read(filter).value<QVector<DataArrayPath>>();
+      for(const DataArrayPath& path : pathVector)
+      {
+        if(!path.isEmpty())
+        {
+          paths.push_back(path);
+        }
+      }
+    }
+  }
+  return paths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDependencyGraph::PathsOverlap(const DataArrayPath& lhs, const DataArrayPath& rhs)
+{
+  if(lhs.getDataContainerName().isEmpty() || rhs.getDataContainerName().isEmpty())
+  {
+    return true;
+  }
+  if(lhs.getDataContainerName() != rhs.getDataContainerName())
+  {
+    return false;
+  }
+  if(lhs.getAttributeMatrixName().isEmpty() || rhs.getAttributeMatrixName().isEmpty())
+  {
+    return true;
+  }
+  if(lhs.getAttributeMatrixName() != rhs.getAttributeMatrixName())
+  {
+    return false;
+  }
+  if(lhs.getDataArrayName().isEmpty() || rhs.getDataArrayName().isEmpty())
+  {
+    return true;
+  }
+  return lhs.getDataArrayName() == rhs.getDataArrayName();
+}
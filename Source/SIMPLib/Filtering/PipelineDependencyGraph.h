@@ -0,0 +1,138 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QList>
+
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The PipelineDependencyGraph class works out which filters of a preflighted
+ * pipeline have to run one after the other and which may run at the same time.
+ *
+ * Each enabled filter gets a footprint of DataArrayPaths made from the paths held
+ * in its properties plus the parent container of every path it created or deleted
+ * during preflight (found by comparing its preflight DataContainerArray with the one
+ * of the enabled filter before it). Two filters depend on each other when their
+ * footprints overlap. Because a property path may be written in place, overlapping
+ * readers are ordered as well. A filter whose footprint is empty or covers the whole
+ * DataContainerArray (creating or deleting a DataContainer) is a barrier that depends
+ * on, and is depended on by, every other enabled filter. So is every filter that reads
+ * or writes files (AbstractFilter::getAccessesFiles()), because the HDF5 library is
+ * usually not thread safe and files on disk are not part of the footprints.
+ */
+class SIMPLib_EXPORT PipelineDependencyGraph
+{
+public:
+  using IndexList = std::vector<size_t>;
+  using PathList = std::vector<DataArrayPath>;
+
+  PipelineDependencyGraph();
+  virtual ~PipelineDependencyGraph();
+
+  /**
+   * @brief Builds the graph for the filters. The filters must still hold the
+   * DataContainerArray each one was left with by FilterPipeline::preflightPipeline().
+   * @param filters
+   */
+  void build(const QList<AbstractFilter::Pointer>& filters);
+
+  /**
+   * @brief Returns the number of filters in the graph
+   * @return
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the indices of the earlier filters that must finish before the filter at index starts
+   * @param index
+   * @return
+   */
+  const IndexList& getDependencies(size_t index) const;
+
+  /**
+   * @brief Returns the indices of the later filters that wait on the filter at index
+   * @param index
+   * @return
+   */
+  const IndexList& getDependents(size_t index) const;
+
+  /**
+   * @brief Returns the parts of the DataContainerArray the filter at index touches
+   * @param index
+   * @return
+   */
+  const PathList& getFootprint(size_t index) const;
+
+  /**
+   * @brief Returns true if the filter at index has to run on its own
+   * @param index
+   * @return
+   */
+  bool isBarrier(size_t index) const;
+
+  /**
+   * @brief Returns the non empty DataArrayPath values of the filter's properties,
+   * including those held in QVector<DataArrayPath> properties.
+   * @param filter
+   * @return
+   */
+  static PathList FindReferencedPaths(AbstractFilter* filter);
+
+  /**
+   * @brief Returns true if one path lies inside the other. Empty names act as
+   * wildcards so a DataContainer path overlaps everything inside that DataContainer.
+   * @param lhs
+   * @param rhs
+   * @return
+   */
+  static bool PathsOverlap(const DataArrayPath& lhs, const DataArrayPath& rhs);
+
+private:
+  std::vector<IndexList> m_Dependencies;
+  std::vector<IndexList> m_Dependents;
+  std::vector<PathList> m_Footprints;
+  std::vector<bool> m_Barriers;
+
+public:
+  PipelineDependencyGraph(const PipelineDependencyGraph&) = delete;            // Copy Constructor Not Implemented
+  PipelineDependencyGraph(PipelineDependencyGraph&&) = delete;                 // Move Constructor Not Implemented
+  PipelineDependencyGraph& operator=(const PipelineDependencyGraph&) = delete; // Copy Assignment Not Implemented
+  PipelineDependencyGraph& operator=(PipelineDependencyGraph&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,377 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineProfile.h"
+
+#include <algorithm>
+#include <thread>
+
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
+
+#include "SIMPLib/DataArrays/DataArrayAllocator.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void readProcessCounters(int64_t& cpuTime, size_t& peakResidentBytes)
+{
+#if defined(_WIN32)
+  FILETIME creationTime;
+  FILETIME exitTime;
+  FILETIME kernelTime;
+  FILETIME userTime;
+  cpuTime = 0;
+  if(GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime) != 0)
+  {
+    // FILETIME counts 100 nanosecond intervals
+    ULARGE_INTEGER kernel;
+    kernel.LowPart = kernelTime.dwLowDateTime;
+    kernel.HighPart = kernelTime.dwHighDateTime;
+    ULARGE_INTEGER user;
+    user.LowPart = userTime.dwLowDateTime;
+    user.HighPart = userTime.dwHighDateTime;
+    cpuTime = static_cast<int64_t>((kernel.QuadPart + user.QuadPart) / 10);
+  }
+  PROCESS_MEMORY_COUNTERS memoryCounters;
+  peakResidentBytes = 0;
+  if(GetProcessMemoryInfo(GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters)) != 0)
+  {
+    peakResidentBytes = static_cast<size_t>(memoryCounters.PeakWorkingSetSize);
+  }
+#else
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    cpuTime = 0;
+    peakResidentBytes = 0;
+    return;
+  }
+  cpuTime = static_cast<int64_t>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000 + static_cast<int64_t>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+#if defined(__APPLE__)
+  // macOS reports bytes, everyone else kilobytes
+  peakResidentBytes = static_cast<size_t>(usage.ru_maxrss);
+#else
+  peakResidentBytes = static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double threadUtilization(int64_t cpuTime, int64_t wallTime)
+{
+  if(wallTime <= 0)
+  {
+    return 0.0;
+  }
+  double hardwareThreads = static_cast<double>(std::max(std::thread::hardware_concurrency(), 1u));
+  return std::min(static_cast<double>(cpuTime) / (static_cast<double>(wallTime) * hardwareThreads), 1.0);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfile::PipelineProfile()
+: m_StartTime(std::chrono::steady_clock::now())
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfile::~PipelineProfile() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfile::start(const QString& pipelineName)
+{
+  m_PipelineName = pipelineName;
+  m_FilterRecords.clear();
+  m_WallTime = 0;
+  m_ProcessCpuTime = 0;
+  m_BytesAllocated = 0;
+  m_NumAllocations = 0;
+  m_PeakResidentBytes = 0;
+  m_StartTime = std::chrono::steady_clock::now();
+  m_StartSample = takeSample();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfile::finish()
+{
+  Sample end = takeSample();
+  m_WallTime = end.WallTime;
+  m_ProcessCpuTime = end.ProcessCpuTime - m_StartSample.ProcessCpuTime;
+  m_BytesAllocated = end.BytesAllocated - m_StartSample.BytesAllocated;
+  m_NumAllocations = end.NumAllocations - m_StartSample.NumAllocations;
+  m_PeakResidentBytes = end.PeakResidentBytes;
+
+  // Filters that ran at the same time finish in any order
+  std::stable_sort(m_FilterRecords.begin(), m_FilterRecords.end(), [](const FilterRecord& lhs, const FilterRecord& rhs) { return lhs.PipelineIndex < rhs.PipelineIndex; });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfile::Sample PipelineProfile::takeSample() const
+{
+  Sample sample;
+  sample.WallTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_StartTime).count();
+  readProcessCounters(sample.ProcessCpuTime, sample.PeakResidentBytes);
+  DataArrayAllocator::Statistics stats = DataArrayAllocator::GetGlobalStatistics();
+  sample.BytesAllocated = stats.bytesAllocated;
+  sample.NumAllocations = stats.numAllocations;
+  sample.BytesLive = stats.bytesLive;
+  return sample;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfile::addFilterRecord(AbstractFilter* filter, const Sample& begin, const Sample& end, int lane, size_t arrayCount, bool restored)
+{
+  FilterRecord record;
+  record.PipelineIndex = filter->getPipelineIndex();
+  record.HumanLabel = filter->getHumanLabel();
+  record.ClassName = filter->getNameOfClass();
+  record.Lane = lane;
+  record.Restored = restored;
+  record.ErrorCode = filter->getErrorCode();
+  record.StartTime = begin.WallTime;
+  record.WallTime = end.WallTime - begin.WallTime;
+  record.ProcessCpuTime = end.ProcessCpuTime - begin.ProcessCpuTime;
+  record.ThreadUtilization = threadUtilization(record.ProcessCpuTime, record.WallTime);
+  record.BytesAllocated = end.BytesAllocated - begin.BytesAllocated;
+  record.NumAllocations = end.NumAllocations - begin.NumAllocations;
+  record.BytesLive = end.BytesLive;
+  record.PeakResidentBytes = end.PeakResidentBytes;
+  record.ArrayCount = arrayCount;
+  m_FilterRecords.push_back(record);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<PipelineProfile::FilterRecord>& PipelineProfile::getFilterRecords() const
+{
+  return m_FilterRecords;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineProfile::toJson() const
+{
+  QJsonArray filters;
+  for(const FilterRecord& record : m_FilterRecords)
+  {
+    QJsonObject filterObj;
+    filterObj["PipelineIndex"] = record.PipelineIndex;
+    filterObj["HumanLabel"] = record.HumanLabel;
+    filterObj["ClassName"] = record.ClassName;
+    filterObj["Lane"] = record.Lane;
+    filterObj["Restored"] = record.Restored;
+    filterObj["ErrorCode"] = record.ErrorCode;
+    filterObj["StartTime"] = static_cast<double>(record.StartTime);
+    filterObj["WallTime"] = static_cast<double>(record.WallTime);
+    filterObj["ProcessCpuTime"] = static_cast<double>(record.ProcessCpuTime);
+    filterObj["ThreadUtilization"] = record.ThreadUtilization;
+    filterObj["BytesAllocated"] = static_cast<double>(record.BytesAllocated);
+    filterObj["NumAllocations"] = static_cast<double>(record.NumAllocations);
+    filterObj["BytesLive"] = static_cast<double>(record.BytesLive);
+    filterObj["PeakResidentBytes"] = static_cast<double>(record.PeakResidentBytes);
+    filterObj["ArrayCount"] = static_cast<double>(record.ArrayCount);
+    filters.append(filterObj);
+  }
+
+  QJsonObject profileObj;
+  profileObj["PipelineName"] = m_PipelineName;
+  profileObj["TimeUnit"] = QString("us");
+  profileObj["WallTime"] = static_cast<double>(m_WallTime);
+  profileObj["ProcessCpuTime"] = static_cast<double>(m_ProcessCpuTime);
+  profileObj["ThreadUtilization"] = threadUtilization(m_ProcessCpuTime, m_WallTime);
+  profileObj["BytesAllocated"] = static_cast<double>(m_BytesAllocated);
+  profileObj["NumAllocations"] = static_cast<double>(m_NumAllocations);
+  profileObj["PeakResidentBytes"] = static_cast<double>(m_PeakResidentBytes);
+  profileObj["Filters"] = filters;
+  return profileObj;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineProfile::toChromeTrace() const
+{
+  const int pid = 1;
+  QJsonArray events;
+
+  auto addMetadata = [&events, pid](const QString& name, int tid, const QString& value) {
+    QJsonObject args;
+    args["name"] = value;
+    QJsonObject event;
+    event["name"] = name;
+    event["ph"] = QString("M");
+    event["pid"] = pid;
+    event["tid"] = tid;
+    event["args"] = args;
+    events.append(event);
+  };
+
+  addMetadata("process_name", 0, m_PipelineName.isEmpty() ? QString("Pipeline") : m_PipelineName);
+  addMetadata("thread_name", 0, "Pipeline");
+  int maxLane = 0;
+  for(const FilterRecord& record : m_FilterRecords)
+  {
+    maxLane = std::max(maxLane, record.Lane);
+  }
+  for(int lane = 1; lane <= maxLane; lane++)
+  {
+    addMetadata("thread_name", lane, QString("Filters %1").arg(lane));
+  }
+
+  QJsonObject pipelineArgs;
+  pipelineArgs["ProcessCpuTime"] = static_cast<double>(m_ProcessCpuTime);
+  pipelineArgs["ThreadUtilization"] = threadUtilization(m_ProcessCpuTime, m_WallTime);
+  pipelineArgs["BytesAllocated"] = static_cast<double>(m_BytesAllocated);
+  pipelineArgs["PeakResidentBytes"] = static_cast<double>(m_PeakResidentBytes);
+  QJsonObject pipelineEvent;
+  pipelineEvent["name"] = m_PipelineName.isEmpty() ? QString("Pipeline") : m_PipelineName;
+  pipelineEvent["cat"] = QString("pipeline");
+  pipelineEvent["ph"] = QString("X");
+  pipelineEvent["ts"] = 0;
+  pipelineEvent["dur"] = static_cast<double>(m_WallTime);
+  pipelineEvent["pid"] = pid;
+  pipelineEvent["tid"] = 0;
+  pipelineEvent["args"] = pipelineArgs;
+  events.append(pipelineEvent);
+
+  for(const FilterRecord& record : m_FilterRecords)
+  {
+    QJsonObject args;
+    args["PipelineIndex"] = record.PipelineIndex;
+    args["ClassName"] = record.ClassName;
+    args["Restored"] = record.Restored;
+    args["ErrorCode"] = record.ErrorCode;
+    args["ProcessCpuTime"] = static_cast<double>(record.ProcessCpuTime);
+    args["ThreadUtilization"] = record.ThreadUtilization;
+    args["BytesAllocated"] = static_cast<double>(record.BytesAllocated);
+    args["NumAllocations"] = static_cast<double>(record.NumAllocations);
+    args["PeakResidentBytes"] = static_cast<double>(record.PeakResidentBytes);
+    args["ArrayCount"] = static_cast<double>(record.ArrayCount);
+
+    QJsonObject event;
+    event["name"] = QString("[%1] %2").arg(record.PipelineIndex + 1).arg(record.HumanLabel);
+    event["cat"] = QString("filter");
+    event["ph"] = QString("X");
+    event["ts"] = static_cast<double>(record.StartTime);
+    event["dur"] = static_cast<double>(record.WallTime);
+    event["pid"] = pid;
+    event["tid"] = record.Lane;
+    event["args"] = args;
+    events.append(event);
+
+    QJsonObject counterArgs;
+    counterArgs["BytesLive"] = static_cast<double>(record.BytesLive);
+    QJsonObject counter;
+    counter["name"] = QString("DataArray Memory");
+    counter["ph"] = QString("C");
+    counter["ts"] = static_cast<double>(record.StartTime + record.WallTime);
+    counter["pid"] = pid;
+    counter["args"] = counterArgs;
+    events.append(counter);
+  }
+
+  QJsonObject trace;
+  trace["traceEvents"] = events;
+  trace["displayTimeUnit"] = QString("ms");
+  return trace;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineProfile::writeChromeTrace(const QString& filePath) const
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    return false;
+  }
+  QJsonDocument doc(toChromeTrace());
+  QByteArray json = doc.toJson(QJsonDocument::Compact);
+  return file.write(json) == json.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelineProfile::CountArrays(const DataContainerArray::Pointer& dca)
+{
+  size_t count = 0;
+  if(nullptr == dca.get())
+  {
+    return count;
+  }
+  for(const DataContainer::Pointer& dc : dca->getDataContainers())
+  {
+    for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+    {
+      count += static_cast<size_t>(am->getAttributeArrayNames().size());
+    }
+  }
+  return count;
+}
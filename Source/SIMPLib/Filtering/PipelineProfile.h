@@ -0,0 +1,197 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The PipelineProfile class records where the time and memory of a pipeline run
+ * go. When one is set with FilterPipeline::setProfile(), FilterPipeline::execute() takes
+ * a Sample of the process counters around every filter it executes and keeps a
+ * FilterRecord for each one. The records can be read back directly, as JSON, or as a
+ * Chrome trace that chrome://tracing and Perfetto (ui.perfetto.dev) display on a timeline.
+ *
+ * CPU time, allocations and the resident set are process wide counters. ProcessCpuTime is
+ * the CPU time all threads of the process used while the filter ran, not the time of the
+ * filter alone. In Parallel mode filters that run at the same time are each charged for all
+ * of it.
+ */
+class SIMPLib_EXPORT PipelineProfile
+{
+public:
+  SIMPL_SHARED_POINTERS(PipelineProfile)
+  SIMPL_TYPE_MACRO(PipelineProfile)
+  SIMPL_STATIC_NEW_MACRO(PipelineProfile)
+
+  virtual ~PipelineProfile();
+
+  /**
+   * @brief The process counters at one moment. Times are in microseconds, the wall time
+   * counted from start().
+   */
+  struct Sample
+  {
+    int64_t WallTime = 0;
+    int64_t ProcessCpuTime = 0;
+    size_t PeakResidentBytes = 0;
+    size_t BytesAllocated = 0;
+    size_t NumAllocations = 0;
+    size_t BytesLive = 0;
+  };
+
+  /**
+   * @brief What one filter cost. ThreadUtilization is the process CPU time divided by the
+   * wall time of all hardware threads, so 1.0 means every core was busy the whole time.
+   * BytesAllocated and NumAllocations count what went through DataArrayAllocator,
+   * BytesLive and ArrayCount are what was left once the filter finished.
+   */
+  struct FilterRecord
+  {
+    int PipelineIndex = -1;
+    QString HumanLabel;
+    QString ClassName;
+    int Lane = 0;
+    bool Restored = false;
+    int ErrorCode = 0;
+    int64_t StartTime = 0;
+    int64_t WallTime = 0;
+    int64_t ProcessCpuTime = 0;
+    double ThreadUtilization = 0.0;
+    size_t BytesAllocated = 0;
+    size_t NumAllocations = 0;
+    size_t BytesLive = 0;
+    size_t PeakResidentBytes = 0;
+    size_t ArrayCount = 0;
+  };
+
+  SIMPL_GET_PROPERTY(QString, PipelineName)
+  SIMPL_GET_PROPERTY(int64_t, WallTime)
+  SIMPL_GET_PROPERTY(int64_t, ProcessCpuTime)
+  SIMPL_GET_PROPERTY(size_t, BytesAllocated)
+  SIMPL_GET_PROPERTY(size_t, NumAllocations)
+  SIMPL_GET_PROPERTY(size_t, PeakResidentBytes)
+
+  /**
+   * @brief Forgets earlier records and starts the clock of a new run
+   * @param pipelineName
+   */
+  void start(const QString& pipelineName);
+
+  /**
+   * @brief Stops the clock and fills in the totals of the run
+   */
+  void finish();
+
+  /**
+   * @brief Reads the process counters. May be called from any thread.
+   * @return
+   */
+  Sample takeSample() const;
+
+  /**
+   * @brief Adds the record of a filter that ran between the two samples
+   * @param filter
+   * @param begin
+   * @param end
+   * @param lane The timeline row the filter is drawn on
+   * @param arrayCount The number of attribute arrays once the filter finished
+   * @param restored True if the result came from a PipelineResultCache
+   */
+  void addFilterRecord(AbstractFilter* filter, const Sample& begin, const Sample& end, int lane, size_t arrayCount, bool restored);
+
+  /**
+   * @brief Returns the filter records in pipeline order once finish() was called
+   * @return
+   */
+  const std::vector<FilterRecord>& getFilterRecords() const;
+
+  /**
+   * @brief Returns the totals and the filter records as a JSON object
+   * @return
+   */
+  QJsonObject toJson() const;
+
+  /**
+   * @brief Returns the run in the Chrome trace event format: one complete event per
+   * filter plus a counter of the live DataArray memory
+   * @return
+   */
+  QJsonObject toChromeTrace() const;
+
+  /**
+   * @brief Writes toChromeTrace() to filePath
+   * @param filePath
+   * @return false if the file could not be written
+   */
+  bool writeChromeTrace(const QString& filePath) const;
+
+  /**
+   * @brief Returns the number of attribute arrays in the DataContainerArray
+   * @param dca
+   * @return
+   */
+  static size_t CountArrays(const DataContainerArray::Pointer& dca);
+
+protected:
+  PipelineProfile();
+
+private:
+  QString m_PipelineName;
+  int64_t m_WallTime = 0;
+  int64_t m_ProcessCpuTime = 0;
+  size_t m_BytesAllocated = 0;
+  size_t m_NumAllocations = 0;
+  size_t m_PeakResidentBytes = 0;
+
+  std::chrono::steady_clock::time_point m_StartTime;
+  Sample m_StartSample;
+  std::vector<FilterRecord> m_FilterRecords;
+
+public:
+  PipelineProfile(const PipelineProfile&) = delete;            // Copy Constructor Not Implemented
+  PipelineProfile(PipelineProfile&&) = delete;                 // Move Constructor Not Implemented
+  PipelineProfile& operator=(const PipelineProfile&) = delete; // Copy Assignment Not Implemented
+  PipelineProfile& operator=(PipelineProfile&&) = delete;      // Move Assignment Not Implemented
+};
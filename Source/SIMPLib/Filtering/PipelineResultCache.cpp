@@ -0,0 +1,735 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineResultCache.h"
+
+#include <algorithm>
+#include <set>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QTextStream>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+#include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
+#include "SIMPLib/Filtering/PipelineDependencyGraph.h"
+#include "SIMPLib/Filtering/PreflightCache.h"
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/RectGridGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
+
+namespace
+{
+const QString k_IndexFileName("index.json");
+const QString k_EntrySuffix(".h5");
+const QString k_DeltaAttribute("PipelineResultCacheDelta");
+const QString k_Deleted("Deleted");
+const QString k_DataContainers("DataContainers");
+const QString k_AttributeMatrices("AttributeMatrices");
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void hashBytes(QCryptographicHash& hash, const char* bytes, size_t numBytes)
+{
+  // addData() takes an int length so feed large buffers in pieces
+  const size_t chunkSize = 1ULL << 30;
+  for(size_t offset = 0; offset < numBytes; offset += chunkSize)
+  {
+    hash.addData(bytes + offset, static_cast<int>(std::min(chunkSize, numBytes - offset)));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void hashDataArray(QCryptographicHash& hash, const IDataArray::Pointer& dataArray)
+{
+  if(nullptr == dataArray.get())
+  {
+    hash.addData(QByteArray("null"));
+    return;
+  }
+  hash.addData(dataArray->getName().toUtf8());
+  hash.addData(dataArray->getNameOfClass().toUtf8());
+  hash.addData(dataArray->getTypeAsString().toUtf8());
+  const std::vector<size_t> cDims = dataArray->getComponentDimensions();
+  const size_t numTuples = dataArray->getNumberOfTuples();
+  hashBytes(hash, reinterpret_cast<const char*>(&numTuples), sizeof(numTuples));
+  hashBytes(hash, reinterpret_cast<const char*>(cDims.data()), cDims.size() * sizeof(size_t));
+  if(dataArray->getSize() == 0)
+  {
+    return;
+  }
+
+  if(dataArray->getNameOfClass().startsWith("DataArray") && nullptr != dataArray->getVoidPointer(0))
+  {
+    hashBytes(hash, reinterpret_cast<const char*>(dataArray->getVoidPointer(0)), dataArray->getSize() * dataArray->getTypeSize());
+    return;
+  }
+
+  // The other array types do not keep their values in one flat buffer so hash their text form
+  QString text;
+  QTextStream out(&text);
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    dataArray->printTuple(out, i);
+    out << '\n';
+    if(text.size() > 65536)
+    {
+      out.flush();
+      hash.addData(text.toUtf8());
+      text.clear();
+    }
+  }
+  out.flush();
+  hash.addData(text.toUtf8());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void hashGeometry(QCryptographicHash& hash, const IGeometry::Pointer& geometry)
+{
+  if(nullptr == geometry.get())
+  {
+    hash.addData(QByteArray("NoGeometry"));
+    return;
+  }
+  hash.addData(geometry->getInfoString(SIMPL::HtmlFormat).toUtf8());
+
+  if(RectGridGeom::Pointer rectGrid = std::dynamic_pointer_cast<RectGridGeom>(geometry))
+  {
+    hashDataArray(hash, rectGrid->getXBounds());
+    hashDataArray(hash, rectGrid->getYBounds());
+    hashDataArray(hash, rectGrid->getZBounds());
+  }
+  else if(VertexGeom::Pointer vertices = std::dynamic_pointer_cast<VertexGeom>(geometry))
+  {
+    hashDataArray(hash, vertices->getVertices());
+  }
+  else if(EdgeGeom::Pointer edges = std::dynamic_pointer_cast<EdgeGeom>(geometry))
+  {
+    hashDataArray(hash, edges->getVertices());
+    hashDataArray(hash, edges->getEdges());
+  }
+  else if(TriangleGeom::Pointer triangles = std::dynamic_pointer_cast<TriangleGeom>(geometry))
+  {
+    hashDataArray(hash, triangles->getVertices());
+    hashDataArray(hash, triangles->getTriangles());
+  }
+  else if(QuadGeom::Pointer quads = std::dynamic_pointer_cast<QuadGeom>(geometry))
+  {
+    hashDataArray(hash, quads->getVertices());
+    hashDataArray(hash, quads->getQuads());
+  }
+  else if(TetrahedralGeom::Pointer tets = std::dynamic_pointer_cast<TetrahedralGeom>(geometry))
+  {
+    hashDataArray(hash, tets->getVertices());
+    hashDataArray(hash, tets->getTetrahedra());
+  }
+  else if(HexahedralGeom::Pointer hexas = std::dynamic_pointer_cast<HexahedralGeom>(geometry))
+  {
+    hashDataArray(hash, hexas->getVertices());
+    hashDataArray(hash, hexas->getHexahedra());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void hashAttributeMatrix(QCryptographicHash& hash, const AttributeMatrix::Pointer& attrMat)
+{
+  hash.addData(attrMat->getName().toUtf8());
+  const uint32_t amType = static_cast<uint32_t>(attrMat->getType());
+  const std::vector<size_t> tDims = attrMat->getTupleDimensions();
+  hashBytes(hash, reinterpret_cast<const char*>(&amType), sizeof(amType));
+  hashBytes(hash, reinterpret_cast<const char*>(tDims.data()), tDims.size() * sizeof(size_t));
+  for(const IDataArray::Pointer& dataArray : *attrMat)
+  {
+    hashDataArray(hash, dataArray);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void hashDataContainer(QCryptographicHash& hash, const DataContainer::Pointer& dc)
+{
+  hash.addData(dc->getName().toUtf8());
+  hashGeometry(hash, dc->getGeometry());
+  for(const AttributeMatrix::Pointer& attrMat : dc->getAttributeMatrices())
+  {
+    hashAttributeMatrix(hash, attrMat);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Same layout DataContainer::writeAttributeMatricesToHDF5() uses for each matrix
+// -----------------------------------------------------------------------------
+int writeAttributeMatrix(hid_t dcGid, const AttributeMatrix::Pointer& attrMat)
+{
+  const QString amName = attrMat->getName();
+  int err = QH5Utilities::createGroupsFromPath(amName, dcGid);
+  if(err < 0)
+  {
+    return err;
+  }
+  hid_t amGid = H5Gopen(dcGid, amName.toLatin1().data(), H5P_DEFAULT);
+  H5ScopedGroupSentinel sentinel(&amGid, false);
+
+  AttributeMatrix::EnumType amType = static_cast<AttributeMatrix::EnumType>(attrMat->getType());
+  err = QH5Lite::writeScalarAttribute(dcGid, amName, SIMPL::StringConstants::AttributeMatrixType, amType);
+  if(err < 0)
+  {
+    return err;
+  }
+  hsize_t size = attrMat->getTupleDimensions().size();
+  err = QH5Lite::writePointerAttribute(dcGid, amName, SIMPL::HDF5::TupleDimensions, 1, &size, attrMat->getTupleDimensions().data());
+  if(err < 0)
+  {
+    return err;
+  }
+  return attrMat->writeAttributeArraysToHDF5(amGid);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineResultCache::PipelineResultCache(const QString& directory, uint64_t maxBytes)
+: m_MaxBytes(maxBytes)
+, m_Directory(directory)
+{
+  loadIndex();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineResultCache::~PipelineResultCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineResultCache::Pointer PipelineResultCache::New(const QString& directory, uint64_t maxBytes)
+{
+  Pointer sharedPtr(new PipelineResultCache(directory, maxBytes));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t PipelineResultCache::getDiskUsage() const
+{
+  uint64_t numBytes = 0;
+  for(const auto& entry : m_Index)
+  {
+    numBytes += entry.second.Bytes;
+  }
+  return numBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::resetStatistics()
+{
+  m_HitCount = 0;
+  m_MissCount = 0;
+  m_EvictionCount = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::clear()
+{
+  for(const auto& entry : m_Index)
+  {
+    QFile::remove(getEntryFilePath(entry.first));
+  }
+  m_Index.clear();
+  QFile::remove(QDir(m_Directory).filePath(k_IndexFileName));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineResultCache::IsCacheable(AbstractFilter* filter)
+{
+  for(const FilterParameter::Pointer& parameter : filter->getFilterParameters())
+  {
+    if(nullptr != std::dynamic_pointer_cast<OutputFileFilterParameter>(parameter) || nullptr != std::dynamic_pointer_cast<OutputPathFilterParameter>(parameter))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray PipelineResultCache::createKey(AbstractFilter* filter, const DataContainerArray::Pointer& dca) const
+{
+  if(nullptr == dca.get() || !IsCacheable(filter))
+  {
+    return QByteArray();
+  }
+
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  hash.addData(filter->getUuid().toByteArray());
+  hash.addData(PreflightCache::CreateParameterKey(filter));
+
+  PipelineDependencyGraph::PathList paths = PipelineDependencyGraph::FindReferencedPaths(filter);
+  if(paths.empty())
+  {
+    // Nothing says what the filter reads so it may read anything
+    for(const DataContainer::Pointer& dc : dca->getDataContainers())
+    {
+      hashDataContainer(hash, dc);
+    }
+    return hash.result().toHex();
+  }
+
+  std::sort(paths.begin(), paths.end());
+  paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
+  for(const DataArrayPath& path : paths)
+  {
+    hash.addData(path.serialize().toUtf8());
+    DataContainer::Pointer dc = dca->getDataContainer(path.getDataContainerName());
+    if(nullptr == dc.get())
+    {
+      hash.addData(QByteArray("Missing"));
+      continue;
+    }
+    if(path.getAttributeMatrixName().isEmpty())
+    {
+      hashDataContainer(hash, dc);
+      continue;
+    }
+
+    // Filters working on an array usually also look at the geometry around it
+    hashGeometry(hash, dc->getGeometry());
+    AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(path.getAttributeMatrixName());
+    if(nullptr == attrMat.get())
+    {
+      hash.addData(QByteArray("Missing"));
+    }
+    else if(path.getDataArrayName().isEmpty())
+    {
+      hashAttributeMatrix(hash, attrMat);
+    }
+    else
+    {
+      hashDataArray(hash, attrMat->getAttributeArray(path.getDataArrayName()));
+    }
+  }
+  return hash.result().toHex();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineResultCache::store(const QByteArray& key, AbstractFilter* filter, const std::list<DataArrayPath>& pathsBefore, const DataContainerArray::Pointer& dca)
+{
+  if(key.isEmpty() || nullptr == dca.get())
+  {
+    return false;
+  }
+
+  const std::set<DataArrayPath> before(pathsBefore.begin(), pathsBefore.end());
+  const std::list<DataArrayPath> pathsAfter = dca->getDescendantPaths();
+  const std::set<DataArrayPath> after(pathsAfter.begin(), pathsAfter.end());
+
+  // Everything the filter created or was pointed at is written out whole
+  std::set<QString> dcScopes;
+  std::set<DataArrayPath> amScopes;
+  auto addScope = [&dcScopes, &amScopes](const DataArrayPath& path) {
+    if(path.getAttributeMatrixName().isEmpty())
+    {
+      dcScopes.insert(path.getDataContainerName());
+    }
+    else
+    {
+      amScopes.insert(DataArrayPath(path.getDataContainerName(), path.getAttributeMatrixName(), ""));
+    }
+  };
+  for(const DataArrayPath& path : after)
+  {
+    if(before.find(path) == before.end())
+    {
+      addScope(path);
+    }
+  }
+  PipelineDependencyGraph::PathList referencedPaths = PipelineDependencyGraph::FindReferencedPaths(filter);
+  if(referencedPaths.empty())
+  {
+    for(const QString& dcName : dca->getDataContainerNames())
+    {
+      dcScopes.insert(dcName);
+    }
+  }
+  for(const DataArrayPath& path : referencedPaths)
+  {
+    DataArrayPath scopePath = path.getDataArrayName().isEmpty() ? path : DataArrayPath(path.getDataContainerName(), path.getAttributeMatrixName(), "");
+    if(after.find(scopePath) != after.end())
+    {
+      addScope(scopePath);
+    }
+  }
+
+  QJsonArray deleted;
+  for(const DataArrayPath& path : before)
+  {
+    if(after.find(path) != after.end())
+    {
+      continue;
+    }
+    // Only the topmost deleted object needs to be recorded
+    bool parentDeleted = false;
+    if(!path.getAttributeMatrixName().isEmpty())
+    {
+      parentDeleted |= after.find(DataArrayPath(path.getDataContainerName(), "", "")) == after.end();
+    }
+    if(!path.getDataArrayName().isEmpty())
+    {
+      parentDeleted |= after.find(DataArrayPath(path.getDataContainerName(), path.getAttributeMatrixName(), "")) == after.end();
+    }
+    if(!parentDeleted)
+    {
+      deleted.append(path.serialize());
+    }
+  }
+
+  QJsonArray dataContainers;
+  std::set<QString> dcNames(dcScopes);
+  for(const QString& dcName : dcScopes)
+  {
+    dataContainers.append(dcName);
+  }
+  QJsonArray attributeMatrices;
+  for(const DataArrayPath& amPath : amScopes)
+  {
+    if(dcScopes.find(amPath.getDataContainerName()) == dcScopes.end())
+    {
+      attributeMatrices.append(amPath.serialize());
+      dcNames.insert(amPath.getDataContainerName());
+    }
+  }
+  QJsonObject delta;
+  delta[k_Deleted] = deleted;
+  delta[k_DataContainers] = dataContainers;
+  delta[k_AttributeMatrices] = attributeMatrices;
+
+  // Write next to the final file and move it in place once it is complete
+  QDir().mkpath(m_Directory);
+  const QString filePath = getEntryFilePath(key);
+  const QString tempFilePath = filePath + ".tmp";
+  int err = 0;
+  {
+    hid_t fileId = QH5Utilities::createFile(tempFilePath);
+    if(fileId < 0)
+    {
+      return false;
+    }
+    H5ScopedFileSentinel fileSentinel(&fileId, true);
+    err |= QH5Lite::writeStringAttribute(fileId, "/", SIMPL::HDF5::FileVersionName, SIMPL::HDF5::FileVersion);
+    err |= QH5Lite::writeStringAttribute(fileId, "/", SIMPL::HDF5::DREAM3DVersion, SIMPLib::Version::Complete());
+    err |= QH5Lite::writeStringAttribute(fileId, "/", k_DeltaAttribute, QString::fromUtf8(QJsonDocument(delta).toJson(QJsonDocument::Compact)));
+    err |= QH5Utilities::createGroupsFromPath(SIMPL::StringConstants::DataContainerGroupName, fileId);
+    hid_t dcaGid = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
+    fileSentinel.addGroupId(&dcaGid);
+
+    for(const QString& dcName : dcNames)
+    {
+      if(err < 0)
+      {
+        break;
+      }
+      DataContainer::Pointer dc = dca->getDataContainer(dcName);
+      err |= QH5Utilities::createGroupsFromPath(dcName, dcaGid);
+      hid_t dcGid = H5Gopen(dcaGid, dcName.toLatin1().data(), H5P_DEFAULT);
+      H5ScopedGroupSentinel groupSentinel(&dcGid, false);
+      err |= dc->writeMeshToHDF5(dcGid, false);
+      if(dcScopes.find(dcName) != dcScopes.end())
+      {
+        err |= dc->writeAttributeMatricesToHDF5(dcGid);
+        continue;
+      }
+      for(const DataArrayPath& amPath : amScopes)
+      {
+        if(amPath.getDataContainerName() == dcName)
+        {
+          err |= writeAttributeMatrix(dcGid, dc->getAttributeMatrix(amPath.getAttributeMatrixName()));
+        }
+      }
+    }
+  }
+  if(err < 0)
+  {
+    QFile::remove(tempFilePath);
+    return false;
+  }
+  QFile::remove(filePath);
+  if(!QFile::rename(tempFilePath, filePath))
+  {
+    QFile::remove(tempFilePath);
+    return false;
+  }
+
+  IndexEntry& entry = m_Index[key];
+  entry.Bytes = static_cast<uint64_t>(QFileInfo(filePath).size());
+  entry.LastUsed = QDateTime::currentMSecsSinceEpoch();
+  evict();
+  saveIndex();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineResultCache::restore(const QByteArray& key, const DataContainerArray::Pointer& dca)
+{
+  if(key.isEmpty() || nullptr == dca.get())
+  {
+    return false;
+  }
+
+  const QString filePath = getEntryFilePath(key);
+  auto indexIter = m_Index.find(key);
+  if(indexIter == m_Index.end() || !QFileInfo::exists(filePath))
+  {
+    m_MissCount++;
+    return false;
+  }
+
+  // An entry that cannot be read is dropped so it is written again
+  auto discard = [this, &filePath, &key]() {
+    QFile::remove(filePath);
+    m_Index.erase(key);
+    saveIndex();
+    m_MissCount++;
+    return false;
+  };
+
+  QJsonObject delta;
+  DataContainerArray::Pointer loaded = DataContainerArray::New();
+  {
+    hid_t fileId = QH5Utilities::openFile(filePath, true);
+    if(fileId < 0)
+    {
+      return discard();
+    }
+    H5ScopedFileSentinel fileSentinel(&fileId, true);
+    QString deltaJson;
+    if(QH5Lite::readStringAttribute(fileId, "/", k_DeltaAttribute, deltaJson) < 0)
+    {
+      return discard();
+    }
+    delta = QJsonDocument::fromJson(deltaJson.toUtf8()).object();
+
+    hid_t dcaGid = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
+    if(dcaGid < 0)
+    {
+      return discard();
+    }
+    fileSentinel.addGroupId(&dcaGid);
+    DataContainerArrayProxy proxy;
+    SIMPLH5DataReaderRequirements req(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Any, IGeometry::Type::Any);
+    DataContainer::ReadDataContainerStructure(dcaGid, proxy, &req, "/" + SIMPL::StringConstants::DataContainerGroupName);
+    proxy.setFlags(Qt::Checked);
+    if(loaded->readDataContainersFromHDF5(false, dcaGid, proxy, nullptr) < 0)
+    {
+      return discard();
+    }
+  }
+
+  // Make sure the delta applies before touching the DataContainerArray
+  const QJsonArray dataContainers = delta[k_DataContainers].toArray();
+  const QJsonArray attributeMatrices = delta[k_AttributeMatrices].toArray();
+  for(const QJsonValue& value : dataContainers)
+  {
+    if(nullptr == loaded->getDataContainer(value.toString()).get())
+    {
+      return discard();
+    }
+  }
+  for(const QJsonValue& value : attributeMatrices)
+  {
+    DataArrayPath amPath = DataArrayPath::Deserialize(value.toString(), "|");
+    if(nullptr == loaded->getAttributeMatrix(amPath).get())
+    {
+      return discard();
+    }
+    if(nullptr == dca->getDataContainer(amPath.getDataContainerName()).get())
+    {
+      m_MissCount++;
+      return false;
+    }
+  }
+
+  for(const QJsonValue& value : delta[k_Deleted].toArray())
+  {
+    DataArrayPath path = DataArrayPath::Deserialize(value.toString(), "|");
+    DataContainer::Pointer dc = dca->getDataContainer(path.getDataContainerName());
+    if(nullptr == dc.get())
+    {
+      continue;
+    }
+    if(path.getAttributeMatrixName().isEmpty())
+    {
+      dca->removeDataContainer(path.getDataContainerName());
+    }
+    else if(path.getDataArrayName().isEmpty())
+    {
+      dc->removeAttributeMatrix(path.getAttributeMatrixName());
+    }
+    else if(AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(path.getAttributeMatrixName()))
+    {
+      attrMat->removeAttributeArray(path.getDataArrayName());
+    }
+  }
+  for(const QJsonValue& value : dataContainers)
+  {
+    dca->addOrReplaceDataContainer(loaded->getDataContainer(value.toString()));
+  }
+  for(const QJsonValue& value : attributeMatrices)
+  {
+    DataArrayPath amPath = DataArrayPath::Deserialize(value.toString(), "|");
+    dca->getDataContainer(amPath.getDataContainerName())->addOrReplaceAttributeMatrix(loaded->getAttributeMatrix(amPath));
+  }
+
+  m_HitCount++;
+  indexIter->second.LastUsed = QDateTime::currentMSecsSinceEpoch();
+  saveIndex();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineResultCache::getEntryFilePath(const QByteArray& key) const
+{
+  return QDir(m_Directory).filePath(QString::fromLatin1(key) + k_EntrySuffix);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::loadIndex()
+{
+  QDir dir(m_Directory);
+  dir.mkpath(".");
+
+  QJsonObject lastUsed;
+  QFile indexFile(dir.filePath(k_IndexFileName));
+  if(indexFile.open(QIODevice::ReadOnly))
+  {
+    lastUsed = QJsonDocument::fromJson(indexFile.readAll()).object();
+  }
+
+  const QFileInfoList entryFiles = dir.entryInfoList(QStringList() << ("*" + k_EntrySuffix), QDir::Files);
+  for(const QFileInfo& fileInfo : entryFiles)
+  {
+    IndexEntry entry;
+    entry.Bytes = static_cast<uint64_t>(fileInfo.size());
+    entry.LastUsed = fileInfo.lastModified().toMSecsSinceEpoch();
+    const QString key = fileInfo.completeBaseName();
+    if(lastUsed.contains(key))
+    {
+      entry.LastUsed = static_cast<qint64>(lastUsed[key].toDouble());
+    }
+    m_Index[key.toLatin1()] = entry;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::saveIndex() const
+{
+  QJsonObject lastUsed;
+  for(const auto& entry : m_Index)
+  {
+    lastUsed[QString::fromLatin1(entry.first)] = static_cast<double>(entry.second.LastUsed);
+  }
+  QFile indexFile(QDir(m_Directory).filePath(k_IndexFileName));
+  if(indexFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    indexFile.write(QJsonDocument(lastUsed).toJson(QJsonDocument::Compact));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineResultCache::evict()
+{
+  if(m_MaxBytes == 0)
+  {
+    return;
+  }
+  uint64_t numBytes = getDiskUsage();
+  while(numBytes > m_MaxBytes && !m_Index.empty())
+  {
+    auto oldest = std::min_element(m_Index.begin(), m_Index.end(), [](const std::pair<const QByteArray, IndexEntry>& lhs, const std::pair<const QByteArray, IndexEntry>& rhs) {
+      return lhs.second.LastUsed < rhs.second.LastUsed;
+    });
+    QFile::remove(getEntryFilePath(oldest->first));
+    numBytes -= oldest->second.Bytes;
+    m_Index.erase(oldest);
+    m_EvictionCount++;
+  }
+}
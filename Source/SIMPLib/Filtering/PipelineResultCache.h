@@ -0,0 +1,201 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <list>
+#include <map>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The PipelineResultCache class keeps what filters did to the DataContainerArray
+ * on disk so FilterPipeline::execute() can put the result of an earlier run back in
+ * place instead of executing the filter again.
+ *
+ * The key of a result is a hash of the filter's Uuid, its parameters and the contents
+ * of everything it reads, which is every DataContainer, AttributeMatrix or array named
+ * by its DataArrayPath properties (the whole DataContainerArray when it has none). The
+ * result is the delta the filter left behind: the paths it deleted plus the
+ * DataContainers and AttributeMatrices it created or was pointed at, written as a
+ * small .dream3d style HDF5 file named after the key. Because the key only depends on
+ * the inputs, the filters of a rerun pipeline keep restoring their deltas until the
+ * first filter whose inputs changed, which makes execution resume from the last valid
+ * checkpoint. Filters that write files are never cached.
+ *
+ * The least recently used results are removed once the files take up more than
+ * MaxBytes on disk.
+ */
+class SIMPLib_EXPORT PipelineResultCache
+{
+public:
+  SIMPL_SHARED_POINTERS(PipelineResultCache)
+  SIMPL_TYPE_MACRO(PipelineResultCache)
+
+  /**
+   * @brief Creates a cache that keeps its files in directory. The directory is created if needed.
+   * @param directory
+   * @param maxBytes
+   * @return
+   */
+  static Pointer New(const QString& directory, uint64_t maxBytes);
+
+  virtual ~PipelineResultCache();
+
+  SIMPL_GET_PROPERTY(QString, Directory)
+
+  /**
+   * @brief The most bytes the cached results may take up on disk, 0 for no limit.
+   * A smaller value takes effect with the next store().
+   */
+  SIMPL_INSTANCE_PROPERTY(uint64_t, MaxBytes)
+
+  /**
+   * @brief The number of restore() calls that found a result
+   */
+  SIMPL_GET_PROPERTY(size_t, HitCount)
+
+  /**
+   * @brief The number of restore() calls that did not find a result
+   */
+  SIMPL_GET_PROPERTY(size_t, MissCount)
+
+  /**
+   * @brief The number of results removed to stay under MaxBytes
+   */
+  SIMPL_GET_PROPERTY(size_t, EvictionCount)
+
+  /**
+   * @brief Returns the number of bytes the cached results take up on disk
+   * @return
+   */
+  uint64_t getDiskUsage() const;
+
+  /**
+   * @brief Sets the hit, miss and eviction counts back to zero
+   */
+  void resetStatistics();
+
+  /**
+   * @brief Removes every cached result from disk
+   */
+  void clear();
+
+  /**
+   * @brief Returns the key for executing the filter on the DataContainerArray as it
+   * is now, or an empty QByteArray if the filter cannot be cached.
+   * @param filter
+   * @param dca
+   * @return
+   */
+  QByteArray createKey(AbstractFilter* filter, const DataContainerArray::Pointer& dca) const;
+
+  /**
+   * @brief Applies the result stored under key to the DataContainerArray. Returns
+   * false, leaving the DataContainerArray untouched, if there is no usable result.
+   * @param key
+   * @param dca
+   * @return
+   */
+  bool restore(const QByteArray& key, const DataContainerArray::Pointer& dca);
+
+  /**
+   * @brief Stores what the filter just did to the DataContainerArray under key
+   * @param key The key createKey() returned before the filter executed
+   * @param filter
+   * @param pathsBefore The paths the DataContainerArray held before the filter executed
+   * @param dca
+   * @return
+   */
+  bool store(const QByteArray& key, AbstractFilter* filter, const std::list<DataArrayPath>& pathsBefore, const DataContainerArray::Pointer& dca);
+
+  /**
+   * @brief Returns false for filters with side effects outside the DataContainerArray,
+   * which currently means filters with an output file or output path parameter.
+   * @param filter
+   * @return
+   */
+  static bool IsCacheable(AbstractFilter* filter);
+
+protected:
+  PipelineResultCache(const QString& directory, uint64_t maxBytes);
+
+private:
+  struct IndexEntry
+  {
+    uint64_t Bytes = 0;
+    qint64 LastUsed = 0;
+  };
+
+  QString m_Directory;
+  size_t m_HitCount = 0;
+  size_t m_MissCount = 0;
+  size_t m_EvictionCount = 0;
+  std::map<QByteArray, IndexEntry> m_Index;
+
+  /**
+   * @brief Returns the path of the file for key
+   * @param key
+   * @return
+   */
+  QString getEntryFilePath(const QByteArray& key) const;
+
+  /**
+   * @brief Picks up the results left in the directory by earlier sessions
+   */
+  void loadIndex();
+
+  /**
+   * @brief Writes the last use times so the eviction order survives the session
+   */
+  void saveIndex() const;
+
+  /**
+   * @brief Removes least recently used results until the cache fits into MaxBytes
+   */
+  void evict();
+
+public:
+  PipelineResultCache(const PipelineResultCache&) = delete;            // Copy Constructor Not Implemented
+  PipelineResultCache(PipelineResultCache&&) = delete;                 // Move Constructor Not Implemented
+  PipelineResultCache& operator=(const PipelineResultCache&) = delete; // Copy Assignment Not Implemented
+  PipelineResultCache& operator=(PipelineResultCache&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,187 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PreflightCache.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMetaProperty>
+#include <QtCore/QVariant>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PreflightCache::PreflightCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PreflightCache::~PreflightCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const PreflightCache::Entry* PreflightCache::find(size_t index, const AbstractFilter::Pointer& filter, const QByteArray& parameters, const QByteArray& inputStructure) const
+{
+  if(index >= m_Entries.size() || nullptr == m_Entries[index])
+  {
+    return nullptr;
+  }
+  const Entry* entry = m_Entries[index].get();
+  if(entry->Filter.lock() != filter || entry->InputStructure != inputStructure || entry->Parameters != parameters)
+  {
+    return nullptr;
+  }
+  return entry;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PreflightCache::store(size_t index, Entry entry)
+{
+  if(index >= m_Entries.size())
+  {
+    m_Entries.resize(index + 1);
+  }
+  m_Entries[index].reset(new Entry(std::move(entry)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PreflightCache::remove(size_t index)
+{
+  if(index < m_Entries.size())
+  {
+    m_Entries[index].reset();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PreflightCache::truncate(size_t numFilters)
+{
+  if(numFilters < m_Entries.size())
+  {
+    m_Entries.resize(numFilters);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PreflightCache::clear()
+{
+  m_Entries.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray PreflightCache::CreateParameterKey(AbstractFilter* filter)
+{
+  QJsonObject parameters;
+  filter->writeFilterParameters(parameters);
+  QByteArray key = filter->getNameOfClass().toUtf8();
+  key.append('\n');
+  key.append(QJsonDocument(parameters).toJson(QJsonDocument::Compact));
+
+  // Readers are preflighted against the contents of their input files
+  const QMetaObject* metaObject = filter->metaObject();
+  for(int i = 0; i < metaObject->propertyCount(); i++)
+  {
+    QMetaProperty property = metaObject->property(i);
+    if(property.userType() != QMetaType::QString)
+    {
+      continue;
+    }
+    QString value = property.read(filter).toString();
+    if(value.isEmpty())
+    {
+      continue;
+    }
+    QFileInfo fileInfo(value);
+    if(fileInfo.isAbsolute() && fileInfo.exists())
+    {
+      key.append('\n');
+      key.append(value.toUtf8());
+      key.append('\n');
+      key.append(QByteArray::number(fileInfo.size()));
+      key.append('\n');
+      key.append(QByteArray::number(fileInfo.lastModified().toMSecsSinceEpoch()));
+    }
+  }
+  return key;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray PreflightCache::CreateStructureKey(const DataContainerArray::Pointer& dca)
+{
+  QByteArray structure;
+  QDataStream out(&structure, QIODevice::WriteOnly);
+  if(nullptr != dca.get())
+  {
+    for(const DataContainer::Pointer& dc : dca->getDataContainers())
+    {
+      out << dc->getName();
+      IGeometry::Pointer geom = dc->getGeometry();
+      out << (nullptr == geom.get() ? QString() : geom->getInfoString(SIMPL::HtmlFormat));
+      for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+      {
+        out << am->getName() << static_cast<quint32>(am->getType());
+        for(size_t dim : am->getTupleDimensions())
+        {
+          out << static_cast<quint64>(dim);
+        }
+        for(const IDataArray::Pointer& da : *am)
+        {
+          out << da->getName() << da->getNameOfClass() << da->getTypeAsString() << static_cast<quint64>(da->getNumberOfTuples());
+          for(size_t dim : da->getComponentDimensions())
+          {
+            out << static_cast<quint64>(dim);
+          }
+        }
+      }
+    }
+  }
+  return QCryptographicHash::hash(structure, QCryptographicHash::Sha1);
+}
@@ -0,0 +1,138 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The PreflightCache class remembers what each filter of a pipeline produced
+ * the last time it was preflighted so FilterPipeline::preflightPipeline() only has
+ * to preflight the filters whose parameters or incoming structure changed.
+ *
+ * An entry is keyed by the filter's parameters (see CreateParameterKey) and the
+ * structure of the DataContainerArray it was preflighted against (see
+ * CreateStructureKey). Preflight never allocates array data, so a filter given the
+ * same parameters and the same structure produces the same structure again and the
+ * cached snapshot can be handed back without running the filter. Snapshots are
+ * shared with the filters and must be treated as read only.
+ */
+class SIMPLib_EXPORT PreflightCache
+{
+public:
+  using WarningList = std::vector<std::pair<int, QString>>;
+
+  struct Entry
+  {
+    std::weak_ptr<AbstractFilter> Filter;
+    QByteArray Parameters;
+    QByteArray InputStructure;
+    QByteArray OutputStructure;
+    DataContainerArray::Pointer Snapshot;
+    WarningList Warnings;
+  };
+
+  PreflightCache();
+  virtual ~PreflightCache();
+
+  /**
+   * @brief Returns the entry for the filter at index if it was stored for the same
+   * filter, parameters and input structure. Returns nullptr otherwise.
+   * @param index
+   * @param filter
+   * @param parameters
+   * @param inputStructure
+   * @return
+   */
+  const Entry* find(size_t index, const AbstractFilter::Pointer& filter, const QByteArray& parameters, const QByteArray& inputStructure) const;
+
+  /**
+   * @brief Stores the entry for the filter at index, replacing any previous one
+   * @param index
+   * @param entry
+   */
+  void store(size_t index, Entry entry);
+
+  /**
+   * @brief Removes the entry at index
+   * @param index
+   */
+  void remove(size_t index);
+
+  /**
+   * @brief Drops the entries past the given number of filters
+   * @param numFilters
+   */
+  void truncate(size_t numFilters);
+
+  /**
+   * @brief Removes all entries
+   */
+  void clear();
+
+  /**
+   * @brief Returns the serialized parameters of the filter. Existing files named by
+   * QString properties add their size and modification time so editing an input
+   * file on disk invalidates the entry.
+   * @param filter
+   * @return
+   */
+  static QByteArray CreateParameterKey(AbstractFilter* filter);
+
+  /**
+   * @brief Returns a digest of the names, types, tuple and component dimensions and
+   * geometries held in the DataContainerArray. A null pointer is treated as empty.
+   * @param dca
+   * @return
+   */
+  static QByteArray CreateStructureKey(const DataContainerArray::Pointer& dca);
+
+private:
+  std::vector<std::unique_ptr<Entry>> m_Entries;
+
+public:
+  PreflightCache(const PreflightCache&) = delete;            // Copy Constructor Not Implemented
+  PreflightCache(PreflightCache&&) = delete;                 // Move Constructor Not Implemented
+  PreflightCache& operator=(const PreflightCache&) = delete; // Copy Assignment Not Implemented
+  PreflightCache& operator=(PreflightCache&&) = delete;      // Move Assignment Not Implemented
+};
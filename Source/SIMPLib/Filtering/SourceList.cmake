@@ -20,12 +20,20 @@ set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPER
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AbstractComparison.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ArrayLivenessAnalysis.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonSet.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonValue.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CoreConstants.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ElementWiseFusion.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ElementWiseKernel.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterFactory.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterManager.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IFilterFactory.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineBatch.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineDependencyGraph.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineProfile.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineResultCache.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PreflightCache.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/QMetaObjectUtilities.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ThresholdFilterHelper.h
 )
@@ -35,13 +43,21 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AbstractComparison.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AbstractDecisionFilter.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AbstractFilter.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ArrayLivenessAnalysis.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonInputs.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonInputsAdvanced.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonSet.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComparisonValue.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CorePlugin.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ElementWiseFusion.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ElementWiseKernel.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterManager.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilterPipeline.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineBatch.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineDependencyGraph.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineProfile.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineResultCache.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PreflightCache.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/QMetaObjectUtilities.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ThresholdFilterHelper.cpp
 )
@@ -33,13 +33,31 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+
+#include <QtCore/QDir>
 #include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+
+#include <hdf5.h>
 
 //#include "Applications/DREAM3D/DREAM3DApplication.h"
 
 #include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/CoreFilters/ConditionalSetValue.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/MultiThresholdObjects2.h"
+#include "SIMPLib/CoreFilters/ReplaceValueInArray.h"
+#include "SIMPLib/CoreFilters/WriteASCIIData.h"
+#include "SIMPLib/Filtering/ArrayLivenessAnalysis.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineBatch.h"
+#include "SIMPLib/Filtering/PipelineDependencyGraph.h"
+#include "SIMPLib/Filtering/PipelineProfile.h"
+#include "SIMPLib/Filtering/PipelineResultCache.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -83,6 +101,10 @@ public:
   {
     return UnitTest::TestTempDir + QString("/FilterPipelineTest.dream3d");
   }
+  QString resultCacheDir()
+  {
+    return UnitTest::TestTempDir + QString("/FilterPipelineTest_ResultCache");
+  }
 
   // -----------------------------------------------------------------------------
   //
@@ -91,6 +113,7 @@ public:
   {
 #if REMOVE_TEST_FILES
     QFile::remove(outputDREAM3DFile());
+    QDir(resultCacheDir()).removeRecursively();
 #endif
   }
 
@@ -150,6 +173,564 @@ public:
 #endif
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer createIndependentBranchesPipeline()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    std::vector<std::vector<double>> tupleDims = {{10.0, 10.0}};
+
+    for(const QString& dcName : {QString("A"), QString("B")})
+    {
+      CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+      createDc->setDataContainerName(DataArrayPath(dcName, "", ""));
+      pipeline->pushBack(createDc);
+    }
+    for(const QString& dcName : {QString("A"), QString("B")})
+    {
+      CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+      createAm->setCreatedAttributeMatrix(DataArrayPath(dcName, "AM", ""));
+      createAm->setTupleDimensions(DynamicTableData(tupleDims));
+      createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+      pipeline->pushBack(createAm);
+    }
+    for(const QString& dcName : {QString("A"), QString("B")})
+    {
+      CreateDataArray::Pointer createDa = CreateDataArray::New();
+      createDa->setNewArray(DataArrayPath(dcName, "AM", "Values"));
+      createDa->setScalarType(SIMPL::ScalarTypes::Type::Int32);
+      createDa->setNumberOfComponents(1);
+      createDa->setInitializationType(CreateDataArray::Manual);
+      createDa->setInitializationValue("7");
+      pipeline->pushBack(createDa);
+    }
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool dependsOn(const PipelineDependencyGraph& graph, size_t later, size_t earlier)
+  {
+    const PipelineDependencyGraph::IndexList& deps = graph.getDependencies(later);
+    return std::find(deps.begin(), deps.end(), earlier) != deps.end();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDependencyGraph()
+  {
+    FilterPipeline::Pointer pipeline = createIndependentBranchesPipeline();
+    int err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+
+    PipelineDependencyGraph graph;
+    graph.build(pipeline->getFilterContainer());
+    DREAM3D_REQUIRE_EQUAL(graph.size(), 6)
+
+    // Creating a DataContainer changes the DataContainerArray itself
+    DREAM3D_REQUIRED(graph.isBarrier(0), ==, true)
+    DREAM3D_REQUIRED(graph.isBarrier(1), ==, true)
+    DREAM3D_REQUIRED(graph.isBarrier(2), ==, false)
+    DREAM3D_REQUIRED(graph.isBarrier(5), ==, false)
+
+    DREAM3D_REQUIRED(dependsOn(graph, 2, 1), ==, true)
+    DREAM3D_REQUIRED(dependsOn(graph, 3, 2), ==, false)
+    DREAM3D_REQUIRED(dependsOn(graph, 4, 2), ==, true)
+    DREAM3D_REQUIRED(dependsOn(graph, 4, 3), ==, false)
+    DREAM3D_REQUIRED(dependsOn(graph, 5, 3), ==, true)
+    DREAM3D_REQUIRED(dependsOn(graph, 5, 4), ==, false)
+
+    // A filter that writes files runs on its own even though it only reads from "A"
+    WriteASCIIData::Pointer writer = WriteASCIIData::New();
+    writer->setSelectedDataArrayPaths(QVector<DataArrayPath>(1, DataArrayPath("A", "AM", "Values")));
+    writer->setOutputPath(UnitTest::TestTempDir);
+    pipeline->pushBack(writer);
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(writer->getAccessesFiles(), ==, true)
+    DREAM3D_REQUIRED(pipeline->getFilterContainer()[5]->getAccessesFiles(), ==, false)
+
+    graph.build(pipeline->getFilterContainer());
+    DREAM3D_REQUIRE_EQUAL(graph.size(), 7)
+    DREAM3D_REQUIRED(graph.isBarrier(6), ==, true)
+    DREAM3D_REQUIRED(dependsOn(graph, 6, 5), ==, true)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestParallelExecution()
+  {
+    FilterPipeline::Pointer pipeline = createIndependentBranchesPipeline();
+    pipeline->setExecutionMode(FilterPipeline::ExecutionMode::Parallel);
+    pipeline->setMaxConcurrentFilters(2);
+
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    DREAM3D_REQUIRE(pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Completed)
+
+    for(const QString& dcName : {QString("A"), QString("B")})
+    {
+      Int32ArrayType::Pointer values = dca->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, DataArrayPath(dcName, "AM", "Values"), {1});
+      DREAM3D_REQUIRE_VALID_POINTER(values.get())
+      DREAM3D_REQUIRE_EQUAL(values->getNumberOfTuples(), 100)
+      DREAM3D_REQUIRE_EQUAL(values->getValue(99), 7)
+    }
+
+    // Connections made to a filter outside of the pipeline survive the parallel run
+    AbstractFilter::Pointer first = pipeline->getFilterContainer().front();
+    int received = 0;
+    QMetaObject::Connection observer = QObject::connect(first.get(), &AbstractFilter::messageGenerated, [&received](const AbstractMessage::Pointer&) { received++; });
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    received = 0;
+    first->notifyStatusMessage("Still connected");
+    DREAM3D_REQUIRE_EQUAL(received, 1)
+    QObject::disconnect(observer);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIncrementalPreflight()
+  {
+    FilterPipeline::Pointer pipeline = createIndependentBranchesPipeline();
+    FilterPipeline::FilterContainerType& filters = pipeline->getFilterContainer();
+    int err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+
+    std::vector<DataContainerArray::Pointer> snapshots;
+    for(const auto& filter : filters)
+    {
+      snapshots.push_back(filter->getDataContainerArray());
+    }
+
+    // Nothing changed so every filter gets its last snapshot back
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    for(int i = 0; i < filters.size(); i++)
+    {
+      DREAM3D_REQUIRE(filters[i]->getDataContainerArray() == snapshots[i])
+    }
+
+    // A new initialization value does not change the structure the last filter sees
+    std::dynamic_pointer_cast<CreateDataArray>(filters[4])->setInitializationValue("8");
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    for(int i = 0; i < 4; i++)
+    {
+      DREAM3D_REQUIRE(filters[i]->getDataContainerArray() == snapshots[i])
+    }
+    DREAM3D_REQUIRE(filters[4]->getDataContainerArray() != snapshots[4])
+    DREAM3D_REQUIRE(filters[5]->getDataContainerArray() == snapshots[5])
+
+    // New tuple dimensions change what every later filter sees
+    std::vector<std::vector<double>> tupleDims = {{5.0, 5.0}};
+    std::dynamic_pointer_cast<CreateAttributeMatrix>(filters[2])->setTupleDimensions(DynamicTableData(tupleDims));
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE(filters[1]->getDataContainerArray() == snapshots[1])
+    for(int i = 2; i < filters.size(); i++)
+    {
+      DREAM3D_REQUIRE(filters[i]->getDataContainerArray() != snapshots[i])
+    }
+    AttributeMatrix::Pointer am = filters[5]->getDataContainerArray()->getAttributeMatrix(DataArrayPath("A", "AM", ""));
+    DREAM3D_REQUIRE_VALID_POINTER(am.get())
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), 25)
+
+    // execute() preflights every filter again instead of reusing the cached results, which
+    // replaces the cached snapshots with the ones of that preflight
+    for(int i = 0; i < filters.size(); i++)
+    {
+      snapshots[i] = filters[i]->getDataContainerArray();
+    }
+    pipeline->setReleaseUnusedArrays(true);
+    pipeline->setKeptArrayPaths({DataArrayPath("A", "AM", "Values")});
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    Int32ArrayType::Pointer values = dca->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, DataArrayPath("A", "AM", "Values"), {1});
+    DREAM3D_REQUIRE_VALID_POINTER(values.get())
+    DREAM3D_REQUIRE_EQUAL(values->getValue(24), 8)
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    for(int i = 0; i < filters.size(); i++)
+    {
+      DREAM3D_REQUIRE(filters[i]->getDataContainerArray() != snapshots[i])
+    }
+
+    pipeline->clearPreflightCache();
+    DataContainerArray::Pointer lastSnapshot = filters[5]->getDataContainerArray();
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE(filters[5]->getDataContainerArray() != lastSnapshot)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int32_t executeWithResultCache(const PipelineResultCache::Pointer& cache, const QString& initValueA)
+  {
+    FilterPipeline::Pointer pipeline = createIndependentBranchesPipeline();
+    std::dynamic_pointer_cast<CreateDataArray>(pipeline->getFilterContainer()[4])->setInitializationValue(initValueA);
+    pipeline->setResultCache(cache);
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    DREAM3D_REQUIRE(pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Completed)
+
+    Int32ArrayType::Pointer valuesB = dca->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, DataArrayPath("B", "AM", "Values"), {1});
+    DREAM3D_REQUIRE_VALID_POINTER(valuesB.get())
+    DREAM3D_REQUIRE_EQUAL(valuesB->getValue(99), 7)
+
+    Int32ArrayType::Pointer valuesA = dca->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, DataArrayPath("A", "AM", "Values"), {1});
+    DREAM3D_REQUIRE_VALID_POINTER(valuesA.get())
+    DREAM3D_REQUIRE_EQUAL(valuesA->getNumberOfTuples(), 100)
+    return valuesA->getValue(99);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestResultCache()
+  {
+    QDir(resultCacheDir()).removeRecursively();
+    PipelineResultCache::Pointer cache = PipelineResultCache::New(resultCacheDir(), 0);
+
+    DREAM3D_REQUIRE_EQUAL(executeWithResultCache(cache, "7"), 7)
+    DREAM3D_REQUIRE_EQUAL(cache->getHitCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getMissCount(), 6)
+    DREAM3D_REQUIRE(cache->getDiskUsage() > 0)
+
+    // A fresh pipeline with the same filters restores every result
+    cache->resetStatistics();
+    DREAM3D_REQUIRE_EQUAL(executeWithResultCache(cache, "7"), 7)
+    DREAM3D_REQUIRE_EQUAL(cache->getHitCount(), 6)
+    DREAM3D_REQUIRE_EQUAL(cache->getMissCount(), 0)
+
+    // Only the changed filter executes, the B branch after it is still restored
+    cache->resetStatistics();
+    DREAM3D_REQUIRE_EQUAL(executeWithResultCache(cache, "8"), 8)
+    DREAM3D_REQUIRE_EQUAL(cache->getHitCount(), 5)
+    DREAM3D_REQUIRE_EQUAL(cache->getMissCount(), 1)
+
+    // Results left on disk are picked up by a new cache on the same directory
+    PipelineResultCache::Pointer reopened = PipelineResultCache::New(resultCacheDir(), 0);
+    DREAM3D_REQUIRE_EQUAL(reopened->getDiskUsage(), cache->getDiskUsage())
+    DREAM3D_REQUIRE_EQUAL(executeWithResultCache(reopened, "8"), 8)
+    DREAM3D_REQUIRE_EQUAL(reopened->getHitCount(), 6)
+
+    // A budget smaller than any result evicts everything that gets stored
+    reopened->setMaxBytes(1);
+    DREAM3D_REQUIRE_EQUAL(executeWithResultCache(reopened, "9"), 9)
+    DREAM3D_REQUIRE(reopened->getEvictionCount() > 0)
+    DREAM3D_REQUIRE_EQUAL(reopened->getDiskUsage(), 0)
+
+    reopened->clear();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestArrayLiveness()
+  {
+    const DataArrayPath valuesA("A", "AM", "Values");
+    const DataArrayPath valuesB("B", "AM", "Values");
+
+    // No later filter reads either array so each one dies with the filter creating it
+    FilterPipeline::Pointer pipeline = createIndependentBranchesPipeline();
+    int err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    ArrayLivenessAnalysis liveness;
+    liveness.analyze(pipeline->getFilterContainer(), {valuesB});
+    DREAM3D_REQUIRE_EQUAL(liveness.getReleaseCount(), 1)
+    DREAM3D_REQUIRE_EQUAL(liveness.getReleasesAfter(4).size(), 1)
+    DREAM3D_REQUIRE(liveness.getReleasesAfter(4).front() == valuesA)
+    DREAM3D_REQUIRE(liveness.getReleasesAfter(5).empty())
+
+    for(FilterPipeline::ExecutionMode mode : {FilterPipeline::ExecutionMode::Serial, FilterPipeline::ExecutionMode::Parallel})
+    {
+      pipeline = createIndependentBranchesPipeline();
+      pipeline->setExecutionMode(mode);
+      pipeline->setMaxConcurrentFilters(2);
+      pipeline->setReleaseUnusedArrays(true);
+      pipeline->setKeptArrayPaths({valuesB});
+
+      DataContainerArray::Pointer dca = pipeline->execute();
+      DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+      DREAM3D_REQUIRE(pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Completed)
+      DREAM3D_REQUIRE_EQUAL(dca->doesAttributeArrayExist(valuesA), false)
+      DREAM3D_REQUIRE_EQUAL(dca->doesAttributeArrayExist(valuesB), true)
+      DREAM3D_REQUIRE_EQUAL(pipeline->getReleasedArrayCount(), 1)
+      DREAM3D_REQUIRE_EQUAL(pipeline->getReleasedBytes(), 100 * sizeof(int32_t))
+      DREAM3D_REQUIRE(pipeline->getPeakBytesSaved() <= pipeline->getReleasedBytes())
+      if(mode == FilterPipeline::ExecutionMode::Serial)
+      {
+        // The A values were gone before the B values were created
+        DREAM3D_REQUIRE_EQUAL(pipeline->getPeakBytesSaved(), 100 * sizeof(int32_t))
+      }
+    }
+
+    // Releasing is off by default
+    pipeline = createIndependentBranchesPipeline();
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(dca->doesAttributeArrayExist(valuesA), true)
+    DREAM3D_REQUIRE_EQUAL(pipeline->getReleasedArrayCount(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestProfile()
+  {
+    for(FilterPipeline::ExecutionMode mode : {FilterPipeline::ExecutionMode::Serial, FilterPipeline::ExecutionMode::Parallel})
+    {
+      FilterPipeline::Pointer pipeline = createIndependentBranchesPipeline();
+      pipeline->setExecutionMode(mode);
+      pipeline->setMaxConcurrentFilters(2);
+      PipelineProfile::Pointer profile = PipelineProfile::New();
+      pipeline->setProfile(profile);
+      pipeline->execute();
+      DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+
+      const std::vector<PipelineProfile::FilterRecord>& records = profile->getFilterRecords();
+      DREAM3D_REQUIRE_EQUAL(records.size(), 6)
+      for(size_t i = 0; i < records.size(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(records[i].PipelineIndex, static_cast<int>(i))
+        DREAM3D_REQUIRE(records[i].Lane >= 1)
+        DREAM3D_REQUIRE(records[i].WallTime >= 0)
+        DREAM3D_REQUIRE(records[i].StartTime + records[i].WallTime <= profile->getWallTime())
+      }
+      // Each CreateDataArray allocates its 100 Int32 values
+      DREAM3D_REQUIRE(records[4].BytesAllocated >= 100 * sizeof(int32_t))
+      DREAM3D_REQUIRE(records[5].BytesAllocated >= 100 * sizeof(int32_t))
+      DREAM3D_REQUIRE_EQUAL(records[5].ArrayCount, 2)
+      DREAM3D_REQUIRE(profile->getBytesAllocated() >= 200 * sizeof(int32_t))
+
+      QJsonObject report = profile->toJson();
+      DREAM3D_REQUIRE_EQUAL(report["Filters"].toArray().size(), 6)
+
+      // One complete event for the pipeline and one per filter
+      int completeEvents = 0;
+      for(const QJsonValue& event : profile->toChromeTrace()["traceEvents"].toArray())
+      {
+        if(event.toObject()["ph"].toString() == "X")
+        {
+          completeEvents++;
+        }
+      }
+      DREAM3D_REQUIRE_EQUAL(completeEvents, 7)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  PipelineBatch::Job createBatchJob(const QString& name, const QString& filterKey, const QString& parameter, const QJsonValue& value)
+  {
+    QJsonObject parameters;
+    parameters[parameter] = value;
+    PipelineBatch::Job job;
+    job.Name = name;
+    job.Overrides[filterKey] = parameters;
+    return job;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPipelineBatch()
+  {
+    QJsonObject pipelineJson = createIndependentBranchesPipeline()->toJson();
+
+    QString errorMessage;
+    QJsonObject overridden = PipelineBatch::ApplyOverrides(pipelineJson, createBatchJob("", "4", "InitializationValue", "3").Overrides, errorMessage);
+    DREAM3D_REQUIRE(errorMessage.isEmpty())
+    DREAM3D_REQUIRE_EQUAL(overridden["4"].toObject()["InitializationValue"].toString(), QString("3"))
+    DREAM3D_REQUIRE_EQUAL(pipelineJson["4"].toObject()["InitializationValue"].toString(), QString("7"))
+
+    PipelineBatch::Pointer batch = PipelineBatch::New(pipelineJson);
+    batch->setMaxConcurrentJobs(2);
+    batch->addJob(createBatchJob("A", "4", "InitializationValue", "3"));
+    batch->addJob(createBatchJob("B", "5", "InitializationValue", "4"));
+    batch->addJob(createBatchJob("NoFilter", "9", "InitializationValue", "4"));
+    batch->addJob(createBatchJob("NoParameter", "4", "NoSuchParameter", "4"));
+    batch->addJob(createBatchJob("BadValue", "4", "InitializationValue", "abc"));
+#ifdef H5_HAVE_THREADSAFE
+    DREAM3D_REQUIRE_EQUAL(batch->getJobConcurrency(), 2)
+#else
+    DREAM3D_REQUIRE_EQUAL(batch->getJobConcurrency(), 1)
+#endif
+    std::vector<PipelineBatch::Result> results = batch->run();
+
+    DREAM3D_REQUIRE_EQUAL(results.size(), 5)
+    DREAM3D_REQUIRE_EQUAL(results[0].Name, QString("A"))
+    DREAM3D_REQUIRE_EQUAL(results[0].Status, QString("Completed"))
+    DREAM3D_REQUIRE_EQUAL(results[0].ErrorCode, 0)
+    DREAM3D_REQUIRE_EQUAL(results[1].Status, QString("Completed"))
+    for(size_t i = 2; i < results.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(results[i].Status, QString("Failed"))
+      DREAM3D_REQUIRE(results[i].ErrorCode < 0)
+      DREAM3D_REQUIRE(!results[i].Errors.isEmpty())
+    }
+
+    QJsonObject summary = batch->getSummary();
+    DREAM3D_REQUIRE_EQUAL(summary["CompletedCount"].toInt(), 2)
+    DREAM3D_REQUIRE_EQUAL(summary["FailedCount"].toInt(), 3)
+    DREAM3D_REQUIRE_EQUAL(summary["Jobs"].toArray().size(), 5)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createFusionInput(size_t numTuples)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("A");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer am = AttributeMatrix::New({numTuples}, "AM", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(am);
+
+    Int32ArrayType::Pointer values = Int32ArrayType::CreateArray(numTuples, "Values", true);
+    FloatArrayType::Pointer weights = FloatArrayType::CreateArray(numTuples, "Weights", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      values->setValue(i, static_cast<int32_t>(i % 23));
+      weights->setValue(i, static_cast<float>(i) * 0.5f);
+    }
+    am->addOrReplaceAttributeArray(values);
+    am->addOrReplaceAttributeArray(weights);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Mask = Values > 5 AND NOT (Weights < 1000 OR Values == 20), then Values = 0
+  // where Mask is set and 3 is replaced with 100
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer createFusionPipeline()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    ComparisonValue::Pointer greater = ComparisonValue::New();
+    greater->setAttributeArrayName("Values");
+    greater->setCompOperator(SIMPL::Comparison::Operator_GreaterThan);
+    greater->setCompValue(5.0);
+
+    ComparisonValue::Pointer less = ComparisonValue::New();
+    less->setAttributeArrayName("Weights");
+    less->setCompOperator(SIMPL::Comparison::Operator_LessThan);
+    less->setCompValue(1000.0);
+    ComparisonValue::Pointer equal = ComparisonValue::New();
+    equal->setAttributeArrayName("Values");
+    equal->setCompOperator(SIMPL::Comparison::Operator_Equal);
+    equal->setCompValue(20.0);
+    equal->setUnionOperator(SIMPL::Union::Operator_Or);
+    ComparisonSet::Pointer set = ComparisonSet::New();
+    set->addComparison(less);
+    set->addComparison(equal);
+    set->setInvertComparison(true);
+    set->setUnionOperator(SIMPL::Union::Operator_And);
+
+    ComparisonInputsAdvanced thresholds;
+    thresholds.setDataContainerName("A");
+    thresholds.setAttributeMatrixName("AM");
+    thresholds.addInput(greater);
+    thresholds.addInput(set);
+
+    MultiThresholdObjects2::Pointer threshold = MultiThresholdObjects2::New();
+    threshold->setSelectedThresholds(thresholds);
+    threshold->setDestinationArrayName("Mask");
+    pipeline->pushBack(threshold);
+
+    ConditionalSetValue::Pointer setValue = ConditionalSetValue::New();
+    setValue->setSelectedArrayPath(DataArrayPath("A", "AM", "Values"));
+    setValue->setConditionalArrayPath(DataArrayPath("A", "AM", "Mask"));
+    setValue->setReplaceValue(0.0);
+    pipeline->pushBack(setValue);
+
+    ReplaceValueInArray::Pointer replaceValue = ReplaceValueInArray::New();
+    replaceValue->setSelectedArray(DataArrayPath("A", "AM", "Values"));
+    replaceValue->setRemoveValue(3.0);
+    replaceValue->setReplaceValue(100.0);
+    pipeline->pushBack(replaceValue);
+
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestElementWiseFusion()
+  {
+    // Enough tuples for several blocks and a partial one at the end
+    const size_t numTuples = 3 * ElementWiseFusion::k_BlockSize + 101;
+
+    for(bool fuse : {true, false})
+    {
+      FilterPipeline::Pointer pipeline = createFusionPipeline();
+      pipeline->setFuseElementWiseFilters(fuse);
+      DataContainerArray::Pointer dca = pipeline->execute(createFusionInput(numTuples));
+      DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+      DREAM3D_REQUIRE(pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Completed)
+
+      ElementWiseFusion::GroupList groups = pipeline->getFusedFilterGroups();
+      if(fuse)
+      {
+        DREAM3D_REQUIRE_EQUAL(groups.size(), 1)
+        DREAM3D_REQUIRE_EQUAL(groups[0].FilterIndices.size(), 3)
+        DREAM3D_REQUIRE(groups[0].AttributeMatrixPath == DataArrayPath("A", "AM", ""))
+      }
+      else
+      {
+        DREAM3D_REQUIRE_EQUAL(groups.size(), 0)
+      }
+
+      Int32ArrayType::Pointer values = dca->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, DataArrayPath("A", "AM", "Values"), {1});
+      BoolArrayType::Pointer mask = dca->getPrereqArrayFromPath<BoolArrayType, AbstractFilter>(nullptr, DataArrayPath("A", "AM", "Mask"), {1});
+      DREAM3D_REQUIRE_VALID_POINTER(values.get())
+      DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+      for(size_t i = 0; i < numTuples; i++)
+      {
+        int32_t value = static_cast<int32_t>(i % 23);
+        float weight = static_cast<float>(i) * 0.5f;
+        bool expectedMask = (value > 5) && !(weight < 1000.0f || value == 20);
+        int32_t expectedValue = expectedMask ? 0 : (value == 3 ? 100 : value);
+        DREAM3D_REQUIRE_EQUAL(mask->getValue(i), expectedMask)
+        DREAM3D_REQUIRE_EQUAL(values->getValue(i), expectedValue)
+      }
+    }
+
+    // A failing filter still leaves the filters before it completed
+    FilterPipeline::Pointer pipeline = createFusionPipeline();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getFuseElementWiseFilters(), false)
+    pipeline->setFuseElementWiseFilters(true);
+    std::dynamic_pointer_cast<ReplaceValueInArray>(pipeline->getFilterContainer()[2])->setSelectedArray(DataArrayPath("A", "AM", "Missing"));
+    DataContainerArray::Pointer dca = pipeline->execute(createFusionInput(numTuples));
+    DREAM3D_REQUIRE(pipeline->getErrorCode() < 0)
+    DREAM3D_REQUIRE(pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Failed)
+    Int32ArrayType::Pointer values = dca->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, DataArrayPath("A", "AM", "Values"), {1});
+    BoolArrayType::Pointer mask = dca->getPrereqArrayFromPath<BoolArrayType, AbstractFilter>(nullptr, DataArrayPath("A", "AM", "Mask"), {1});
+    DREAM3D_REQUIRE_VALID_POINTER(values.get())
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int32_t value = static_cast<int32_t>(i % 23);
+      float weight = static_cast<float>(i) * 0.5f;
+      bool expectedMask = (value > 5) && !(weight < 1000.0f || value == 20);
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), expectedMask)
+      DREAM3D_REQUIRE_EQUAL(values->getValue(i), expectedMask ? 0 : value)
+    }
+
+    // A disabled filter splits the run, leaving a single filter that is not fused
+    pipeline = createFusionPipeline();
+    pipeline->getFilterContainer()[1]->setEnabled(false);
+    ElementWiseFusion fusion;
+    fusion.analyze(pipeline->getFilterContainer());
+    DREAM3D_REQUIRE_EQUAL(fusion.getGroups().size(), 0)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -164,6 +745,14 @@ public:
 #endif
 
     DREAM3D_REGISTER_TEST(TestPipelinePushPop());
+    DREAM3D_REGISTER_TEST(TestDependencyGraph());
+    DREAM3D_REGISTER_TEST(TestParallelExecution());
+    DREAM3D_REGISTER_TEST(TestIncrementalPreflight());
+    DREAM3D_REGISTER_TEST(TestResultCache());
+    DREAM3D_REGISTER_TEST(TestArrayLiveness());
+    DREAM3D_REGISTER_TEST(TestProfile());
+    DREAM3D_REGISTER_TEST(TestPipelineBatch());
+    DREAM3D_REGISTER_TEST(TestElementWiseFusion());
 
 #if REMOVE_TEST_FILES
 //  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
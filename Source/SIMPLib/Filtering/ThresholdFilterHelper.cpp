@@ -45,6 +45,16 @@ ThresholdFilterHelper::ThresholdFilterHelper(SIMPL::Comparison::Enumeration comp
 {
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdFilterHelper::ThresholdFilterHelper(SIMPL::Comparison::Enumeration compType, double compValue, BitMaskArray* output)
+: comparisonOperator(compType)
+, comparisonValue(compValue)
+, m_MaskOutput(output)
+{
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -76,7 +86,22 @@ int ThresholdFilterHelper::execute(IDataArray* input, IDataArray* output)
   {
     return -1;
   }
-  m_Output->initializeWithZeros();
+  if(nullptr != m_MaskOutput)
+  {
+    if(m_MaskOutput->getNumberOfTuples() < input->getNumberOfTuples())
+    {
+      return -1;
+    }
+    m_MaskOutput->initializeWithZeros();
+  }
+  else if(nullptr != m_Output)
+  {
+    m_Output->initializeWithZeros();
+  }
+  else
+  {
+    return -1;
+  }
   QString dType = input->getTypeAsString();
 
   FILTER_DATA_HELPER(dType, comparisonOperator, float);
@@ -36,6 +36,7 @@
 #pragma once
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/BitMaskArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/IDataArrayFilter.h"
@@ -49,6 +50,12 @@ class SIMPLib_EXPORT ThresholdFilterHelper : public IDataArrayFilter
 public:
   ThresholdFilterHelper(SIMPL::Comparison::Enumeration compType, double compValue, BoolArrayType* output);
 
+  /**
+   * @brief Constructs a helper that writes its results straight into a bit packed mask,
+   * 64 comparisons per word.
+   */
+  ThresholdFilterHelper(SIMPL::Comparison::Enumeration compType, double compValue, BitMaskArray* output);
+
   ~ThresholdFilterHelper() override;
 
   /**
@@ -56,14 +63,7 @@ public:
    */
   template <typename T> void filterDataLessThan(IDataArray* m_Input)
   {
-    size_t m_NumValues = m_Input->getNumberOfTuples();
-    T v = static_cast<T>(comparisonValue);
-    T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      bool b = (data[i] < v);
-      m_Output->setValue(i, b);
-    }
+    filterData<T>(m_Input, [](T a, T b) { return a < b; });
   }
 
   /**
@@ -71,14 +71,7 @@ public:
    */
   template <typename T> void filterDataGreaterThan(IDataArray* m_Input)
   {
-    size_t m_NumValues = m_Input->getNumberOfTuples();
-    T v = static_cast<T>(comparisonValue);
-    T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      bool b = (data[i] > v);
-      m_Output->setValue(i, b);
-    }
+    filterData<T>(m_Input, [](T a, T b) { return a > b; });
   }
 
   /**
@@ -86,14 +79,7 @@ public:
    */
   template <typename T> void filterDataEqualTo(IDataArray* m_Input)
   {
-    size_t m_NumValues = m_Input->getNumberOfTuples();
-    T v = static_cast<T>(comparisonValue);
-    T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      bool b = (data[i] == v);
-      m_Output->setValue(i, b);
-    }
+    filterData<T>(m_Input, [](T a, T b) { return a == b; });
   }
 
   /**
@@ -101,14 +87,7 @@ public:
   */
   template <typename T> void filterDataNotEqualTo(IDataArray* m_Input)
   {
-    size_t m_NumValues = m_Input->getNumberOfTuples();
-    T v = static_cast<T>(comparisonValue);
-    T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      bool b = (data[i] != v);
-      m_Output->setValue(i, b);
-    }
+    filterData<T>(m_Input, [](T a, T b) { return a != b; });
   }
 
   /**
@@ -119,10 +98,46 @@ public:
   */
   int execute(IDataArray* input, IDataArray* output);
 
+protected:
+  /**
+   * @brief Compares each value of the input against the comparison value and stores the
+   * result in whichever output this helper was constructed with.
+   */
+  template <typename T, typename Compare> void filterData(IDataArray* m_Input, Compare compare)
+  {
+    size_t m_NumValues = m_Input->getNumberOfTuples();
+    T v = static_cast<T>(comparisonValue);
+    T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
+    if(nullptr != m_MaskOutput)
+    {
+      // Build each 64 bit word in a register and store it once
+      BitMaskArray::WordType* words = m_MaskOutput->getWordPointer(0);
+      size_t numWords = (m_NumValues + BitMaskArray::k_BitsPerWord - 1) / BitMaskArray::k_BitsPerWord;
+      for(size_t w = 0; w < numWords; ++w)
+      {
+        size_t start = w * BitMaskArray::k_BitsPerWord;
+        size_t count = m_NumValues - start < BitMaskArray::k_BitsPerWord ? m_NumValues - start : BitMaskArray::k_BitsPerWord;
+        BitMaskArray::WordType word = 0;
+        for(size_t b = 0; b < count; ++b)
+        {
+          word |= static_cast<BitMaskArray::WordType>(compare(data[start + b], v)) << b;
+        }
+        words[w] = word;
+      }
+      return;
+    }
+    for(size_t i = 0; i < m_NumValues; ++i)
+    {
+      bool b = compare(data[i], v);
+      m_Output->setValue(i, b);
+    }
+  }
+
 private:
   SIMPL::Comparison::Enumeration comparisonOperator;
   double comparisonValue;
-  BoolArrayType* m_Output;
+  BoolArrayType* m_Output = nullptr;
+  BitMaskArray* m_MaskOutput = nullptr;
 
 public:
   ThresholdFilterHelper(const ThresholdFilterHelper&) = delete; // Copy Constructor Not Implemented
@@ -31,9 +31,12 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
-#include <map>
-#include <set>
+#include <memory>
+#include <vector>
 
 #include <QtCore/QString>
 
@@ -46,6 +49,10 @@
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelDataReduceAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelDataScanAlgorithm.h"
+#include "SIMPLib/Utilities/ThreadScheduler.h"
 
 /**
 * @brief This file contains a namespace with classes for manipulating IGeometry objects
@@ -156,7 +163,11 @@ public:
       {
         return dynamicList = DynamicListArray<T, K>::NullPointer();
       }
-      dynamicList->deserializeLinks(buffer, numElems);
+      if(!dynamicList->deserializeLinks(buffer, numElems))
+      {
+        err = -3;
+        return dynamicList = DynamicListArray<T, K>::NullPointer();
+      }
     }
 
     return dynamicList;
@@ -178,35 +189,13 @@ public:
     {
       return err;
     }
-    int32_t rank = 0;
-    hsize_t dims[2] = {0, 2ULL};
-    size_t total = 0;
-    for(size_t v = 0; v < numElems; ++v)
-    {
-      total += dynamicList->getNumberOfElements(v);
-    }
-
-    size_t totalBytes = numElems * sizeof(T) + total * sizeof(K);
-
-    // Allocate a flat array to copy the data into
-    QVector<uint8_t> buffer(totalBytes, 0);
-    uint8_t* bufPtr = &(buffer.front());
-    size_t offset = 0;
-
-    for(size_t v = 0; v < numElems; ++v)
-    {
-      T nelems = dynamicList->getNumberOfElements(v);
-      K* elems = dynamicList->getElementListPointer(v);
-      ::memcpy(bufPtr + offset, &nelems, sizeof(T));
-      offset += sizeof(T);
-      ::memcpy(bufPtr + offset, elems, nelems * sizeof(K));
-      offset += nelems * sizeof(K);
-    }
-
-    rank = 1;
-    dims[0] = totalBytes;
+    // Flatten all the lists into a single buffer in one pass
+    std::vector<uint8_t> buffer;
+    dynamicList->serializeLinks(buffer, numElems);
 
-    err = QH5Lite::writePointerDataset(parentId, name, rank, dims, bufPtr);
+    int32_t rank = 1;
+    hsize_t dims[1] = {static_cast<hsize_t>(buffer.size())};
+    err = QH5Lite::writePointerDataset(parentId, name, rank, dims, buffer.data());
     return err;
   }
 };
@@ -221,7 +210,14 @@ public:
   virtual ~Connectivity() = default;
 
   /**
-   * @brief FindElementsContainingVert
+   * @brief Element lists with fewer vertex references than this are always linked on one thread
+   */
+  static const size_t k_MinParallelVertexUses = 1 << 16;
+
+  /**
+   * @brief FindElementsContainingVert Lists for every vertex the elements that use it, in
+   * ascending order. Large element lists are linked by FindElementsContainingVertParallel()
+   * when the current ThreadScheduler arena has more than one thread.
    * @param elemList
    * @param dynamicList
    * @param numVerts
@@ -232,6 +228,12 @@ public:
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
 
+    if(numElems * numVertsPerElem >= k_MinParallelVertexUses && ThreadScheduler::Instance()->getMaxConcurrency() > 1)
+    {
+      FindElementsContainingVertParallel<T, K>(elemList, dynamicList, numVerts);
+      return;
+    }
+
     // Allocate the basic structures
     QVector<T> linkCount(numVerts, 0);
     size_t elemId = 0;
@@ -267,23 +269,157 @@ public:
   }
 
   /**
-   * @brief FindElementNeighbors
+   * @brief CountSlots Gives every vertex a slice of one buffer that is large enough for the
+   * items filed under it. The items of the elements are counted in parallel with atomic
+   * counters and a parallel prefix sum of the counts gives the start of every slice.
+   * @param numElems
+   * @param numItemsPerElem
+   * @param numVerts
+   * @param vertOfItem Called as vertOfItem(elemId, item) to get the vertex the item is filed under
+   * @param cursors numVerts counters that are used as scratch space
+   * @param offsets Resized to numVerts + 1. The slice of vertex v is [offsets[v], offsets[v + 1])
+   */
+  template <typename VertFunc>
+  static void CountSlots(size_t numElems, size_t numItemsPerElem, size_t numVerts, VertFunc vertOfItem, std::atomic<size_t>* cursors, std::vector<size_t>& offsets)
+  {
+    ParallelDataAlgorithm vertAlg;
+    vertAlg.setRange(0, numVerts);
+    vertAlg.execute([cursors](const SIMPLRange& range) {
+      for(size_t vertId = range.min(); vertId < range.max(); vertId++)
+      {
+        cursors[vertId].store(0, std::memory_order_relaxed);
+      }
+    });
+
+    ParallelDataAlgorithm elemAlg;
+    elemAlg.setRange(0, numElems);
+    elemAlg.execute([cursors, &vertOfItem, numItemsPerElem](const SIMPLRange& range) {
+      for(size_t elemId = range.min(); elemId < range.max(); elemId++)
+      {
+        for(size_t item = 0; item < numItemsPerElem; item++)
+        {
+          cursors[vertOfItem(elemId, item)].fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    });
+
+    offsets.resize(numVerts + 1);
+    ParallelDataScanAlgorithm scanAlg;
+    scanAlg.setRange(0, numVerts);
+    offsets[numVerts] = scanAlg.exclusiveSum(cursors, offsets.data());
+  }
+
+  /**
+   * @brief FillSlots Writes the items filed under the vertices [vertBegin, vertEnd) into their
+   * slices of buffer, which starts at offsets[vertBegin]. The elements run in parallel and claim
+   * the slots from atomic cursors, so the items of a vertex end up in no particular order.
+   * @param numElems
+   * @param numItemsPerElem
+   * @param vertBegin
+   * @param vertEnd
+   * @param offsets The slices from CountSlots()
+   * @param itemOf Called as itemOf(elemId, item, vertId, value) to get the vertex and the value of the item
+   * @param cursors The counters passed to CountSlots()
+   * @param buffer
+   */
+  template <typename V, typename ItemFunc>
+  static void FillSlots(size_t numElems, size_t numItemsPerElem, size_t vertBegin, size_t vertEnd, const std::vector<size_t>& offsets, ItemFunc itemOf, std::atomic<size_t>* cursors, V* buffer)
+  {
+    size_t base = offsets[vertBegin];
+    ParallelDataAlgorithm vertAlg;
+    vertAlg.setRange(vertBegin, vertEnd);
+    vertAlg.execute([cursors, &offsets, base](const SIMPLRange& range) {
+      for(size_t vertId = range.min(); vertId < range.max(); vertId++)
+      {
+        cursors[vertId].store(offsets[vertId] - base, std::memory_order_relaxed);
+      }
+    });
+
+    ParallelDataAlgorithm elemAlg;
+    elemAlg.setRange(0, numElems);
+    elemAlg.execute([&itemOf, cursors, buffer, numItemsPerElem, vertBegin, vertEnd](const SIMPLRange& range) {
+      // Claiming the slots of a block before writing them keeps the atomic operations from
+      // waiting on the cache misses of the scattered writes
+      const size_t blockSize = 1024;
+      std::vector<std::pair<size_t, V>> slots;
+      slots.reserve(blockSize * numItemsPerElem);
+      size_t vertId = 0;
+      V value;
+      for(size_t blockStart = range.min(); blockStart < range.max(); blockStart += blockSize)
+      {
+        size_t blockEnd = std::min(blockStart + blockSize, range.max());
+        slots.clear();
+        for(size_t elemId = blockStart; elemId < blockEnd; elemId++)
+        {
+          for(size_t item = 0; item < numItemsPerElem; item++)
+          {
+            itemOf(elemId, item, vertId, value);
+            if(vertId >= vertBegin && vertId < vertEnd)
+            {
+              slots.emplace_back(cursors[vertId].fetch_add(1, std::memory_order_relaxed), value);
+            }
+          }
+        }
+        for(const std::pair<size_t, V>& slot : slots)
+        {
+          buffer[slot.first] = slot.second;
+        }
+      }
+    });
+  }
+
+  /**
+   * @brief FindElementsContainingVertParallel Gives the same lists as FindElementsContainingVert()
+   * using all threads of the current ThreadScheduler arena. CountSlots() gives every vertex the
+   * start of its list and FillSlots() writes the elements in parallel. Sorting each list restores
+   * the ascending element order of the serial version.
    * @param elemList
-   * @param elemsContainingVert
-   * @param dynamicList This should be an empty DynamicListArray object. It is not
-   * it <b>WILL</b> be cleared and reallocated.
-   * @return
+   * @param dynamicList
+   * @param numVerts
    */
   template <typename T, typename K>
-  static int FindElementNeighbors(typename DataArray<K>::Pointer elemList, typename DynamicListArray<T, K>::Pointer elemsContainingVert, typename DynamicListArray<T, K>::Pointer dynamicList,
-                                  IGeometry::Type geometryType)
+  static void FindElementsContainingVertParallel(typename DataArray<K>::Pointer elemList, typename DynamicListArray<T, K>::Pointer dynamicList, size_t numVerts)
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
-    size_t numSharedVerts = 0;
-    QVector<T> linkCount(numElems, 0);
-    int err = 0;
+    const K* elems = elemList->getPointer(0);
+
+    std::unique_ptr<std::atomic<size_t>[]> cursors(new std::atomic<size_t>[numVerts]);
+    std::vector<size_t> offsets;
+    CountSlots(numElems, numVertsPerElem, numVerts, [elems, numVertsPerElem](size_t elemId, size_t vert) { return static_cast<size_t>(elems[elemId * numVertsPerElem + vert]); }, cursors.get(),
+               offsets);
+
+    std::vector<K> links(offsets[numVerts]);
+    FillSlots(numElems, numVertsPerElem, 0, numVerts, offsets,
+              [elems, numVertsPerElem](size_t elemId, size_t vert, size_t& vertId, K& link) {
+                vertId = static_cast<size_t>(elems[elemId * numVertsPerElem + vert]);
+                link = static_cast<K>(elemId);
+              },
+              cursors.get(), links.data());
+
+    std::vector<T> linkCount(numVerts);
+    ParallelDataAlgorithm vertAlg;
+    vertAlg.setRange(0, numVerts);
+    vertAlg.execute([&offsets, &links, &linkCount](const SIMPLRange& range) {
+      for(size_t vertId = range.min(); vertId < range.max(); vertId++)
+      {
+        linkCount[vertId] = static_cast<T>(offsets[vertId + 1] - offsets[vertId]);
+        std::sort(links.begin() + offsets[vertId], links.begin() + offsets[vertId + 1]);
+      }
+    });
 
+    dynamicList->setLists(linkCount, links);
+  }
+
+  /**
+   * @brief Returns the number of vertices two elements of the geometry type share when they
+   * are neighbors, 0 if the type has no element neighbors
+   * @param geometryType
+   * @return
+   */
+  static size_t GetNumberOfSharedVerts(IGeometry::Type geometryType)
+  {
+    size_t numSharedVerts = 0;
     switch(geometryType)
     {
     case IGeometry::Type::Edge: // edges
@@ -316,20 +452,47 @@ public:
       break;
     }
 
+    return numSharedVerts;
+  }
+
+  /**
+   * @brief FindElementNeighbors Large element lists are handled by FindElementNeighborsParallel()
+   * when the current ThreadScheduler arena has more than one thread.
+   * @param elemList
+   * @param elemsContainingVert
+   * @param dynamicList This should be an empty DynamicListArray object. It is not
+   * it <b>WILL</b> be cleared and reallocated.
+   * @return
+   */
+  template <typename T, typename K>
+  static int FindElementNeighbors(typename DataArray<K>::Pointer elemList, typename DynamicListArray<T, K>::Pointer elemsContainingVert, typename DynamicListArray<T, K>::Pointer dynamicList,
+                                  IGeometry::Type geometryType)
+  {
+    size_t numElems = elemList->getNumberOfTuples();
+    size_t numVertsPerElem = elemList->getNumberOfComponents();
+    size_t numSharedVerts = GetNumberOfSharedVerts(geometryType);
+    std::vector<T> linkCount(numElems, 0);
+    int err = 0;
+
     if(numSharedVerts == 0)
     {
       return -1;
     }
 
-    dynamicList->allocateLists(linkCount);
+    if(numElems * numVertsPerElem >= k_MinParallelVertexUses && ThreadScheduler::Instance()->getMaxConcurrency() > 1)
+    {
+      return FindElementNeighborsParallel<T, K>(elemList, elemsContainingVert, dynamicList, geometryType);
+    }
 
     // Allocate an array of bools that we use each iteration so that we don't put duplicates into the array
     typename DataArray<bool>::Pointer visitedPtr = DataArray<bool>::CreateArray(numElems, "_INTERNAL_USE_ONLY_Visited", true);
     visitedPtr->initializeWithValue(false);
     bool* visited = visitedPtr->getPointer(0);
 
-    // Reuse this vector for each loop. Avoids re-allocating the memory each time through the loop
-    QVector<K> loop_neighbors(32, 0);
+    // The neighbors of all elements are appended to this single buffer which then becomes the payload
+    // of the DynamicListArray. Manifold meshes have about one neighbor per shared edge/face.
+    std::vector<K> neighbors;
+    neighbors.reserve(numElems * numVertsPerElem);
 
     // Build up the element adjacency list now that we have the element links
     for(size_t t = 0; t < numElems; ++t)
@@ -374,138 +537,320 @@ public:
           if(vCount == numSharedVerts)
           {
             // qDebug() << "       Neighbor: " << vertIdxs[vt] << "\n";
-            // Use the current count of neighbors as the index
-            // into the loop_neighbors vector and place the value of the vertex element at that index
-            loop_neighbors[linkCount[t]] = vertIdxs[vt];
-            linkCount[t]++; // Increment the count for the next time through
-            if(linkCount[t] >= loop_neighbors.size())
-            {
-              loop_neighbors.resize(loop_neighbors.size() + 10);
-            }
+            neighbors.push_back(vertIdxs[vt]);
+            linkCount[t]++;               // Increment the count for the next time through
             visited[vertIdxs[vt]] = true; // Set this element as visited so we do NOT add it again
           }
         }
       }
       // Reset all the visited cell indexs back to false (zero)
-      for(int64_t k = 0; k < linkCount[t]; ++k)
+      for(size_t k = neighbors.size() - static_cast<size_t>(linkCount[t]); k < neighbors.size(); ++k)
       {
-        visited[loop_neighbors[k]] = false;
+        visited[neighbors[k]] = false;
       }
-      // Allocate the array storage for the current edge to hold its vertex list
-      dynamicList->setElementList(t, linkCount[t], &(loop_neighbors[0]));
     }
 
+    // Hand all the lists over to the DynamicListArray at once
+    dynamicList->setLists(linkCount, neighbors);
+
     return err;
   }
 
   /**
-   * @brief Find2DElementEdges
+   * @brief FindElementNeighborsParallel Gives the same lists as FindElementNeighbors() using all
+   * threads of the current ThreadScheduler arena. The elements are cut into the fixed chunks of a
+   * ParallelDataReduceAlgorithm and each chunk collects the neighbors of its elements into a
+   * buffer of its own. An element has few neighbors, so the candidates already taken are found
+   * by searching its own neighbors instead of a visited flag for every element of the mesh. The
+   * chunk buffers are finally copied into one payload in element order.
    * @param elemList
-   * @param edgeList
+   * @param elemsContainingVert
+   * @param dynamicList This should be an empty DynamicListArray object. It is not
+   * it <b>WILL</b> be cleared and reallocated.
+   * @return
    */
-  template <typename T> static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
+  template <typename T, typename K>
+  static int FindElementNeighborsParallel(typename DataArray<K>::Pointer elemList, typename DynamicListArray<T, K>::Pointer elemsContainingVert, typename DynamicListArray<T, K>::Pointer dynamicList,
+                                          IGeometry::Type geometryType)
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
+    size_t numSharedVerts = GetNumberOfSharedVerts(geometryType);
+    if(numSharedVerts == 0)
+    {
+      return -1;
+    }
 
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
+    const K* elems = elemList->getPointer(0);
+    std::vector<T> linkCount(numElems, 0);
 
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = elemList->getTuplePointer(i);
+    ParallelDataReduceAlgorithm chunking;
+    chunking.setRange(0, numElems);
+    size_t numChunks = chunking.getChunkCount();
+    std::vector<std::vector<K>> chunkNeighbors(numChunks);
 
-      for(size_t j = 0; j < numVertsPerElem; j++)
+    ParallelDataAlgorithm chunkAlg;
+    chunkAlg.setRange(0, numChunks);
+    chunkAlg.execute([&](const SIMPLRange& chunks) {
+      for(size_t chunk = chunks.min(); chunk < chunks.max(); chunk++)
       {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
+        SIMPLRange range = chunking.getChunk(chunk);
+        std::vector<K>& neighbors = chunkNeighbors[chunk];
+        neighbors.reserve(range.size() * numVertsPerElem);
+        for(size_t t = range.min(); t < range.max(); t++)
         {
-          if(verts[j] > verts[j + 1])
+          const K* seedElem = elems + t * numVertsPerElem;
+          size_t firstNeighbor = neighbors.size();
+          for(size_t v = 0; v < numVertsPerElem; ++v)
           {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
+            T nEs = elemsContainingVert->getNumberOfElements(seedElem[v]);
+            K* vertIdxs = elemsContainingVert->getElementListPointer(seedElem[v]);
+            for(T vt = 0; vt < nEs; ++vt)
+            {
+              K candidate = vertIdxs[vt];
+              if(candidate == static_cast<K>(t) || std::find(neighbors.begin() + firstNeighbor, neighbors.end(), candidate) != neighbors.end())
+              {
+                continue;
+              }
+              const K* vertCell = elems + static_cast<size_t>(candidate) * numVertsPerElem;
+              size_t vCount = 0;
+              for(size_t i = 0; i < numVertsPerElem; i++)
+              {
+                for(size_t j = 0; j < numVertsPerElem; j++)
+                {
+                  if(seedElem[i] == vertCell[j])
+                  {
+                    vCount++;
+                  }
+                }
+              }
+              if(vCount == numSharedVerts)
+              {
+                neighbors.push_back(candidate);
+              }
+            }
           }
+          linkCount[t] = static_cast<T>(neighbors.size() - firstNeighbor);
         }
-        edge = std::make_pair(v0, v1);
-        edgeSet.insert(edge);
       }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resizeTuples(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
+    });
 
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
+    std::vector<size_t> chunkOffsets(numChunks + 1, 0);
+    for(size_t chunk = 0; chunk < numChunks; chunk++)
     {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
+      chunkOffsets[chunk + 1] = chunkOffsets[chunk] + chunkNeighbors[chunk].size();
     }
+
+    std::vector<K> neighbors(chunkOffsets[numChunks]);
+    chunkAlg.execute([&](const SIMPLRange& chunks) {
+      for(size_t chunk = chunks.min(); chunk < chunks.max(); chunk++)
+      {
+        std::copy(chunkNeighbors[chunk].begin(), chunkNeighbors[chunk].end(), neighbors.begin() + chunkOffsets[chunk]);
+        std::vector<K>().swap(chunkNeighbors[chunk]);
+      }
+    });
+
+    dynamicList->setLists(linkCount, neighbors);
+    return 0;
   }
 
   /**
-   * @brief FindTetEdges
-   * @param tetList
-   * @param edgeList
+   * @brief The most bytes FindUniqueElementParts() sorts at once
    */
-  template <typename T> static void FindTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
+  static const size_t k_MaxPartBufferBytes = static_cast<size_t>(1) << 30;
+
+  /**
+   * @brief Returns the positions of the vertices of the six edges of a tetrahedron
+   * @return
+   */
+  static std::vector<std::array<size_t, 2>> TetEdges()
   {
-    size_t numElems = tetList->getNumberOfTuples();
+    return {{{0, 1}}, {{0, 2}}, {{1, 2}}, {{0, 3}}, {{1, 3}}, {{2, 3}}};
+  }
 
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
+  /**
+   * @brief Returns the positions of the vertices of the twelve edges of a hexahedron
+   * @return
+   */
+  static std::vector<std::array<size_t, 2>> HexEdges()
+  {
+    return {{{0, 1}}, {{1, 2}}, {{2, 3}}, {{3, 0}}, {{0, 4}}, {{1, 5}}, {{2, 6}}, {{3, 7}}, {{4, 5}}, {{5, 6}}, {{6, 7}}, {{7, 4}}};
+  }
 
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
+  /**
+   * @brief Returns the positions of the vertices of the four faces of a tetrahedron
+   * @return
+   */
+  static std::vector<std::array<size_t, 3>> TetFaces()
+  {
+    return {{{0, 1, 2}}, {{1, 2, 3}}, {{0, 2, 3}}, {{0, 1, 3}}};
+  }
 
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
+  /**
+   * @brief Returns the positions of the vertices of the six faces of a hexahedron
+   * @return
+   */
+  static std::vector<std::array<size_t, 4>> HexFaces()
+  {
+    return {{{0, 1, 5, 4}}, {{1, 2, 6, 5}}, {{2, 3, 7, 6}}, {{3, 0, 4, 7}}, {{0, 1, 2, 3}}, {{4, 5, 6, 7}}};
+  }
 
-      for(auto&& uEdge : edgeList)
+  /**
+   * @brief FindUniqueElementParts Writes the distinct edges or faces of the elements to partList.
+   * The vertices of each part are in ascending order and the parts are in lexicographic order,
+   * the order the std::set based versions of the Find*Edges and Find*Faces functions had.
+   *
+   * Every part is filed under its smallest vertex. CountSlots() gives every vertex a slice of one
+   * buffer and FillSlots() writes the other N - 1 vertices of the parts into the slices. Sorting
+   * each slice brings equal parts together and puts them in order. A buffer larger than k_MaxPartBufferBytes is
+   * avoided by handling the vertices in passes, each taking the vertices whose slices fit.
+   * @param elemList
+   * @param parts The positions within an element of the N vertices of each of its parts
+   * @param unsharedOnly Only write the parts that belong to a single element
+   * @param partList Resized to hold the parts
+   */
+  template <typename T, size_t N>
+  static void FindUniqueElementParts(typename DataArray<T>::Pointer elemList, const std::vector<std::array<size_t, N>>& parts, bool unsharedOnly, typename DataArray<T>::Pointer partList)
+  {
+    using PartRest = std::array<T, N - 1>;
+
+    size_t numElems = elemList->getNumberOfTuples();
+    size_t numVertsPerElem = elemList->getNumberOfComponents();
+    const T* elems = elemList->getPointer(0);
+    if(numElems == 0 || parts.empty())
+    {
+      partList->resizeTuples(0);
+      return;
+    }
+
+    ParallelDataReduceAlgorithm maxAlg;
+    maxAlg.setRange(0, numElems * numVertsPerElem);
+    T maxVert = maxAlg.execute(elems[0],
+                               [elems](const SIMPLRange& range, T value) {
+                                 for(size_t i = range.min(); i < range.max(); i++)
+                                 {
+                                   value = std::max(value, elems[i]);
+                                 }
+                                 return value;
+                               },
+                               [](const T& left, const T& right) { return std::max(left, right); });
+    size_t numVerts = static_cast<size_t>(maxVert) + 1;
+
+    auto sortedPart = [elems, numVertsPerElem, &parts](size_t elemId, size_t part) {
+      std::array<T, N> verts;
+      const T* elem = elems + elemId * numVertsPerElem;
+      for(size_t i = 0; i < N; i++)
       {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
+        verts[i] = elem[parts[part][i]];
       }
+      std::sort(verts.begin(), verts.end());
+      return verts;
+    };
+
+    std::unique_ptr<std::atomic<size_t>[]> cursors(new std::atomic<size_t>[numVerts]);
+    std::vector<size_t> offsets;
+    CountSlots(numElems, parts.size(), numVerts, [&sortedPart](size_t elemId, size_t part) { return static_cast<size_t>(sortedPart(elemId, part)[0]); }, cursors.get(), offsets);
+
+    size_t maxPartsPerPass = std::max<size_t>(k_MaxPartBufferBytes / sizeof(PartRest), 1);
+    std::vector<PartRest> buffer;
+    std::vector<size_t> keptCounts;
+    std::vector<size_t> keptOffsets;
+    std::vector<T> uniqueParts;
+    for(size_t passBegin = 0; passBegin < numVerts;)
+    {
+      // Take the vertices whose slices fit in the buffer, and at least one
+      size_t passEnd = static_cast<size_t>(std::upper_bound(offsets.begin() + passBegin + 1, offsets.end(), offsets[passBegin] + maxPartsPerPass) - offsets.begin()) - 1;
+      passEnd = std::max(passEnd, passBegin + 1);
+      size_t base = offsets[passBegin];
+      buffer.resize(offsets[passEnd] - base);
+
+      FillSlots(numElems, parts.size(), passBegin, passEnd, offsets,
+                [&sortedPart](size_t elemId, size_t part, size_t& vertId, PartRest& rest) {
+                  std::array<T, N> verts = sortedPart(elemId, part);
+                  vertId = static_cast<size_t>(verts[0]);
+                  std::copy(verts.begin() + 1, verts.end(), rest.begin());
+                },
+                cursors.get(), buffer.data());
+
+      // Sort every slice and keep one of each part, or only the parts that appear once
+      keptCounts.resize(passEnd - passBegin);
+      ParallelDataAlgorithm passAlg;
+      passAlg.setRange(passBegin, passEnd);
+      passAlg.execute([&](const SIMPLRange& range) {
+        for(size_t vertId = range.min(); vertId < range.max(); vertId++)
+        {
+          PartRest* first = buffer.data() + (offsets[vertId] - base);
+          PartRest* last = buffer.data() + (offsets[vertId + 1] - base);
+          std::sort(first, last);
+          PartRest* kept = first;
+          for(PartRest* current = first; current != last;)
+          {
+            PartRest* next = current + 1;
+            while(next != last && *next == *current)
+            {
+              ++next;
+            }
+            if(!unsharedOnly || next - current == 1)
+            {
+              *kept++ = *current;
+            }
+            current = next;
+          }
+          keptCounts[vertId - passBegin] = static_cast<size_t>(kept - first);
+        }
+      });
+
+      keptOffsets.resize(passEnd - passBegin);
+      ParallelDataScanAlgorithm keptScanAlg;
+      keptScanAlg.setRange(0, passEnd - passBegin);
+      size_t numKept = keptScanAlg.exclusiveSum(keptCounts.data(), keptOffsets.data());
+      size_t firstPart = uniqueParts.size() / N;
+      uniqueParts.resize((firstPart + numKept) * N);
+
+      passAlg.execute([&](const SIMPLRange& range) {
+        for(size_t vertId = range.min(); vertId < range.max(); vertId++)
+        {
+          const PartRest* rest = buffer.data() + (offsets[vertId] - base);
+          T* part = uniqueParts.data() + (firstPart + keptOffsets[vertId - passBegin]) * N;
+          for(size_t k = 0; k < keptCounts[vertId - passBegin]; k++)
+          {
+            part[0] = static_cast<T>(vertId);
+            std::copy(rest[k].begin(), rest[k].end(), part + 1);
+            part += N;
+          }
+        }
+      });
+
+      passBegin = passEnd;
     }
 
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resizeTuples(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
+    partList->resizeTuples(uniqueParts.size() / N);
+    std::copy(uniqueParts.begin(), uniqueParts.end(), partList->getPointer(0));
+  }
 
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
+  /**
+   * @brief Find2DElementEdges
+   * @param elemList
+   * @param edgeList
+   */
+  template <typename T> static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
+  {
+    std::vector<std::array<size_t, 2>> edges(elemList->getNumberOfComponents());
+    for(size_t j = 0; j < edges.size(); j++)
     {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
+      edges[j] = {j, (j + 1) % edges.size()};
     }
+    FindUniqueElementParts<T, 2>(elemList, edges, false, edgeList);
+  }
+
+  /**
+   * @brief FindTetEdges
+   * @param tetList
+   * @param edgeList
+   */
+  template <typename T> static void FindTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
+  {
+    FindUniqueElementParts<T, 2>(tetList, TetEdges(), false, edgeList);
   }
 
   /**
@@ -515,52 +860,7 @@ public:
   */
   template <typename T> static void FindHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edge_List)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 =  {verts[4], verts[5]};
-      std::vector<T> edge9 =  {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5,
-                                            edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edge_List->resizeTuples(edgeSet.size());
-    T* uEdges = edge_List->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    FindUniqueElementParts<T, 2>(hexList, HexEdges(), false, edge_List);
   }
 
   /**
@@ -570,41 +870,7 @@ public:
    */
   template <typename T> static void FindTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::set<std::tuple<T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T>>::iterator setIter;
-    faceList->resizeTuples(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[3 * index] = std::get<0>(*setIter);
-      uFaces[3 * index + 1] = std::get<1>(*setIter);
-      uFaces[3 * index + 2] = std::get<2>(*setIter);
-      ++index;
-    }
+    FindUniqueElementParts<T, 3>(tetList, TetFaces(), false, faceList);
   }
 
   /**
@@ -614,45 +880,7 @@ public:
   */
   template <typename T> static void FindHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::set<std::tuple<T, T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
-
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-      for(auto&& quad : quadList)
-      {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T, T>>::iterator setIter;
-    faceList->resizeTuples(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[4 * index] = std::get<0>(*setIter);
-      uFaces[4 * index + 1] = std::get<1>(*setIter);
-      uFaces[4 * index + 2] = std::get<2>(*setIter);
-      uFaces[4 * index + 3] = std::get<3>(*setIter);
-      ++index;
-    }
+    FindUniqueElementParts<T, 4>(hexList, HexFaces(), false, faceList);
   }
 
   /**
@@ -662,75 +890,12 @@ public:
    */
   template <typename T> static void Find2DUnsharedEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = elemList->getTuplePointer(i);
-
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resizeTuples(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
+    std::vector<std::array<size_t, 2>> edges(elemList->getNumberOfComponents());
+    for(size_t j = 0; j < edges.size(); j++)
     {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
+      edges[j] = {j, (j + 1) % edges.size()};
     }
+    FindUniqueElementParts<T, 2>(elemList, edges, true, edgeList);
   }
 
   /**
@@ -740,55 +905,7 @@ public:
   */
   template <typename T> static void FindUnsharedTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resizeTuples(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    FindUniqueElementParts<T, 2>(tetList, TetEdges(), true, edgeList);
   }
 
   /**
@@ -798,64 +915,7 @@ public:
   */
   template <typename T> static void FindUnsharedHexEdges(typename DataArray<T>::Pointer& hexList, typename DataArray<T>::Pointer& edge_List)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 = {verts[4], verts[5]};
-      std::vector<T> edge9 = {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5, edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edge_List->resizeTuples(edgeMap.size());
-    T* bEdges = edge_List->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    FindUniqueElementParts<T, 2>(hexList, HexEdges(), true, edge_List);
   }
 
   /**
@@ -865,54 +925,7 @@ public:
    */
   template <typename T> static void FindUnsharedTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::map<std::tuple<T, T, T>, T> faceMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceMap[face]++;
-      }
-    }
-
-    typename std::map<std::tuple<T, T, T>, T>::iterator mapIter = faceMap.begin();
-
-    while(mapIter != faceMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        faceMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    faceList->resizeTuples(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
-    {
-      uFaces[3 * index] = std::get<0>((*mapIter).first);
-      uFaces[3 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[3 * index + 2] = std::get<2>((*mapIter).first);
-      ++index;
-    }
+    FindUniqueElementParts<T, 3>(tetList, TetFaces(), true, faceList);
   }
 
   /**
@@ -922,58 +935,7 @@ public:
   */
   template <typename T> static void FindUnsharedHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::map<std::tuple<T, T, T, T>, T> faceMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
-
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-      for(auto&& quad : quadList)
-      {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceMap[face]++;
-      }
-    }
-
-    typename std::map<std::tuple<T, T, T, T>, T>::iterator mapIter = faceMap.begin();
-
-    while(mapIter != faceMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        faceMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    faceList->resizeTuples(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
-    {
-      uFaces[4 * index] = std::get<0>((*mapIter).first);
-      uFaces[4 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[4 * index + 2] = std::get<2>((*mapIter).first);
-      uFaces[4 * index + 3] = std::get<3>((*mapIter).first);
-      ++index;
-    }
+    FindUniqueElementParts<T, 4>(hexList, HexFaces(), true, faceList);
   }
 };
 
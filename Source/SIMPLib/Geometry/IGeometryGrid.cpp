@@ -35,6 +35,10 @@
 
 #include "SIMPLib/Geometry/IGeometryGrid.h"
 
+#include <algorithm>
+
+const size_t IGeometryGrid::k_InvalidCellIndex;
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -44,3 +48,84 @@ IGeometryGrid::IGeometryGrid() = default;
 //
 // -----------------------------------------------------------------------------
 IGeometryGrid::~IGeometryGrid() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t IGeometryGrid::computeCellIndices(const float* coords, size_t numPoints, size_t* indices) const
+{
+  // The single point methods do not change the geometry but are not declared const
+  IGeometryGrid* grid = const_cast<IGeometryGrid*>(this);
+  SizeVec3Type dims = getDimensions();
+  bool empty = dims[0] == 0 || dims[1] == 0 || dims[2] == 0;
+
+  size_t numOutside = 0;
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    bool inside = !empty;
+    size_t cell[3] = {0, 0, 0};
+    for(size_t axis = 0; axis < 3 && inside; axis++)
+    {
+      auto planeCoord = [grid, axis](size_t plane) {
+        size_t idx[3] = {0, 0, 0};
+        idx[axis] = plane;
+        float planeCoords[3] = {0.0f, 0.0f, 0.0f};
+        grid->getPlaneCoords(idx, planeCoords);
+        return planeCoords[axis];
+      };
+      float coord = coords[3 * i + axis];
+      inside = coord >= planeCoord(0) && coord <= planeCoord(dims[axis]);
+
+      // The last plane at or below the coordinate, so the upper face falls in the last cell
+      size_t low = 0;
+      size_t high = dims[axis];
+      while(inside && high - low > 1)
+      {
+        size_t mid = low + (high - low) / 2;
+        if(planeCoord(mid) <= coord)
+        {
+          low = mid;
+        }
+        else
+        {
+          high = mid;
+        }
+      }
+      cell[axis] = low;
+    }
+
+    if(inside)
+    {
+      indices[i] = cell[0] + dims[0] * (cell[1] + dims[1] * cell[2]);
+    }
+    else
+    {
+      indices[i] = k_InvalidCellIndex;
+      numOutside++;
+    }
+  }
+  return numOutside;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometryGrid::getCellCoords(const size_t* indices, size_t numIndices, float* coords) const
+{
+  // The single point methods do not change the geometry but are not declared const
+  IGeometryGrid* grid = const_cast<IGeometryGrid*>(this);
+  SizeVec3Type dims = getDimensions();
+  size_t numCells = dims[0] * dims[1] * dims[2];
+
+  for(size_t i = 0; i < numIndices; i++)
+  {
+    if(indices[i] < numCells)
+    {
+      grid->getCoords(indices[i], coords + 3 * i);
+    }
+    else
+    {
+      std::fill(coords + 3 * i, coords + 3 * i + 3, std::numeric_limits<float>::quiet_NaN());
+    }
+  }
+}
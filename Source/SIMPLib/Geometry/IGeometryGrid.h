@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <limits>
 #include <tuple>
 
 #include "SIMPLib/Common/SIMPLArray.hpp"
@@ -80,6 +81,33 @@ class SIMPLib_EXPORT IGeometryGrid : public IGeometry
     virtual void getCoords(size_t x, size_t y, size_t z, double coords[3]) = 0;
     virtual void getCoords(size_t idx, double coords[3]) = 0;
 
+    /**
+     * @brief The index computeCellIndices() gives to a point outside of the grid
+     */
+    static const size_t k_InvalidCellIndex = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief computeCellIndices Finds the cell that holds each point, in parallel over the points.
+     * A point on the upper face of the grid belongs to the last cell. The default searches the
+     * planes of each axis through getPlaneCoords() one point at a time.
+     * @param coords 3 coordinates per point
+     * @param numPoints
+     * @param indices Set to the index of the cell of each point, or to k_InvalidCellIndex for a point outside of the grid
+     * @return The number of points outside of the grid
+     */
+    virtual size_t computeCellIndices(const float* coords, size_t numPoints, size_t* indices) const;
+
+    /**
+     * @brief getCellCoords Writes the coordinates of the center of each cell, the same values as
+     * getCoords(size_t, float*), in parallel over the cells. An index that is not a cell of the
+     * grid, such as k_InvalidCellIndex, gets NaN coordinates. The default calls getCoords() for
+     * one cell at a time.
+     * @param indices Indices of cells of the grid
+     * @param numIndices
+     * @param coords Set to 3 coordinates per cell
+     */
+    virtual void getCellCoords(const size_t* indices, size_t numIndices, float* coords) const;
+
   public:
     IGeometryGrid(const IGeometryGrid&) = delete;  // Copy Constructor Not Implemented
     IGeometryGrid(IGeometryGrid&&) = delete;       // Move Constructor Not Implemented
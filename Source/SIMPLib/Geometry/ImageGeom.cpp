@@ -45,10 +45,17 @@
 
 #include "SIMPLib/Geometry/ImageGeom.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
 #include "H5Support/H5Lite.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Utilities/ParallelData3DAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelDataReduceAlgorithm.h"
+#include "SIMPLib/Utilities/ThreadScheduler.h"
 
 /**
  * @brief The FindImageDerivativesImpl class implements a threaded algorithm that computes the
@@ -675,6 +682,101 @@ void ImageGeom::getCoords(size_t idx, double coords[3])
   coords[2] = static_cast<double>(plane) * m_Spacing[2] + m_Origin[2] + (0.5 * m_Spacing[2]);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageGeom::computeCellIndices(const float* coords, size_t numPoints, size_t* indices) const
+{
+  float lower[3];
+  float upper[3];
+  float spacing[3];
+  float lastCell[3];
+  size_t dims[3];
+  bool empty = false;
+  for(size_t i = 0; i < 3; i++)
+  {
+    lower[i] = m_Origin[i];
+    upper[i] = m_Origin[i] + m_Dimensions[i] * m_Spacing[i];
+    spacing[i] = m_Spacing[i];
+    dims[i] = m_Dimensions[i];
+    empty = empty || dims[i] == 0;
+    lastCell[i] = empty ? 0.0f : static_cast<float>(dims[i] - 1);
+  }
+  if(empty)
+  {
+    std::fill(indices, indices + numPoints, k_InvalidCellIndex);
+    return numPoints;
+  }
+
+  ParallelDataReduceAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  return dataAlg.execute(static_cast<size_t>(0),
+                         [&](const SIMPLRange& range, const size_t& init) {
+                           // The points go through in blocks whose arithmetic has no branches, so the compiler can vectorize it
+                           const size_t blockSize = 256;
+                           float cells[3][blockSize];
+                           uint8_t outside[blockSize];
+                           size_t numOutside = init;
+                           for(size_t start = range.min(); start < range.max(); start += blockSize)
+                           {
+                             size_t count = std::min(blockSize, range.max() - start);
+                             const float* block = coords + 3 * start;
+                             std::fill(outside, outside + count, static_cast<uint8_t>(0));
+                             for(size_t axis = 0; axis < 3; axis++)
+                             {
+                               float* cell = cells[axis];
+                               for(size_t j = 0; j < count; j++)
+                               {
+                                 float coord = block[3 * j + axis];
+                                 bool inside = (coord >= lower[axis]) & (coord <= upper[axis]);
+                                 float index = std::min((coord - lower[axis]) / spacing[axis], lastCell[axis]);
+                                 cell[j] = inside ? index : 0.0f;
+                                 outside[j] |= static_cast<uint8_t>(!inside);
+                               }
+                             }
+                             for(size_t j = 0; j < count; j++)
+                             {
+                               size_t index = static_cast<size_t>(cells[0][j]) + dims[0] * (static_cast<size_t>(cells[1][j]) + dims[1] * static_cast<size_t>(cells[2][j]));
+                               indices[start + j] = (outside[j] != 0) ? k_InvalidCellIndex : index;
+                               numOutside += outside[j];
+                             }
+                           }
+                           return numOutside;
+                         },
+                         [](const size_t& left, const size_t& right) { return left + right; });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeom::getCellCoords(const size_t* indices, size_t numIndices, float* coords) const
+{
+  size_t dimX = m_Dimensions[0];
+  size_t dimY = m_Dimensions[1];
+  size_t numCells = dimX * dimY * m_Dimensions[2];
+  float origin[3] = {m_Origin[0], m_Origin[1], m_Origin[2]};
+  float spacing[3] = {m_Spacing[0], m_Spacing[1], m_Spacing[2]};
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numIndices);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      size_t idx = indices[i];
+      if(idx >= numCells)
+      {
+        std::fill(coords + 3 * i, coords + 3 * i + 3, std::numeric_limits<float>::quiet_NaN());
+        continue;
+      }
+      size_t cell[3] = {idx % dimX, (idx / dimX) % dimY, idx / (dimX * dimY)};
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        coords[3 * i + axis] = cell[axis] * spacing[axis] + origin[axis] + (0.5f * spacing[axis]);
+      }
+    }
+  });
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -914,7 +1016,7 @@ void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType:
     connect(this, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), observable, SLOT(processDerivativesMessage(const AbstractMessage::Pointer&)));
   }
 
-  size_t grain = dims[2] == 1 ? 1 : dims[2] / tbb::task_scheduler_init::default_num_threads();
+  size_t grain = dims[2] == 1 ? 1 : dims[2] / ThreadScheduler::Instance()->getMaxConcurrency();
 
   if(grain == 0) // This can happen if dims[2] > number of processors
   {
@@ -297,6 +297,9 @@ public:
   void getCoords(size_t x, size_t y, size_t z, double coords[3]) override;
   void getCoords(size_t idx, double coords[3]) override;
 
+  size_t computeCellIndices(const float* coords, size_t numPoints, size_t* indices) const override;
+  void getCellCoords(const size_t* indices, size_t numIndices, float* coords) const override;
+
   // -----------------------------------------------------------------------------
   // Misc. ImageGeometry Methods
   // -----------------------------------------------------------------------------
@@ -45,10 +45,98 @@
 
 #include "SIMPLib/Geometry/RectGridGeom.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 #include "H5Support/H5Lite.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Utilities/ParallelData3DAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelDataReduceAlgorithm.h"
+#include "SIMPLib/Utilities/ThreadScheduler.h"
+
+namespace
+{
+/**
+ * @brief The AxisCells class finds the cell that holds a coordinate along one axis of a RectGridGeom.
+ * Bounds that are evenly spaced let the cell be computed and then checked against its two bounds;
+ * other bounds are searched.
+ */
+class AxisCells
+{
+public:
+  AxisCells(const FloatArrayType::Pointer& bounds, size_t numCells)
+  : m_NumCells(numCells)
+  {
+    if(bounds.get() == nullptr || bounds->getNumberOfTuples() < numCells + 1)
+    {
+      m_NumCells = 0;
+    }
+    if(m_NumCells == 0)
+    {
+      return;
+    }
+    m_Bounds = bounds->getPointer(0);
+
+    float spacing = (m_Bounds[m_NumCells] - m_Bounds[0]) / static_cast<float>(m_NumCells);
+    m_Uniform = spacing > 0.0f;
+    for(size_t i = 1; i <= m_NumCells && m_Uniform; i++)
+    {
+      m_Uniform = std::abs((m_Bounds[i] - m_Bounds[i - 1]) - spacing) <= 1.0e-3f * spacing;
+    }
+    m_InvSpacing = m_Uniform ? 1.0f / spacing : 0.0f;
+  }
+
+  bool isEmpty() const
+  {
+    return m_NumCells == 0;
+  }
+
+  /**
+   * @brief Finds the cell whose bounds hold the coordinate, with the last cell also holding its upper bound
+   * @param coord
+   * @param cell
+   * @return false if the coordinate is outside of the bounds
+   */
+  bool find(float coord, size_t& cell) const
+  {
+    if(!(coord >= m_Bounds[0] && coord <= m_Bounds[m_NumCells]))
+    {
+      return false;
+    }
+    size_t last = m_NumCells - 1;
+    if(m_Uniform)
+    {
+      size_t guess = std::min(static_cast<size_t>((coord - m_Bounds[0]) * m_InvSpacing), last);
+      if(guess > 0 && coord < m_Bounds[guess])
+      {
+        guess--;
+      }
+      else if(guess < last && coord >= m_Bounds[guess + 1])
+      {
+        guess++;
+      }
+      if(coord >= m_Bounds[guess] && (guess == last || coord < m_Bounds[guess + 1]))
+      {
+        cell = guess;
+        return true;
+      }
+    }
+    size_t upper = static_cast<size_t>(std::upper_bound(m_Bounds, m_Bounds + m_NumCells + 1, coord) - m_Bounds);
+    cell = std::min(upper - 1, last);
+    return true;
+  }
+
+private:
+  const float* m_Bounds = nullptr;
+  size_t m_NumCells = 0;
+  bool m_Uniform = false;
+  float m_InvSpacing = 0.0f;
+};
+} // namespace
 
 /**
  * @brief The FindImageDerivativesImpl class implements a threaded algorithm that computes the
@@ -710,6 +798,92 @@ void RectGridGeom::getCoords(size_t idx, double coords[3])
   coords[2] = 0.5 * (static_cast<double>(zBnds[plane]) + zBnds[plane + 1]);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t RectGridGeom::computeCellIndices(const float* coords, size_t numPoints, size_t* indices) const
+{
+  AxisCells xCells(m_xBounds, m_Dimensions[0]);
+  AxisCells yCells(m_yBounds, m_Dimensions[1]);
+  AxisCells zCells(m_zBounds, m_Dimensions[2]);
+  if(xCells.isEmpty() || yCells.isEmpty() || zCells.isEmpty())
+  {
+    std::fill(indices, indices + numPoints, k_InvalidCellIndex);
+    return numPoints;
+  }
+  size_t dimX = m_Dimensions[0];
+  size_t dimY = m_Dimensions[1];
+
+  ParallelDataReduceAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  return dataAlg.execute(static_cast<size_t>(0),
+                         [&](const SIMPLRange& range, const size_t& init) {
+                           size_t numOutside = init;
+                           for(size_t i = range.min(); i < range.max(); i++)
+                           {
+                             const float* point = coords + 3 * i;
+                             size_t cell[3] = {0, 0, 0};
+                             if(xCells.find(point[0], cell[0]) && yCells.find(point[1], cell[1]) && zCells.find(point[2], cell[2]))
+                             {
+                               indices[i] = cell[0] + dimX * (cell[1] + dimY * cell[2]);
+                             }
+                             else
+                             {
+                               indices[i] = k_InvalidCellIndex;
+                               numOutside++;
+                             }
+                           }
+                           return numOutside;
+                         },
+                         [](const size_t& left, const size_t& right) { return left + right; });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RectGridGeom::getCellCoords(const size_t* indices, size_t numIndices, float* coords) const
+{
+  // The centers along each axis, computed as getCoords() does
+  std::vector<float> centers[3];
+  const FloatArrayType::Pointer bounds[3] = {m_xBounds, m_yBounds, m_zBounds};
+  bool hasBounds = true;
+  for(size_t axis = 0; axis < 3; axis++)
+  {
+    if(bounds[axis].get() == nullptr || bounds[axis]->getNumberOfTuples() < m_Dimensions[axis] + 1)
+    {
+      hasBounds = false;
+      break;
+    }
+    const float* bnds = bounds[axis]->getPointer(0);
+    centers[axis].resize(m_Dimensions[axis]);
+    for(size_t i = 0; i < m_Dimensions[axis]; i++)
+    {
+      centers[axis][i] = 0.5f * (bnds[i] + bnds[i + 1]);
+    }
+  }
+  size_t dimX = m_Dimensions[0];
+  size_t dimY = m_Dimensions[1];
+  // Without the bounds of every axis the grid has no cell centers at all
+  size_t numCells = hasBounds ? dimX * dimY * m_Dimensions[2] : 0;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numIndices);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      size_t idx = indices[i];
+      if(idx >= numCells)
+      {
+        std::fill(coords + 3 * i, coords + 3 * i + 3, std::numeric_limits<float>::quiet_NaN());
+        continue;
+      }
+      coords[3 * i] = centers[0][idx % dimX];
+      coords[3 * i + 1] = centers[1][(idx / dimX) % dimY];
+      coords[3 * i + 2] = centers[2][idx / (dimX * dimY)];
+    }
+  });
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -971,7 +1145,7 @@ void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
     connect(this, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), observable, SLOT(processDerivativesMessage(const AbstractMessage::Pointer&)));
   }
 
-  size_t grain = dims[2] == 1 ? 1 : dims[2] / tbb::task_scheduler_init::default_num_threads();
+  size_t grain = dims[2] == 1 ? 1 : dims[2] / ThreadScheduler::Instance()->getMaxConcurrency();
   if(grain == 0)
   {
     grain = 1;
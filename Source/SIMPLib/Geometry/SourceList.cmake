@@ -25,6 +25,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TransformContainer.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/TriangleBVH.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.h
 )
@@ -51,6 +52,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TransformContainer.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/TriangleBVH.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.cpp
 )
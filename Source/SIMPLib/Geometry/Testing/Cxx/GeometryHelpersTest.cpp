@@ -0,0 +1,429 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/Utilities/ThreadScheduler.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GeometryHelpersTest
+{
+public:
+  GeometryHelpersTest() = default;
+  virtual ~GeometryHelpersTest() = default;
+
+  GeometryHelpersTest(const GeometryHelpersTest&) = delete;            // Copy Constructor Not Implemented
+  GeometryHelpersTest(GeometryHelpersTest&&) = delete;                 // Move Constructor Not Implemented
+  GeometryHelpersTest& operator=(const GeometryHelpersTest&) = delete; // Copy Assignment Not Implemented
+  GeometryHelpersTest& operator=(GeometryHelpersTest&&) = delete;      // Move Assignment Not Implemented
+
+  const size_t k_Dimension = 512;
+  const size_t k_CellDimension = 64;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  size_t getNumberOfVertices()
+  {
+    return (k_Dimension + 1) * (k_Dimension + 1);
+  }
+
+  // -----------------------------------------------------------------------------
+  // Two triangles for every square of a k_Dimension by k_Dimension grid, in shuffled order
+  // -----------------------------------------------------------------------------
+  MeshIndexArrayType::Pointer createTriangles()
+  {
+    size_t numTris = 2 * k_Dimension * k_Dimension;
+    std::vector<size_t> order(numTris);
+    for(size_t i = 0; i < numTris; i++)
+    {
+      order[i] = i;
+    }
+    std::mt19937 generator(5489u);
+    std::shuffle(order.begin(), order.end(), generator);
+
+    MeshIndexArrayType::Pointer tris = MeshIndexArrayType::CreateArray(numTris, std::vector<size_t>(1, 3), "Triangles", true);
+    for(size_t i = 0; i < numTris; i++)
+    {
+      size_t square = order[i] / 2;
+      MeshIndexType v0 = (square / k_Dimension) * (k_Dimension + 1) + (square % k_Dimension);
+      MeshIndexType v1 = v0 + 1;
+      MeshIndexType v2 = v0 + k_Dimension + 1;
+      MeshIndexType v3 = v2 + 1;
+      MeshIndexType* tri = tris->getTuplePointer(i);
+      tri[0] = v0;
+      tri[1] = (order[i] % 2 == 0) ? v1 : v3;
+      tri[2] = (order[i] % 2 == 0) ? v3 : v2;
+    }
+    return tris;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The index of a vertex of a k_CellDimension cubed grid of cells
+  // -----------------------------------------------------------------------------
+  MeshIndexType getCellVertex(size_t x, size_t y, size_t z)
+  {
+    return (z * (k_CellDimension + 1) + y) * (k_CellDimension + 1) + x;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The cells of a k_CellDimension cubed grid, in shuffled order
+  // -----------------------------------------------------------------------------
+  std::vector<size_t> getShuffledCells()
+  {
+    size_t numCells = k_CellDimension * k_CellDimension * k_CellDimension;
+    std::vector<size_t> order(numCells);
+    for(size_t i = 0; i < numCells; i++)
+    {
+      order[i] = i;
+    }
+    std::mt19937 generator(5489u);
+    std::shuffle(order.begin(), order.end(), generator);
+    return order;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The eight corners of a cell, in the vertex order of a hexahedron
+  // -----------------------------------------------------------------------------
+  std::array<MeshIndexType, 8> getCellCorners(size_t cell)
+  {
+    size_t x = cell % k_CellDimension;
+    size_t y = (cell / k_CellDimension) % k_CellDimension;
+    size_t z = cell / (k_CellDimension * k_CellDimension);
+    return {{getCellVertex(x, y, z), getCellVertex(x + 1, y, z), getCellVertex(x + 1, y + 1, z), getCellVertex(x, y + 1, z), getCellVertex(x, y, z + 1), getCellVertex(x + 1, y, z + 1),
+             getCellVertex(x + 1, y + 1, z + 1), getCellVertex(x, y + 1, z + 1)}};
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  MeshIndexArrayType::Pointer createHexahedra()
+  {
+    std::vector<size_t> order = getShuffledCells();
+    MeshIndexArrayType::Pointer hexas = MeshIndexArrayType::CreateArray(order.size(), std::vector<size_t>(1, 8), "Hexahedra", true);
+    for(size_t i = 0; i < order.size(); i++)
+    {
+      std::array<MeshIndexType, 8> corners = getCellCorners(order[i]);
+      std::copy(corners.begin(), corners.end(), hexas->getTuplePointer(i));
+    }
+    return hexas;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Six tetrahedra for every cell, all sharing the diagonal from corner 0 to corner 6
+  // -----------------------------------------------------------------------------
+  MeshIndexArrayType::Pointer createTetrahedra()
+  {
+    const size_t paths[6][2] = {{1, 2}, {1, 5}, {3, 2}, {3, 7}, {4, 5}, {4, 7}};
+    std::vector<size_t> order = getShuffledCells();
+    MeshIndexArrayType::Pointer tets = MeshIndexArrayType::CreateArray(6 * order.size(), std::vector<size_t>(1, 4), "Tetrahedra", true);
+    for(size_t i = 0; i < order.size(); i++)
+    {
+      std::array<MeshIndexType, 8> corners = getCellCorners(order[i]);
+      for(size_t j = 0; j < 6; j++)
+      {
+        MeshIndexType* tet = tets->getTuplePointer(6 * i + j);
+        tet[0] = corners[0];
+        tet[1] = corners[paths[j][0]];
+        tet[2] = corners[paths[j][1]];
+        tet[3] = corners[6];
+      }
+    }
+    return tets;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The std::map based search the Find*Edges and Find*Faces functions used to do
+  // -----------------------------------------------------------------------------
+  template <size_t N>
+  std::vector<MeshIndexType> findPartsWithMap(const MeshIndexArrayType::Pointer& elemList, const std::vector<std::array<size_t, N>>& parts, bool unsharedOnly)
+  {
+    std::map<std::array<MeshIndexType, N>, size_t> partMap;
+    for(size_t i = 0; i < elemList->getNumberOfTuples(); i++)
+    {
+      MeshIndexType* verts = elemList->getTuplePointer(i);
+      for(const std::array<size_t, N>& part : parts)
+      {
+        std::array<MeshIndexType, N> key;
+        for(size_t k = 0; k < N; k++)
+        {
+          key[k] = verts[part[k]];
+        }
+        std::sort(key.begin(), key.end());
+        partMap[key]++;
+      }
+    }
+
+    std::vector<MeshIndexType> result;
+    for(const auto& entry : partMap)
+    {
+      if(!unsharedOnly || entry.second == 1)
+      {
+        result.insert(result.end(), entry.first.begin(), entry.first.end());
+      }
+    }
+    return result;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<MeshIndexType> toVector(const MeshIndexArrayType::Pointer& list)
+  {
+    MeshIndexType* start = list->getPointer(0);
+    return std::vector<MeshIndexType>(start, start + list->getSize());
+  }
+
+  // -----------------------------------------------------------------------------
+  // Runs a Find*Edges or Find*Faces function on every thread count and compares it to the std::map search
+  // -----------------------------------------------------------------------------
+  template <size_t N, typename Function>
+  void checkParts(const std::string& name, const MeshIndexArrayType::Pointer& elemList, const std::vector<std::array<size_t, N>>& parts, bool unsharedOnly, size_t expectedCount, Function function)
+  {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<MeshIndexType> expected = findPartsWithMap<N>(elemList, parts, unsharedOnly);
+    auto end = std::chrono::steady_clock::now();
+    DREAM3D_REQUIRE_EQUAL(expected.size(), N * expectedCount)
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "\tstd::map " << name << " of " << elemList->getNumberOfTuples() << " elements: " << elapsed.count() << " microseconds" << std::endl;
+
+    uint32_t maxThreads = ThreadScheduler::Instance()->getMaxConcurrency();
+    for(uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+      MeshIndexArrayType::Pointer partList = MeshIndexArrayType::CreateArray(0, std::vector<size_t>(1, N), "Parts", false);
+      ThreadScheduler::Scope scope(ThreadScheduler::Instance()->createArena(threads));
+      start = std::chrono::steady_clock::now();
+      function(partList);
+      end = std::chrono::steady_clock::now();
+      DREAM3D_REQUIRE(toVector(partList) == expected)
+
+      elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+      std::cout << "\t" << name << " on " << threads << " threads: " << elapsed.count() << " microseconds" << std::endl;
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<uint8_t> serialize(const ElementDynamicList::Pointer& list)
+  {
+    std::vector<uint8_t> buffer;
+    list->serializeLinks(buffer, list->size());
+    return buffer;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindElementsContainingVert()
+  {
+    MeshIndexArrayType::Pointer tris = createTriangles();
+    size_t numVerts = getNumberOfVertices();
+
+    ElementDynamicList::Pointer serial = ElementDynamicList::New();
+    {
+      ThreadScheduler::Scope scope(ThreadScheduler::Instance()->createArena(1));
+      auto start = std::chrono::steady_clock::now();
+      GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, MeshIndexType>(tris, serial, numVerts);
+      auto end = std::chrono::steady_clock::now();
+
+      auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+      std::cout << "\tSerial FindElementsContainingVert of " << tris->getNumberOfTuples() << " triangles: " << elapsed.count() << " microseconds" << std::endl;
+    }
+    DREAM3D_REQUIRE_EQUAL(serial->size(), numVerts)
+    DREAM3D_REQUIRE_EQUAL(serial->getTotalNumberOfElements(), 3 * tris->getNumberOfTuples())
+    // An inner vertex of the grid is used by six triangles
+    DREAM3D_REQUIRE_EQUAL(serial->getNumberOfElements(k_Dimension + 2), 6)
+    std::vector<uint8_t> expected = serialize(serial);
+
+    uint32_t maxThreads = ThreadScheduler::Instance()->getMaxConcurrency();
+    for(uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+      ElementDynamicList::Pointer parallel = ElementDynamicList::New();
+      ThreadScheduler::Scope scope(ThreadScheduler::Instance()->createArena(threads));
+      auto start = std::chrono::steady_clock::now();
+      GeometryHelpers::Connectivity::FindElementsContainingVertParallel<uint16_t, MeshIndexType>(tris, parallel, numVerts);
+      auto end = std::chrono::steady_clock::now();
+      DREAM3D_REQUIRE(serialize(parallel) == expected)
+
+      auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+      std::cout << "\tParallel FindElementsContainingVert on " << threads << " threads: " << elapsed.count() << " microseconds" << std::endl;
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindElementNeighbors()
+  {
+    MeshIndexArrayType::Pointer tris = createTriangles();
+    ElementDynamicList::Pointer containing = ElementDynamicList::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, MeshIndexType>(tris, containing, getNumberOfVertices());
+
+    ElementDynamicList::Pointer serial = ElementDynamicList::New();
+    {
+      ThreadScheduler::Scope scope(ThreadScheduler::Instance()->createArena(1));
+      auto start = std::chrono::steady_clock::now();
+      int err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, MeshIndexType>(tris, containing, serial, IGeometry::Type::Triangle);
+      auto end = std::chrono::steady_clock::now();
+      DREAM3D_REQUIRE_EQUAL(err, 0)
+
+      auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+      std::cout << "\tSerial FindElementNeighbors of " << tris->getNumberOfTuples() << " triangles: " << elapsed.count() << " microseconds" << std::endl;
+    }
+    // Every edge inside the grid joins two triangles
+    size_t numInnerEdges = 3 * k_Dimension * k_Dimension - 2 * k_Dimension;
+    DREAM3D_REQUIRE_EQUAL(serial->getTotalNumberOfElements(), 2 * numInnerEdges)
+    std::vector<uint8_t> expected = serialize(serial);
+
+    uint32_t maxThreads = ThreadScheduler::Instance()->getMaxConcurrency();
+    for(uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+      ElementDynamicList::Pointer parallel = ElementDynamicList::New();
+      ThreadScheduler::Scope scope(ThreadScheduler::Instance()->createArena(threads));
+      auto start = std::chrono::steady_clock::now();
+      int err = GeometryHelpers::Connectivity::FindElementNeighborsParallel<uint16_t, MeshIndexType>(tris, containing, parallel, IGeometry::Type::Triangle);
+      auto end = std::chrono::steady_clock::now();
+      DREAM3D_REQUIRE_EQUAL(err, 0)
+      DREAM3D_REQUIRE(serialize(parallel) == expected)
+
+      auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+      std::cout << "\tParallel FindElementNeighbors on " << threads << " threads: " << elapsed.count() << " microseconds" << std::endl;
+    }
+
+    ElementDynamicList::Pointer none = ElementDynamicList::New();
+    int err = GeometryHelpers::Connectivity::FindElementNeighborsParallel<uint16_t, MeshIndexType>(tris, containing, none, IGeometry::Type::Vertex);
+    DREAM3D_REQUIRE_EQUAL(err, -1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFind2DElementEdges()
+  {
+    MeshIndexArrayType::Pointer tris = createTriangles();
+    std::vector<std::array<size_t, 2>> edges = {{{0, 1}}, {{1, 2}}, {{2, 0}}};
+    size_t numEdges = 3 * k_Dimension * k_Dimension + 2 * k_Dimension;
+    size_t numBoundaryEdges = 4 * k_Dimension;
+
+    checkParts<2>("Find2DElementEdges", tris, edges, false, numEdges, [&tris](MeshIndexArrayType::Pointer edgeList) {
+      GeometryHelpers::Connectivity::Find2DElementEdges<MeshIndexType>(tris, edgeList);
+    });
+    checkParts<2>("Find2DUnsharedEdges", tris, edges, true, numBoundaryEdges, [&tris](MeshIndexArrayType::Pointer edgeList) {
+      GeometryHelpers::Connectivity::Find2DUnsharedEdges<MeshIndexType>(tris, edgeList);
+    });
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindHexEdgesAndFaces()
+  {
+    MeshIndexArrayType::Pointer hexas = createHexahedra();
+    size_t dim = k_CellDimension;
+    size_t numEdges = 3 * dim * (dim + 1) * (dim + 1);
+    size_t numFaces = 3 * dim * dim * (dim + 1);
+
+    checkParts<2>("FindHexEdges", hexas, GeometryHelpers::Connectivity::HexEdges(), false, numEdges, [&hexas](MeshIndexArrayType::Pointer edgeList) {
+      GeometryHelpers::Connectivity::FindHexEdges<MeshIndexType>(hexas, edgeList);
+    });
+    // Only the twelve edges of the whole cube belong to a single hexahedron
+    checkParts<2>("FindUnsharedHexEdges", hexas, GeometryHelpers::Connectivity::HexEdges(), true, 12 * dim, [&hexas](MeshIndexArrayType::Pointer edgeList) {
+      GeometryHelpers::Connectivity::FindUnsharedHexEdges<MeshIndexType>(hexas, edgeList);
+    });
+    checkParts<4>("FindHexFaces", hexas, GeometryHelpers::Connectivity::HexFaces(), false, numFaces, [&hexas](MeshIndexArrayType::Pointer faceList) {
+      GeometryHelpers::Connectivity::FindHexFaces<MeshIndexType>(hexas, faceList);
+    });
+    checkParts<4>("FindUnsharedHexFaces", hexas, GeometryHelpers::Connectivity::HexFaces(), true, 6 * dim * dim, [&hexas](MeshIndexArrayType::Pointer faceList) {
+      GeometryHelpers::Connectivity::FindUnsharedHexFaces<MeshIndexType>(hexas, faceList);
+    });
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindTetEdgesAndFaces()
+  {
+    MeshIndexArrayType::Pointer tets = createTetrahedra();
+    size_t dim = k_CellDimension;
+    // The edges of the grid, one diagonal of every face of the grid and one diagonal of every cell
+    size_t numEdges = 3 * dim * (dim + 1) * (dim + 1) + 3 * dim * dim * (dim + 1) + dim * dim * dim;
+    // Two triangles for every face of the grid and six inside every cell
+    size_t numFaces = 6 * dim * dim * (dim + 1) + 6 * dim * dim * dim;
+    std::vector<MeshIndexType> unsharedEdges = findPartsWithMap<2>(tets, GeometryHelpers::Connectivity::TetEdges(), true);
+
+    checkParts<2>("FindTetEdges", tets, GeometryHelpers::Connectivity::TetEdges(), false, numEdges, [&tets](MeshIndexArrayType::Pointer edgeList) {
+      GeometryHelpers::Connectivity::FindTetEdges<MeshIndexType>(tets, edgeList);
+    });
+    checkParts<2>("FindUnsharedTetEdges", tets, GeometryHelpers::Connectivity::TetEdges(), true, unsharedEdges.size() / 2, [&tets](MeshIndexArrayType::Pointer edgeList) {
+      GeometryHelpers::Connectivity::FindUnsharedTetEdges<MeshIndexType>(tets, edgeList);
+    });
+    checkParts<3>("FindTetFaces", tets, GeometryHelpers::Connectivity::TetFaces(), false, numFaces, [&tets](MeshIndexArrayType::Pointer faceList) {
+      GeometryHelpers::Connectivity::FindTetFaces<MeshIndexType>(tets, faceList);
+    });
+    checkParts<3>("FindUnsharedTetFaces", tets, GeometryHelpers::Connectivity::TetFaces(), true, 12 * dim * dim, [&tets](MeshIndexArrayType::Pointer faceList) {
+      GeometryHelpers::Connectivity::FindUnsharedTetFaces<MeshIndexType>(tets, faceList);
+    });
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### GeometryHelpersTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestFindElementsContainingVert())
+    DREAM3D_REGISTER_TEST(TestFindElementNeighbors())
+    DREAM3D_REGISTER_TEST(TestFind2DElementEdges())
+    DREAM3D_REGISTER_TEST(TestFindHexEdgesAndFaces())
+    DREAM3D_REGISTER_TEST(TestFindTetEdgesAndFaces())
+  }
+};
@@ -1,7 +1,10 @@
 
+#include <cmath>
 #include <cstdlib>
 
 #include <iostream>
+#include <random>
+#include <vector>
 
 #include <QtCore/QFile>
 
@@ -90,6 +93,140 @@ public:
     DREAM3D_REQUIRE(err == ImageGeom::ErrorType::ZOutOfBoundsHigh)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBatchedIndexCalculation()
+  {
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+    SizeVec3Type dims(10, 20, 30);
+    FloatVec3Type res = {0.4f, 2.3f, 5.0f};
+    FloatVec3Type origin = {-1.0f, 6.0f, 10.0f};
+
+    geom->setDimensions(dims);
+    geom->setOrigin(origin);
+    geom->setSpacing(res);
+
+    const size_t invalidIndex = IGeometryGrid::k_InvalidCellIndex;
+
+    // Points spread over and around the geometry, about half of them outside of it
+    size_t numPoints = 100000;
+    std::vector<float> coords(numPoints * 3);
+    std::mt19937_64 generator(5489u);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      for(size_t j = 0; j < 3; j++)
+      {
+        float extent = dims[j] * res[j];
+        std::uniform_real_distribution<float> distribution(origin[j] - 0.15f * extent, origin[j] + 1.15f * extent);
+        coords[3 * i + j] = distribution(generator);
+      }
+    }
+    // The lower and upper corners belong to the first and last cells
+    float upper[3] = {origin[0] + dims[0] * res[0], origin[1] + dims[1] * res[1], origin[2] + dims[2] * res[2]};
+    for(size_t j = 0; j < 3; j++)
+    {
+      coords[j] = origin[j];
+      coords[3 + j] = upper[j];
+    }
+
+    std::vector<size_t> indices(numPoints, 0);
+    size_t numOutside = geom->computeCellIndices(coords.data(), numPoints, indices.data());
+    DREAM3D_REQUIRE_EQUAL(indices[0], 0)
+    DREAM3D_REQUIRE_EQUAL(indices[1], geom->getNumberOfElements() - 1)
+
+    size_t expectedOutside = 0;
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      const float* point = coords.data() + 3 * i;
+      bool inside = true;
+      for(size_t j = 0; j < 3; j++)
+      {
+        inside = inside && point[j] >= origin[j] && point[j] <= upper[j];
+      }
+      if(!inside)
+      {
+        expectedOutside++;
+        DREAM3D_REQUIRE_EQUAL(indices[i], invalidIndex)
+        continue;
+      }
+      DREAM3D_REQUIRE(indices[i] < geom->getNumberOfElements())
+      // Away from the upper faces the batched indices match the single point lookup
+      if(point[0] < upper[0] && point[1] < upper[1] && point[2] < upper[2])
+      {
+        size_t index = 0;
+        float pointCopy[3] = {point[0], point[1], point[2]};
+        ImageGeom::ErrorType err = geom->computeCellIndex(pointCopy, index);
+        DREAM3D_REQUIRE(err == ImageGeom::ErrorType::NoError)
+        DREAM3D_REQUIRE_EQUAL(indices[i], index)
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(numOutside, expectedOutside)
+
+    // The cell centers match getCoords() exactly
+    size_t numCells = geom->getNumberOfElements();
+    std::vector<size_t> cells(numCells);
+    for(size_t i = 0; i < numCells; i++)
+    {
+      cells[i] = i;
+    }
+    std::vector<float> centers(numCells * 3);
+    geom->getCellCoords(cells.data(), numCells, centers.data());
+    for(size_t i = 0; i < numCells; i++)
+    {
+      float center[3] = {0.0f, 0.0f, 0.0f};
+      geom->getCoords(i, center);
+      for(size_t j = 0; j < 3; j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(centers[3 * i + j], center[j])
+      }
+    }
+
+    // The centers map back to their own cells
+    std::vector<size_t> roundTrip(numCells, invalidIndex);
+    numOutside = geom->computeCellIndices(centers.data(), numCells, roundTrip.data());
+    DREAM3D_REQUIRE_EQUAL(numOutside, 0)
+    DREAM3D_REQUIRE(roundTrip == cells)
+
+    // The default IGeometryGrid versions give the same centers and cells
+    std::vector<float> defaultCenters(numCells * 3);
+    geom->IGeometryGrid::getCellCoords(cells.data(), numCells, defaultCenters.data());
+    DREAM3D_REQUIRE(defaultCenters == centers)
+    std::fill(roundTrip.begin(), roundTrip.end(), invalidIndex);
+    numOutside = geom->IGeometryGrid::computeCellIndices(centers.data(), numCells, roundTrip.data());
+    DREAM3D_REQUIRE_EQUAL(numOutside, 0)
+    DREAM3D_REQUIRE(roundTrip == cells)
+
+    // The cells found for the points go straight back into getCellCoords(), the points outside get NaN
+    std::vector<float> pointCenters(numPoints * 3);
+    geom->getCellCoords(indices.data(), numPoints, pointCenters.data());
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      float center[3] = {0.0f, 0.0f, 0.0f};
+      if(indices[i] != invalidIndex)
+      {
+        geom->getCoords(indices[i], center);
+      }
+      for(size_t j = 0; j < 3; j++)
+      {
+        if(indices[i] == invalidIndex)
+        {
+          DREAM3D_REQUIRE(std::isnan(pointCenters[3 * i + j]))
+        }
+        else
+        {
+          DREAM3D_REQUIRE_EQUAL(pointCenters[3 * i + j], center[j])
+        }
+      }
+    }
+
+    // A geometry without cells has every point outside
+    geom->setDimensions(SizeVec3Type(10, 0, 30));
+    numOutside = geom->computeCellIndices(coords.data(), numPoints, indices.data());
+    DREAM3D_REQUIRE_EQUAL(numOutside, numPoints)
+    DREAM3D_REQUIRE_EQUAL(indices[0], invalidIndex)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -100,6 +237,7 @@ public:
 
     // Use this to register a specific function that will run a test
     DREAM3D_REGISTER_TEST(TestIndexCalculation());
+    DREAM3D_REGISTER_TEST(TestBatchedIndexCalculation());
     DREAM3D_REGISTER_TEST(RemoveTestFiles());
   }
 
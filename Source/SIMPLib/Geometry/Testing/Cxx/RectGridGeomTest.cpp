@@ -0,0 +1,286 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Geometry/RectGridGeom.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class RectGridGeomTest
+{
+public:
+  RectGridGeomTest() = default;
+  virtual ~RectGridGeomTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer createBounds(const std::vector<float>& values, const QString& name)
+  {
+    FloatArrayType::Pointer bounds = FloatArrayType::CreateArray(values.size(), name, true);
+    std::copy(values.begin(), values.end(), bounds->getPointer(0));
+    return bounds;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  RectGridGeom::Pointer createGeometry(const std::vector<float>& xBounds, const std::vector<float>& yBounds, const std::vector<float>& zBounds)
+  {
+    RectGridGeom::Pointer geom = RectGridGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(SizeVec3Type(xBounds.size() - 1, yBounds.size() - 1, zBounds.size() - 1));
+    geom->setXBounds(createBounds(xBounds, SIMPL::Geometry::xBoundsList));
+    geom->setYBounds(createBounds(yBounds, SIMPL::Geometry::yBoundsList));
+    geom->setZBounds(createBounds(zBounds, SIMPL::Geometry::zBoundsList));
+    return geom;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  size_t findCell(const std::vector<float>& bounds, float coord)
+  {
+    if(coord < bounds.front() || coord > bounds.back())
+    {
+      return IGeometryGrid::k_InvalidCellIndex;
+    }
+    for(size_t i = 0; i < bounds.size() - 2; i++)
+    {
+      if(coord < bounds[i + 1])
+      {
+        return i;
+      }
+    }
+    return bounds.size() - 2;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void checkGeometry(const std::vector<float> (&bounds)[3])
+  {
+    const size_t invalidIndex = IGeometryGrid::k_InvalidCellIndex;
+    RectGridGeom::Pointer geom = createGeometry(bounds[0], bounds[1], bounds[2]);
+    size_t dims[3] = {bounds[0].size() - 1, bounds[1].size() - 1, bounds[2].size() - 1};
+
+    // Random points around the geometry, then every bound and the midpoints between them
+    std::vector<float> coords;
+    std::mt19937_64 generator(5489u);
+    for(size_t i = 0; i < 50000; i++)
+    {
+      for(size_t j = 0; j < 3; j++)
+      {
+        float extent = bounds[j].back() - bounds[j].front();
+        std::uniform_real_distribution<float> distribution(bounds[j].front() - 0.1f * extent, bounds[j].back() + 0.1f * extent);
+        coords.push_back(distribution(generator));
+      }
+    }
+    size_t maxBounds = std::max(bounds[0].size(), std::max(bounds[1].size(), bounds[2].size()));
+    for(size_t i = 0; i < maxBounds; i++)
+    {
+      for(size_t j = 0; j < 3; j++)
+      {
+        coords.push_back(bounds[j][std::min(i, bounds[j].size() - 1)]);
+      }
+      for(size_t j = 0; j < 3; j++)
+      {
+        size_t k = std::min(i, bounds[j].size() - 2);
+        coords.push_back(0.5f * (bounds[j][k] + bounds[j][k + 1]));
+      }
+    }
+    size_t numPoints = coords.size() / 3;
+
+    std::vector<size_t> indices(numPoints, 0);
+    size_t numOutside = geom->computeCellIndices(coords.data(), numPoints, indices.data());
+
+    size_t expectedOutside = 0;
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      size_t cell[3] = {0, 0, 0};
+      bool inside = true;
+      for(size_t j = 0; j < 3; j++)
+      {
+        cell[j] = findCell(bounds[j], coords[3 * i + j]);
+        inside = inside && cell[j] != invalidIndex;
+      }
+      size_t expected = inside ? cell[0] + dims[0] * (cell[1] + dims[1] * cell[2]) : invalidIndex;
+      expectedOutside += inside ? 0 : 1;
+      DREAM3D_REQUIRE_EQUAL(indices[i], expected)
+    }
+    DREAM3D_REQUIRE_EQUAL(numOutside, expectedOutside)
+
+    // The default IGeometryGrid version finds the same cells
+    std::vector<size_t> defaultIndices(numPoints, 0);
+    DREAM3D_REQUIRE_EQUAL(geom->IGeometryGrid::computeCellIndices(coords.data(), numPoints, defaultIndices.data()), expectedOutside)
+    DREAM3D_REQUIRE(defaultIndices == indices)
+
+    // The found cells go straight back into getCellCoords(), the points outside get NaN
+    std::vector<float> pointCenters(numPoints * 3);
+    std::vector<float> defaultPointCenters(numPoints * 3);
+    geom->getCellCoords(indices.data(), numPoints, pointCenters.data());
+    geom->IGeometryGrid::getCellCoords(indices.data(), numPoints, defaultPointCenters.data());
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      float center[3] = {0.0f, 0.0f, 0.0f};
+      if(indices[i] != invalidIndex)
+      {
+        geom->getCoords(indices[i], center);
+      }
+      for(size_t j = 0; j < 3; j++)
+      {
+        if(indices[i] == invalidIndex)
+        {
+          DREAM3D_REQUIRE(std::isnan(pointCenters[3 * i + j]))
+          DREAM3D_REQUIRE(std::isnan(defaultPointCenters[3 * i + j]))
+        }
+        else
+        {
+          DREAM3D_REQUIRE_EQUAL(pointCenters[3 * i + j], center[j])
+          DREAM3D_REQUIRE_EQUAL(defaultPointCenters[3 * i + j], center[j])
+        }
+      }
+    }
+
+    // The cell centers match getCoords() and map back to their own cells
+    size_t numCells = geom->getNumberOfElements();
+    std::vector<size_t> cells(numCells);
+    for(size_t i = 0; i < numCells; i++)
+    {
+      cells[i] = i;
+    }
+    std::vector<float> centers(numCells * 3);
+    geom->getCellCoords(cells.data(), numCells, centers.data());
+    for(size_t i = 0; i < numCells; i++)
+    {
+      float center[3] = {0.0f, 0.0f, 0.0f};
+      geom->getCoords(i, center);
+      for(size_t j = 0; j < 3; j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(centers[3 * i + j], center[j])
+      }
+    }
+    std::vector<size_t> roundTrip(numCells, invalidIndex);
+    numOutside = geom->computeCellIndices(centers.data(), numCells, roundTrip.data());
+    DREAM3D_REQUIRE_EQUAL(numOutside, 0)
+    DREAM3D_REQUIRE(roundTrip == cells)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestUniformBounds()
+  {
+    std::vector<float> bounds[3];
+    size_t numBounds[3] = {21, 31, 11};
+    float spacing[3] = {0.1f, 0.37f, 2.5f};
+    float origin[3] = {-1.0f, 6.0f, 10.0f};
+    for(size_t j = 0; j < 3; j++)
+    {
+      for(size_t i = 0; i < numBounds[j]; i++)
+      {
+        bounds[j].push_back(origin[j] + i * spacing[j]);
+      }
+    }
+    checkGeometry(bounds);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNonUniformBounds()
+  {
+    std::vector<float> bounds[3];
+    // Cells that grow geometrically, cells of random widths and a single cell
+    for(size_t i = 0; i < 25; i++)
+    {
+      bounds[0].push_back(std::pow(1.2f, static_cast<float>(i)) - 5.0f);
+    }
+    std::mt19937_64 generator(1234u);
+    std::uniform_real_distribution<float> widths(0.01f, 3.0f);
+    bounds[1].push_back(-2.0f);
+    for(size_t i = 0; i < 40; i++)
+    {
+      bounds[1].push_back(bounds[1].back() + widths(generator));
+    }
+    bounds[2] = {0.5f, 1.5f};
+    checkGeometry(bounds);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMissingBounds()
+  {
+    RectGridGeom::Pointer geom = RectGridGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(SizeVec3Type(4, 4, 4));
+    float coords[6] = {0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f};
+    size_t indices[2] = {0, 0};
+    size_t numOutside = geom->computeCellIndices(coords, 2, indices);
+    DREAM3D_REQUIRE_EQUAL(numOutside, 2)
+    DREAM3D_REQUIRE_EQUAL(indices[1], IGeometryGrid::k_InvalidCellIndex)
+
+    // Without bounds no cell has a center
+    size_t cells[2] = {0, 63};
+    geom->getCellCoords(cells, 2, coords);
+    for(float coord : coords)
+    {
+      DREAM3D_REQUIRE(std::isnan(coord))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### RectGridGeomTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestUniformBounds());
+    DREAM3D_REGISTER_TEST(TestNonUniformBounds());
+    DREAM3D_REGISTER_TEST(TestMissingBounds());
+  }
+
+private:
+  RectGridGeomTest(const RectGridGeomTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const RectGridGeomTest&) = delete;   // Move assignment Not Implemented
+};
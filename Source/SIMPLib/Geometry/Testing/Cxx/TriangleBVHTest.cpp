@@ -0,0 +1,359 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Geometry/TriangleBVH.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Math/GeometryMath.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class TriangleBVHTest
+{
+public:
+  TriangleBVHTest() = default;
+  virtual ~TriangleBVHTest() = default;
+
+  TriangleBVHTest(const TriangleBVHTest&) = delete;            // Copy Constructor Not Implemented
+  TriangleBVHTest(TriangleBVHTest&&) = delete;                 // Move Constructor Not Implemented
+  TriangleBVHTest& operator=(const TriangleBVHTest&) = delete; // Copy Assignment Not Implemented
+  TriangleBVHTest& operator=(TriangleBVHTest&&) = delete;      // Move Assignment Not Implemented
+
+  // The largest distance between the unit sphere and its triangulation
+  const float k_Tolerance = 0.005f;
+
+  // -----------------------------------------------------------------------------
+  // An octahedron whose triangles are split in four, levels times over, with every vertex moved onto the unit sphere
+  // -----------------------------------------------------------------------------
+  TriangleGeom::Pointer createSphere(int levels)
+  {
+    std::vector<std::array<double, 3>> verts = {{{1, 0, 0}}, {{-1, 0, 0}}, {{0, 1, 0}}, {{0, -1, 0}}, {{0, 0, 1}}, {{0, 0, -1}}};
+    std::vector<std::array<size_t, 3>> tris = {{{0, 2, 4}}, {{2, 1, 4}}, {{1, 3, 4}}, {{3, 0, 4}}, {{2, 0, 5}}, {{1, 2, 5}}, {{3, 1, 5}}, {{0, 3, 5}}};
+    for(int level = 0; level < levels; level++)
+    {
+      std::map<std::pair<size_t, size_t>, size_t> midpoints;
+      auto midpoint = [&verts, &midpoints](size_t v0, size_t v1) {
+        std::pair<size_t, size_t> edge(std::min(v0, v1), std::max(v0, v1));
+        auto iter = midpoints.find(edge);
+        if(iter != midpoints.end())
+        {
+          return iter->second;
+        }
+        std::array<double, 3> point;
+        double length = 0.0;
+        for(size_t i = 0; i < 3; i++)
+        {
+          point[i] = verts[v0][i] + verts[v1][i];
+          length += point[i] * point[i];
+        }
+        for(size_t i = 0; i < 3; i++)
+        {
+          point[i] /= std::sqrt(length);
+        }
+        verts.push_back(point);
+        midpoints[edge] = verts.size() - 1;
+        return verts.size() - 1;
+      };
+
+      std::vector<std::array<size_t, 3>> split;
+      for(const std::array<size_t, 3>& tri : tris)
+      {
+        size_t m01 = midpoint(tri[0], tri[1]);
+        size_t m12 = midpoint(tri[1], tri[2]);
+        size_t m20 = midpoint(tri[2], tri[0]);
+        split.push_back({{tri[0], m01, m20}});
+        split.push_back({{m01, tri[1], m12}});
+        split.push_back({{m20, m12, tri[2]}});
+        split.push_back({{m01, m12, m20}});
+      }
+      tris.swap(split);
+    }
+
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(verts.size());
+    for(size_t v = 0; v < verts.size(); v++)
+    {
+      for(size_t i = 0; i < 3; i++)
+      {
+        vertices->setComponent(v, i, static_cast<float>(verts[v][i]));
+      }
+    }
+    TriangleGeom::Pointer sphere = TriangleGeom::CreateGeometry(tris.size(), vertices, SIMPL::Geometry::TriangleGeometry);
+    for(size_t t = 0; t < tris.size(); t++)
+    {
+      std::copy(tris[t].begin(), tris[t].end(), sphere->getTriPointer(t));
+    }
+    return sphere;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<float> createPoints(size_t numPoints, float extent)
+  {
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> distribution(-extent, extent);
+    std::vector<float> points(3 * numPoints);
+    for(float& value : points)
+    {
+      value = distribution(generator);
+    }
+    return points;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  float getRadius(const float* point)
+  {
+    return std::sqrt(point[0] * point[0] + point[1] * point[1] + point[2] * point[2]);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPointInPolyhedron()
+  {
+    TriangleGeom::Pointer sphere = createSphere(6);
+    size_t numTris = sphere->getNumberOfTris();
+    TriangleBVH::Pointer bvh = TriangleBVH::New(sphere->getTriangles(), sphere->getVertices());
+    DREAM3D_REQUIRE_EQUAL(bvh->getNumberOfTriangles(), numTris)
+
+    size_t numPoints = 200000;
+    std::vector<float> points = createPoints(numPoints, 1.25f);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<char> codes = bvh->pointsInPolyhedron(points.data(), numPoints);
+    auto end = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "\tTriangleBVH classified " << numPoints << " points against " << numTris << " triangles in " << elapsed.count() << " microseconds" << std::endl;
+
+    // The float tests of GeometryMath can count a crossing twice when a ray passes right by an edge
+    size_t numWrong = 0;
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      float radius = getRadius(points.data() + 3 * i);
+      if(std::abs(radius - 1.0f) > k_Tolerance && codes[i] != (radius < 1.0f ? 'i' : 'o'))
+      {
+        numWrong++;
+      }
+    }
+    DREAM3D_REQUIRE(numWrong * 10000 < numPoints)
+
+    // The same rays give the same answers on any number of threads
+    std::vector<char> again = bvh->pointsInPolyhedron(points.data(), numPoints);
+    DREAM3D_REQUIRE(again == codes)
+
+    // Every face is tested for every point without the hierarchy
+    size_t numBrutePoints = 1000;
+    VertexGeom::Pointer faceBBs = VertexGeom::CreateGeometry(2 * numTris, "FaceBBs");
+    std::vector<int32_t> faceIds(numTris);
+    for(size_t t = 0; t < numTris; t++)
+    {
+      faceIds[t] = static_cast<int32_t>(t);
+      GeometryMath::FindBoundingBoxOfFace(sphere.get(), static_cast<int>(t), faceBBs->getVertexPointer(2 * t), faceBBs->getVertexPointer(2 * t + 1));
+    }
+    Int32Int32DynamicListArray::ElementList faceList;
+    faceList.ncells = static_cast<int32_t>(numTris);
+    faceList.cells = faceIds.data();
+    float ll[3];
+    float ur[3];
+    bvh->getBounds(ll, ur);
+    start = std::chrono::steady_clock::now();
+    for(size_t i = 0; i < numBrutePoints; i++)
+    {
+      GeometryMath::PointInPolyhedron(sphere.get(), faceList, faceBBs.get(), points.data() + 3 * i, ll, ur, 10.0f);
+    }
+    end = std::chrono::steady_clock::now();
+    elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "\tGeometryMath::PointInPolyhedron classified " << numBrutePoints << " points in " << elapsed.count() << " microseconds" << std::endl;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRaysAndNearestTriangles()
+  {
+    TriangleGeom::Pointer sphere = createSphere(5);
+    TriangleBVH::Pointer bvh = TriangleBVH::New(sphere->getTriangles(), sphere->getVertices());
+
+    size_t numPoints = 10000;
+    std::vector<float> points = createPoints(numPoints, 2.0f);
+    std::vector<float> origins(3 * numPoints, 0.0f);
+
+    // Rays from the center meet the sphere once, at about the unit distance
+    std::vector<TriangleBVH::Hit> hits = bvh->intersectRays(origins.data(), points.data(), numPoints);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      DREAM3D_REQUIRE(hits[i].Found)
+      DREAM3D_REQUIRE(std::abs(hits[i].Distance - 1.0f) < k_Tolerance)
+      DREAM3D_REQUIRE(std::abs(getRadius(hits[i].Point) - 1.0f) < k_Tolerance)
+    }
+
+    // Nothing lies within 0.5 of the center, and the ray away from the sphere misses it
+    TriangleBVH::Hit hit = bvh->intersectRay(origins.data(), points.data(), 0.5f);
+    DREAM3D_REQUIRE(!hit.Found)
+    float outside[3] = {2.0f, 0.0f, 0.0f};
+    float away[3] = {1.0f, 0.0f, 0.0f};
+    hit = bvh->intersectRay(outside, away);
+    DREAM3D_REQUIRE(!hit.Found)
+
+    std::vector<TriangleBVH::Hit> nearest = bvh->findNearestTriangles(points.data(), numPoints);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      float distance = std::abs(getRadius(points.data() + 3 * i) - 1.0f);
+      DREAM3D_REQUIRE(nearest[i].Found)
+      DREAM3D_REQUIRE(std::abs(nearest[i].Distance - distance) < k_Tolerance)
+    }
+    hit = bvh->findNearestTriangle(origins.data(), 0.5f);
+    DREAM3D_REQUIRE(!hit.Found)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBoxOverlap()
+  {
+    TriangleGeom::Pointer sphere = createSphere(5);
+    TriangleBVH::Pointer bvh = TriangleBVH::New(sphere->getTriangles(), sphere->getVertices());
+    size_t numTris = sphere->getNumberOfTris();
+
+    size_t numBoxes = 1000;
+    std::vector<float> lowerLefts = createPoints(numBoxes, 1.0f);
+    std::vector<float> upperRights(lowerLefts);
+    for(size_t i = 0; i < upperRights.size(); i++)
+    {
+      upperRights[i] += 0.25f;
+    }
+    std::vector<std::vector<MeshIndexType>> overlaps = bvh->findTrianglesOverlappingBoxes(lowerLefts.data(), upperRights.data(), numBoxes);
+
+    float a[3];
+    float b[3];
+    float c[3];
+    for(size_t i = 0; i < numBoxes; i++)
+    {
+      const float* ll = lowerLefts.data() + 3 * i;
+      const float* ur = upperRights.data() + 3 * i;
+      const std::vector<MeshIndexType>& found = overlaps[i];
+      DREAM3D_REQUIRE(std::is_sorted(found.begin(), found.end()))
+      for(size_t t = 0; t < numTris; t++)
+      {
+        sphere->getVertCoordsAtTri(t, a, b, c);
+        bool isFound = std::binary_search(found.begin(), found.end(), t);
+        // A triangle with a corner in the box overlaps it
+        if(GeometryMath::PointInBox(a, ll, ur) || GeometryMath::PointInBox(b, ll, ur) || GeometryMath::PointInBox(c, ll, ur))
+        {
+          DREAM3D_REQUIRE(isFound)
+        }
+        // A triangle whose bounding box misses the box does not
+        bool boundsMiss = false;
+        for(size_t j = 0; j < 3; j++)
+        {
+          boundsMiss = boundsMiss || std::min({a[j], b[j], c[j]}) > ur[j] || std::max({a[j], b[j], c[j]}) < ll[j];
+        }
+        if(boundsMiss)
+        {
+          DREAM3D_REQUIRE(!isFound)
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSubsetAndCache()
+  {
+    TriangleGeom::Pointer sphere = createSphere(2);
+
+    // The upper half of the sphere is not closed, but each of its triangles is still found
+    std::vector<MeshIndexType> upper;
+    float a[3];
+    float b[3];
+    float c[3];
+    for(size_t t = 0; t < sphere->getNumberOfTris(); t++)
+    {
+      sphere->getVertCoordsAtTri(t, a, b, c);
+      if(a[2] + b[2] + c[2] > 0.0f)
+      {
+        upper.push_back(t);
+      }
+    }
+    TriangleBVH::Pointer half = TriangleBVH::New(sphere->getTriangles(), sphere->getVertices(), upper);
+    DREAM3D_REQUIRE_EQUAL(half->getNumberOfTriangles(), upper.size())
+    float top[3] = {0.0f, 0.0f, 2.0f};
+    TriangleBVH::Hit hit = half->findNearestTriangle(top);
+    DREAM3D_REQUIRE(std::binary_search(upper.begin(), upper.end(), hit.TriangleId))
+
+    TriangleBVH::Pointer empty = TriangleBVH::New(sphere->getTriangles(), sphere->getVertices(), std::vector<MeshIndexType>());
+    float center[3] = {0.0f, 0.0f, 0.0f};
+    DREAM3D_REQUIRE_EQUAL(empty->pointInPolyhedron(center), 'o')
+    DREAM3D_REQUIRE(!empty->findNearestTriangle(center).Found)
+
+    DREAM3D_REQUIRE(sphere->getBoundingVolumeHierarchy().get() == nullptr)
+    DREAM3D_REQUIRE_EQUAL(sphere->findBoundingVolumeHierarchy(), 1)
+    TriangleBVH::Pointer cached = sphere->getBoundingVolumeHierarchy();
+    DREAM3D_REQUIRE(cached.get() != nullptr)
+    DREAM3D_REQUIRE_EQUAL(cached->getNumberOfTriangles(), sphere->getNumberOfTris())
+    DREAM3D_REQUIRE_EQUAL(cached->pointInPolyhedron(center), 'i')
+    sphere->deleteBoundingVolumeHierarchy();
+    DREAM3D_REQUIRE(sphere->getBoundingVolumeHierarchy().get() == nullptr)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### TriangleBVHTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestPointInPolyhedron())
+    DREAM3D_REGISTER_TEST(TestRaysAndNearestTriangles())
+    DREAM3D_REGISTER_TEST(TestBoxOverlap())
+    DREAM3D_REGISTER_TEST(TestSubsetAndCache())
+  }
+};
@@ -0,0 +1,831 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "TriangleBVH.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "SIMPLib/Math/GeometryMath.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+// A tree split at the median is at most 64 levels deep, and a traversal keeps at most one node per level
+const size_t k_StackSize = 128;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t SplitMix64(uint64_t& state)
+{
+  state += 0x9E3779B97F4A7C15ULL;
+  uint64_t z = state;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// -----------------------------------------------------------------------------
+// Like GeometryMath::GenerateRandomRay, but the ray depends only on the seed and attempt
+// -----------------------------------------------------------------------------
+void GenerateRay(uint64_t seed, size_t attempt, float length, float ray[3])
+{
+  uint64_t state = seed;
+  state = SplitMix64(state) + attempt;
+  double u0 = static_cast<double>(SplitMix64(state) >> 11) / 9007199254740992.0;
+  double u1 = static_cast<double>(SplitMix64(state) >> 11) / 9007199254740992.0;
+
+  double z = 2.0 * u0 - 1.0;
+  double t = SIMPLib::Constants::k_2Pi * u1;
+  double w = std::sqrt(1.0 - z * z);
+  ray[0] = static_cast<float>(w * std::cos(t) * length);
+  ray[1] = static_cast<float>(w * std::sin(t) * length);
+  ray[2] = static_cast<float>(z * length);
+}
+
+// -----------------------------------------------------------------------------
+// Slab test of the ray origin + t * direction for t in [0, maxT]
+// -----------------------------------------------------------------------------
+bool RayHitsBox(const float lowerLeft[3], const float upperRight[3], const float origin[3], const float direction[3], const float invDirection[3], float maxT)
+{
+  float tMin = 0.0f;
+  float tMax = maxT;
+  for(size_t i = 0; i < 3; i++)
+  {
+    if(direction[i] == 0.0f)
+    {
+      if(origin[i] < lowerLeft[i] || origin[i] > upperRight[i])
+      {
+        return false;
+      }
+      continue;
+    }
+    float t0 = (lowerLeft[i] - origin[i]) * invDirection[i];
+    float t1 = (upperRight[i] - origin[i]) * invDirection[i];
+    if(t0 > t1)
+    {
+      std::swap(t0, t1);
+    }
+    tMin = std::max(tMin, t0);
+    tMax = std::min(tMax, t1);
+    if(tMin > tMax)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double SquaredDistanceToBox(const float lowerLeft[3], const float upperRight[3], const float point[3])
+{
+  double distance = 0.0;
+  for(size_t i = 0; i < 3; i++)
+  {
+    double outside = std::max({static_cast<double>(lowerLeft[i]) - point[i], 0.0, static_cast<double>(point[i]) - upperRight[i]});
+    distance += outside * outside;
+  }
+  return distance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BoxesOverlap(const float lowerLeft0[3], const float upperRight0[3], const float lowerLeft1[3], const float upperRight1[3])
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    if(lowerLeft0[i] > upperRight1[i] || lowerLeft1[i] > upperRight0[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Cross(const double a[3], const double b[3], double c[3])
+{
+  c[0] = a[1] * b[2] - a[2] * b[1];
+  c[1] = a[2] * b[0] - a[0] * b[2];
+  c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double Dot(const double a[3], const double b[3])
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+// -----------------------------------------------------------------------------
+// Moller-Trumbore test of the ray origin + t * direction against a triangle, edges included
+// -----------------------------------------------------------------------------
+bool RayHitsTriangle(const float* tri, const double origin[3], const double direction[3], double& t)
+{
+  double e1[3] = {tri[3] - tri[0], tri[4] - tri[1], tri[5] - tri[2]};
+  double e2[3] = {tri[6] - tri[0], tri[7] - tri[1], tri[8] - tri[2]};
+  double p[3];
+  Cross(direction, e2, p);
+  double det = Dot(e1, p);
+  if(det == 0.0)
+  {
+    return false;
+  }
+  double invDet = 1.0 / det;
+  double s[3] = {origin[0] - tri[0], origin[1] - tri[1], origin[2] - tri[2]};
+  double u = Dot(s, p) * invDet;
+  if(u < 0.0 || u > 1.0)
+  {
+    return false;
+  }
+  double q[3];
+  Cross(s, e1, q);
+  double v = Dot(direction, q) * invDet;
+  if(v < 0.0 || u + v > 1.0)
+  {
+    return false;
+  }
+  t = Dot(e2, q) * invDet;
+  return t >= 0.0;
+}
+
+// -----------------------------------------------------------------------------
+// The closest point of a triangle to p, from Ericson, Real-Time Collision Detection, 5.1.5
+// -----------------------------------------------------------------------------
+void ClosestPointOnTriangle(const float* tri, const double p[3], double closest[3])
+{
+  const double a[3] = {tri[0], tri[1], tri[2]};
+  const double b[3] = {tri[3], tri[4], tri[5]};
+  const double c[3] = {tri[6], tri[7], tri[8]};
+  const double ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+  const double ac[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+  auto combine = [&closest, &a, &ab, &ac](double v, double w) {
+    for(size_t i = 0; i < 3; i++)
+    {
+      closest[i] = a[i] + ab[i] * v + ac[i] * w;
+    }
+  };
+
+  const double ap[3] = {p[0] - a[0], p[1] - a[1], p[2] - a[2]};
+  double d1 = Dot(ab, ap);
+  double d2 = Dot(ac, ap);
+  if(d1 <= 0.0 && d2 <= 0.0)
+  {
+    combine(0.0, 0.0);
+    return;
+  }
+
+  const double bp[3] = {p[0] - b[0], p[1] - b[1], p[2] - b[2]};
+  double d3 = Dot(ab, bp);
+  double d4 = Dot(ac, bp);
+  if(d3 >= 0.0 && d4 <= d3)
+  {
+    combine(1.0, 0.0);
+    return;
+  }
+
+  double vc = d1 * d4 - d3 * d2;
+  if(vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+  {
+    combine(d1 / (d1 - d3), 0.0);
+    return;
+  }
+
+  const double cp[3] = {p[0] - c[0], p[1] - c[1], p[2] - c[2]};
+  double d5 = Dot(ab, cp);
+  double d6 = Dot(ac, cp);
+  if(d6 >= 0.0 && d5 <= d6)
+  {
+    combine(0.0, 1.0);
+    return;
+  }
+
+  double vb = d5 * d2 - d1 * d6;
+  if(vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+  {
+    combine(0.0, d2 / (d2 - d6));
+    return;
+  }
+
+  double va = d3 * d6 - d5 * d4;
+  if(va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+  {
+    double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    combine(1.0 - w, w);
+    return;
+  }
+
+  double denom = 1.0 / (va + vb + vc);
+  combine(vb * denom, vc * denom);
+}
+
+// -----------------------------------------------------------------------------
+// Separating axis test of a triangle against a box, after Akenine-Moller
+// -----------------------------------------------------------------------------
+bool TriangleOverlapsBox(const float* tri, const float lowerLeft[3], const float upperRight[3])
+{
+  double half[3];
+  double verts[3][3];
+  for(size_t i = 0; i < 3; i++)
+  {
+    double center = 0.5 * (static_cast<double>(lowerLeft[i]) + upperRight[i]);
+    half[i] = 0.5 * (static_cast<double>(upperRight[i]) - lowerLeft[i]);
+    for(size_t v = 0; v < 3; v++)
+    {
+      verts[v][i] = tri[3 * v + i] - center;
+    }
+  }
+
+  auto separates = [&half, &verts](const double axis[3]) {
+    double p0 = Dot(verts[0], axis);
+    double p1 = Dot(verts[1], axis);
+    double p2 = Dot(verts[2], axis);
+    double radius = half[0] * std::abs(axis[0]) + half[1] * std::abs(axis[1]) + half[2] * std::abs(axis[2]);
+    return std::min({p0, p1, p2}) > radius || std::max({p0, p1, p2}) < -radius;
+  };
+
+  for(size_t i = 0; i < 3; i++)
+  {
+    double axis[3] = {0.0, 0.0, 0.0};
+    axis[i] = 1.0;
+    if(separates(axis))
+    {
+      return false;
+    }
+  }
+
+  double edges[3][3];
+  for(size_t e = 0; e < 3; e++)
+  {
+    for(size_t i = 0; i < 3; i++)
+    {
+      edges[e][i] = verts[(e + 1) % 3][i] - verts[e][i];
+    }
+  }
+
+  double normal[3];
+  Cross(edges[0], edges[1], normal);
+  if(separates(normal))
+  {
+    return false;
+  }
+
+  for(const double* edge : edges)
+  {
+    double axes[3][3] = {{0.0, -edge[2], edge[1]}, {edge[2], 0.0, -edge[0]}, {-edge[1], edge[0], 0.0}};
+    for(const double* axis : axes)
+    {
+      if(separates(axis))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::TriangleBVH(const SharedTriList::Pointer& triangles, const SharedVertexList::Pointer& vertices, const std::vector<MeshIndexType>& triIds)
+{
+  size_t numTris = triIds.size();
+  if(numTris == 0)
+  {
+    return;
+  }
+  const MeshIndexType* triList = triangles->getPointer(0);
+  const float* vertList = vertices->getPointer(0);
+
+  std::vector<float> triBounds(6 * numTris);
+  std::vector<float> centroids(3 * numTris);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTris);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      const MeshIndexType* tri = triList + 3 * triIds[i];
+      for(size_t j = 0; j < 3; j++)
+      {
+        float c0 = vertList[3 * tri[0] + j];
+        float c1 = vertList[3 * tri[1] + j];
+        float c2 = vertList[3 * tri[2] + j];
+        triBounds[6 * i + j] = std::min({c0, c1, c2});
+        triBounds[6 * i + 3 + j] = std::max({c0, c1, c2});
+        centroids[3 * i + j] = (c0 + c1 + c2) / 3.0f;
+      }
+    }
+  });
+
+  // Pad the boxes so the rounding of the box tests never loses a triangle that a ray only grazes
+  float maxCoord = 0.0f;
+  for(float value : triBounds)
+  {
+    maxCoord = std::max(maxCoord, std::abs(value));
+  }
+  m_Padding = 16.0f * std::numeric_limits<float>::epsilon() * std::max(maxCoord, 1.0f);
+
+  std::vector<size_t> order(numTris);
+  for(size_t i = 0; i < numTris; i++)
+  {
+    order[i] = i;
+  }
+  m_Nodes.reserve(2 * (numTris / k_MaxLeafSize) + 1);
+  buildNode(0, numTris, order, triBounds, centroids);
+
+  // Store the triangles in leaf order so each leaf reads one contiguous block
+  m_TriIds.resize(numTris);
+  m_Coords.resize(9 * numTris);
+  dataAlg.execute([&](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_TriIds[i] = triIds[order[i]];
+      const MeshIndexType* tri = triList + 3 * m_TriIds[i];
+      for(size_t v = 0; v < 3; v++)
+      {
+        std::copy(vertList + 3 * tri[v], vertList + 3 * tri[v] + 3, m_Coords.begin() + 9 * i + 3 * v);
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::~TriangleBVH() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::New(const SharedTriList::Pointer& triangles, const SharedVertexList::Pointer& vertices)
+{
+  std::vector<MeshIndexType> triIds(triangles->getNumberOfTuples());
+  for(size_t i = 0; i < triIds.size(); i++)
+  {
+    triIds[i] = i;
+  }
+  return New(triangles, vertices, triIds);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::New(const SharedTriList::Pointer& triangles, const SharedVertexList::Pointer& vertices, const std::vector<MeshIndexType>& triIds)
+{
+  return Pointer(new TriangleBVH(triangles, vertices, triIds));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TriangleBVH::buildNode(size_t begin, size_t end, std::vector<size_t>& order, const std::vector<float>& triBounds, const std::vector<float>& centroids)
+{
+  size_t nodeIndex = m_Nodes.size();
+  m_Nodes.push_back(Node());
+
+  Node node;
+  float centroidMin[3];
+  float centroidMax[3];
+  for(size_t j = 0; j < 3; j++)
+  {
+    node.LowerLeft[j] = std::numeric_limits<float>::max();
+    node.UpperRight[j] = std::numeric_limits<float>::lowest();
+    centroidMin[j] = std::numeric_limits<float>::max();
+    centroidMax[j] = std::numeric_limits<float>::lowest();
+  }
+  for(size_t i = begin; i < end; i++)
+  {
+    size_t tri = order[i];
+    for(size_t j = 0; j < 3; j++)
+    {
+      node.LowerLeft[j] = std::min(node.LowerLeft[j], triBounds[6 * tri + j]);
+      node.UpperRight[j] = std::max(node.UpperRight[j], triBounds[6 * tri + 3 + j]);
+      centroidMin[j] = std::min(centroidMin[j], centroids[3 * tri + j]);
+      centroidMax[j] = std::max(centroidMax[j], centroids[3 * tri + j]);
+    }
+  }
+  for(size_t j = 0; j < 3; j++)
+  {
+    node.LowerLeft[j] -= m_Padding;
+    node.UpperRight[j] += m_Padding;
+  }
+
+  size_t axis = 0;
+  for(size_t j = 1; j < 3; j++)
+  {
+    if(centroidMax[j] - centroidMin[j] > centroidMax[axis] - centroidMin[axis])
+    {
+      axis = j;
+    }
+  }
+
+  // Triangles that all share one centroid cannot be told apart and stay in one leaf
+  size_t count = end - begin;
+  if(count <= k_MaxLeafSize || centroidMax[axis] == centroidMin[axis])
+  {
+    node.Start = begin;
+    node.Count = count;
+    m_Nodes[nodeIndex] = node;
+    return nodeIndex;
+  }
+
+  size_t mid = begin + count / 2;
+  std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end,
+                   [&centroids, axis](size_t left, size_t right) { return centroids[3 * left + axis] < centroids[3 * right + axis]; });
+
+  buildNode(begin, mid, order, triBounds, centroids);
+  node.Start = buildNode(mid, end, order, triBounds, centroids);
+  node.Count = 0;
+  m_Nodes[nodeIndex] = node;
+  return nodeIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TriangleBVH::getNumberOfTriangles() const
+{
+  return m_TriIds.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TriangleBVH::getNumberOfNodes() const
+{
+  return m_Nodes.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::getBounds(float lowerLeft[3], float upperRight[3]) const
+{
+  for(size_t j = 0; j < 3; j++)
+  {
+    lowerLeft[j] = m_Nodes.empty() ? 0.0f : m_Nodes[0].LowerLeft[j] + m_Padding;
+    upperRight[j] = m_Nodes.empty() ? 0.0f : m_Nodes[0].UpperRight[j] - m_Padding;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char TriangleBVH::countCrossings(const float q[3], const float r[3], size_t& crossings) const
+{
+  float direction[3] = {r[0] - q[0], r[1] - q[1], r[2] - q[2]};
+  float invDirection[3] = {1.0f / direction[0], 1.0f / direction[1], 1.0f / direction[2]};
+  float p[3] = {0.0f, 0.0f, 0.0f};
+
+  crossings = 0;
+  size_t stack[k_StackSize];
+  size_t stackSize = 0;
+  stack[stackSize++] = 0;
+  while(stackSize > 0)
+  {
+    const Node& node = m_Nodes[stack[--stackSize]];
+    if(!RayHitsBox(node.LowerLeft, node.UpperRight, q, direction, invDirection, 1.0f))
+    {
+      continue;
+    }
+    if(node.Count == 0)
+    {
+      stack[stackSize++] = node.Start;
+      stack[stackSize++] = static_cast<size_t>(&node - m_Nodes.data()) + 1;
+      continue;
+    }
+    for(size_t i = node.Start; i < node.Start + node.Count; i++)
+    {
+      const float* tri = m_Coords.data() + 9 * i;
+      char code = GeometryMath::RayIntersectsTriangle(tri, tri + 3, tri + 6, q, r, p);
+      if(code == 'p' || code == 'v' || code == 'e' || code == '?')
+      {
+        return '?';
+      }
+      if(code == 'V' || code == 'E' || code == 'F')
+      {
+        return code;
+      }
+      if(code == 'f')
+      {
+        crossings++;
+      }
+    }
+  }
+  return '0';
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char TriangleBVH::pointInPolyhedron(const float q[3], uint64_t seed) const
+{
+  float lowerLeft[3];
+  float upperRight[3];
+  getBounds(lowerLeft, upperRight);
+  if(m_Nodes.empty() || !GeometryMath::PointInBox(q, lowerLeft, upperRight))
+  {
+    return 'o';
+  }
+
+  // Twice the diagonal of the bounds always reaches outside them
+  float radius = 0.0f;
+  for(size_t j = 0; j < 3; j++)
+  {
+    radius += (upperRight[j] - lowerLeft[j]) * (upperRight[j] - lowerLeft[j]);
+  }
+  radius = 2.0f * std::max(std::sqrt(radius), 1.0f);
+
+  float ray[3];
+  float r[3];
+  for(size_t attempt = 0; attempt < k_MaxRayAttempts; attempt++)
+  {
+    GenerateRay(seed, attempt, radius, ray);
+    r[0] = q[0] + ray[0];
+    r[1] = q[1] + ray[1];
+    r[2] = q[2] + ray[2];
+
+    size_t crossings = 0;
+    char code = countCrossings(q, r, crossings);
+    if(code == '0')
+    {
+      return (crossings % 2 == 1) ? 'i' : 'o';
+    }
+    if(code != '?')
+    {
+      return code;
+    }
+  }
+  return '?';
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<char> TriangleBVH::pointsInPolyhedron(const float* points, size_t numPoints) const
+{
+  std::vector<char> codes(numPoints);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute([this, points, &codes](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      codes[i] = pointInPolyhedron(points + 3 * i, i);
+    }
+  });
+  return codes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Hit TriangleBVH::intersectRay(const float origin[3], const float direction[3], float maxDistance) const
+{
+  Hit hit;
+  double length = std::sqrt(static_cast<double>(direction[0]) * direction[0] + static_cast<double>(direction[1]) * direction[1] + static_cast<double>(direction[2]) * direction[2]);
+  if(m_Nodes.empty() || length == 0.0)
+  {
+    return hit;
+  }
+
+  double rayOrigin[3] = {origin[0], origin[1], origin[2]};
+  double rayDirection[3] = {direction[0] / length, direction[1] / length, direction[2] / length};
+  float unitDirection[3] = {static_cast<float>(rayDirection[0]), static_cast<float>(rayDirection[1]), static_cast<float>(rayDirection[2])};
+  float invDirection[3] = {1.0f / unitDirection[0], 1.0f / unitDirection[1], 1.0f / unitDirection[2]};
+
+  double best = maxDistance;
+  size_t bestTri = 0;
+  size_t stack[k_StackSize];
+  size_t stackSize = 0;
+  stack[stackSize++] = 0;
+  while(stackSize > 0)
+  {
+    const Node& node = m_Nodes[stack[--stackSize]];
+    if(!RayHitsBox(node.LowerLeft, node.UpperRight, origin, unitDirection, invDirection, static_cast<float>(best)))
+    {
+      continue;
+    }
+    if(node.Count == 0)
+    {
+      stack[stackSize++] = node.Start;
+      stack[stackSize++] = static_cast<size_t>(&node - m_Nodes.data()) + 1;
+      continue;
+    }
+    for(size_t i = node.Start; i < node.Start + node.Count; i++)
+    {
+      double t = 0.0;
+      if(RayHitsTriangle(m_Coords.data() + 9 * i, rayOrigin, rayDirection, t) && t <= best)
+      {
+        best = t;
+        bestTri = i;
+        hit.Found = true;
+      }
+    }
+  }
+
+  if(hit.Found)
+  {
+    hit.TriangleId = m_TriIds[bestTri];
+    hit.Distance = static_cast<float>(best);
+    for(size_t j = 0; j < 3; j++)
+    {
+      hit.Point[j] = static_cast<float>(rayOrigin[j] + best * rayDirection[j]);
+    }
+  }
+  return hit;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<TriangleBVH::Hit> TriangleBVH::intersectRays(const float* origins, const float* directions, size_t numRays, float maxDistance) const
+{
+  std::vector<Hit> hits(numRays);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numRays);
+  dataAlg.execute([this, origins, directions, maxDistance, &hits](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      hits[i] = intersectRay(origins + 3 * i, directions + 3 * i, maxDistance);
+    }
+  });
+  return hits;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Hit TriangleBVH::findNearestTriangle(const float point[3], float maxDistance) const
+{
+  Hit hit;
+  if(m_Nodes.empty())
+  {
+    return hit;
+  }
+
+  double p[3] = {point[0], point[1], point[2]};
+  double best = static_cast<double>(maxDistance) * maxDistance;
+  double bestPoint[3] = {0.0, 0.0, 0.0};
+  size_t bestTri = 0;
+  size_t stack[k_StackSize];
+  size_t stackSize = 0;
+  stack[stackSize++] = 0;
+  while(stackSize > 0)
+  {
+    const Node& node = m_Nodes[stack[--stackSize]];
+    if(SquaredDistanceToBox(node.LowerLeft, node.UpperRight, point) > best)
+    {
+      continue;
+    }
+    if(node.Count == 0)
+    {
+      // Visit the nearer child first so the farther one is more likely to be pruned
+      size_t left = static_cast<size_t>(&node - m_Nodes.data()) + 1;
+      size_t right = node.Start;
+      if(SquaredDistanceToBox(m_Nodes[left].LowerLeft, m_Nodes[left].UpperRight, point) < SquaredDistanceToBox(m_Nodes[right].LowerLeft, m_Nodes[right].UpperRight, point))
+      {
+        std::swap(left, right);
+      }
+      stack[stackSize++] = left;
+      stack[stackSize++] = right;
+      continue;
+    }
+    for(size_t i = node.Start; i < node.Start + node.Count; i++)
+    {
+      double closest[3];
+      ClosestPointOnTriangle(m_Coords.data() + 9 * i, p, closest);
+      double distance = (closest[0] - p[0]) * (closest[0] - p[0]) + (closest[1] - p[1]) * (closest[1] - p[1]) + (closest[2] - p[2]) * (closest[2] - p[2]);
+      if(distance <= best)
+      {
+        best = distance;
+        bestTri = i;
+        std::copy(closest, closest + 3, bestPoint);
+        hit.Found = true;
+      }
+    }
+  }
+
+  if(hit.Found)
+  {
+    hit.TriangleId = m_TriIds[bestTri];
+    hit.Distance = static_cast<float>(std::sqrt(best));
+    for(size_t j = 0; j < 3; j++)
+    {
+      hit.Point[j] = static_cast<float>(bestPoint[j]);
+    }
+  }
+  return hit;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<TriangleBVH::Hit> TriangleBVH::findNearestTriangles(const float* points, size_t numPoints, float maxDistance) const
+{
+  std::vector<Hit> hits(numPoints);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute([this, points, maxDistance, &hits](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      hits[i] = findNearestTriangle(points + 3 * i, maxDistance);
+    }
+  });
+  return hits;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<MeshIndexType> TriangleBVH::findTrianglesOverlappingBox(const float lowerLeft[3], const float upperRight[3]) const
+{
+  std::vector<MeshIndexType> triIds;
+  if(m_Nodes.empty())
+  {
+    return triIds;
+  }
+
+  size_t stack[k_StackSize];
+  size_t stackSize = 0;
+  stack[stackSize++] = 0;
+  while(stackSize > 0)
+  {
+    const Node& node = m_Nodes[stack[--stackSize]];
+    if(!BoxesOverlap(node.LowerLeft, node.UpperRight, lowerLeft, upperRight))
+    {
+      continue;
+    }
+    if(node.Count == 0)
+    {
+      stack[stackSize++] = node.Start;
+      stack[stackSize++] = static_cast<size_t>(&node - m_Nodes.data()) + 1;
+      continue;
+    }
+    for(size_t i = node.Start; i < node.Start + node.Count; i++)
+    {
+      if(TriangleOverlapsBox(m_Coords.data() + 9 * i, lowerLeft, upperRight))
+      {
+        triIds.push_back(m_TriIds[i]);
+      }
+    }
+  }
+  std::sort(triIds.begin(), triIds.end());
+  return triIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<std::vector<MeshIndexType>> TriangleBVH::findTrianglesOverlappingBoxes(const float* lowerLefts, const float* upperRights, size_t numBoxes) const
+{
+  std::vector<std::vector<MeshIndexType>> triIds(numBoxes);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBoxes);
+  dataAlg.execute([this, lowerLefts, upperRights, &triIds](const SIMPLRange& range) {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      triIds[i] = findTrianglesOverlappingBox(lowerLefts + 3 * i, upperRights + 3 * i);
+    }
+  });
+  return triIds;
+}
@@ -0,0 +1,240 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The TriangleBVH class is a bounding volume hierarchy over the triangles of a TriangleGeom,
+ * or over a subset of them such as the faces of one feature. Point-in-polyhedron, ray, nearest
+ * triangle and box queries only visit the triangles whose boxes can matter, instead of every
+ * triangle like the loops of GeometryMath::PointInPolyhedron.
+ *
+ * The hierarchy keeps its own copy of the triangle coordinates, so it does not follow later
+ * changes to the vertices. All queries are const and may run on many threads at once; the
+ * batched versions run in parallel with ParallelDataAlgorithm.
+ */
+class SIMPLib_EXPORT TriangleBVH
+{
+public:
+  SIMPL_SHARED_POINTERS(TriangleBVH)
+  SIMPL_TYPE_MACRO(TriangleBVH)
+
+  /**
+   * @brief Builds a hierarchy over all triangles
+   * @param triangles
+   * @param vertices
+   * @return
+   */
+  static Pointer New(const SharedTriList::Pointer& triangles, const SharedVertexList::Pointer& vertices);
+
+  /**
+   * @brief Builds a hierarchy over the given triangles only
+   * @param triangles
+   * @param vertices
+   * @param triIds
+   * @return
+   */
+  static Pointer New(const SharedTriList::Pointer& triangles, const SharedVertexList::Pointer& vertices, const std::vector<MeshIndexType>& triIds);
+
+  virtual ~TriangleBVH();
+
+  /**
+   * @brief The most triangles in a leaf
+   */
+  static const size_t k_MaxLeafSize = 4;
+
+  /**
+   * @brief The most random rays pointInPolyhedron() casts before it gives up on rays that miss
+   * every edge and vertex
+   */
+  static const size_t k_MaxRayAttempts = 64;
+
+  /**
+   * @brief A triangle found by a ray or nearest triangle query. Distance is from the origin of
+   * the query to Point, which lies on the triangle.
+   */
+  struct Hit
+  {
+    bool Found = false;
+    MeshIndexType TriangleId = 0;
+    float Distance = 0.0f;
+    float Point[3] = {0.0f, 0.0f, 0.0f};
+  };
+
+  /**
+   * @brief Returns the number of triangles in the hierarchy
+   * @return
+   */
+  size_t getNumberOfTriangles() const;
+
+  /**
+   * @brief Returns the number of nodes in the hierarchy
+   * @return
+   */
+  size_t getNumberOfNodes() const;
+
+  /**
+   * @brief Returns the bounding box of the triangles
+   * @param lowerLeft
+   * @param upperRight
+   */
+  void getBounds(float lowerLeft[3], float upperRight[3]) const;
+
+  /**
+   * @brief Classifies a point against the closed surface formed by the triangles by counting the
+   * crossings of a random ray, with the codes of GeometryMath::PointInPolyhedron: 'i' inside,
+   * 'o' outside, and 'V', 'E' or 'F' when the point lies on a vertex, edge or face.
+   * @param q
+   * @param seed Picks the random rays, so the same seed always gives the same answer
+   * @return '?' if every ray touched an edge or vertex
+   */
+  char pointInPolyhedron(const float q[3], uint64_t seed = 0) const;
+
+  /**
+   * @brief Classifies every point, seeding the rays of each point with its index
+   * @param points 3 coordinates per point
+   * @param numPoints
+   * @return
+   */
+  std::vector<char> pointsInPolyhedron(const float* points, size_t numPoints) const;
+
+  /**
+   * @brief Finds the first triangle along a ray
+   * @param origin
+   * @param direction Need not be normalized
+   * @param maxDistance
+   * @return
+   */
+  Hit intersectRay(const float origin[3], const float direction[3], float maxDistance = std::numeric_limits<float>::max()) const;
+
+  /**
+   * @brief Finds the first triangle along every ray
+   * @param origins 3 coordinates per ray
+   * @param directions 3 coordinates per ray
+   * @param numRays
+   * @param maxDistance
+   * @return
+   */
+  std::vector<Hit> intersectRays(const float* origins, const float* directions, size_t numRays, float maxDistance = std::numeric_limits<float>::max()) const;
+
+  /**
+   * @brief Finds the triangle closest to a point
+   * @param point
+   * @param maxDistance Triangles farther away than this are not found
+   * @return
+   */
+  Hit findNearestTriangle(const float point[3], float maxDistance = std::numeric_limits<float>::max()) const;
+
+  /**
+   * @brief Finds the triangle closest to every point
+   * @param points 3 coordinates per point
+   * @param numPoints
+   * @param maxDistance
+   * @return
+   */
+  std::vector<Hit> findNearestTriangles(const float* points, size_t numPoints, float maxDistance = std::numeric_limits<float>::max()) const;
+
+  /**
+   * @brief Finds the triangles that overlap a box
+   * @param lowerLeft
+   * @param upperRight
+   * @return The ids of the triangles in ascending order
+   */
+  std::vector<MeshIndexType> findTrianglesOverlappingBox(const float lowerLeft[3], const float upperRight[3]) const;
+
+  /**
+   * @brief Finds the triangles that overlap every box
+   * @param lowerLefts 3 coordinates per box
+   * @param upperRights 3 coordinates per box
+   * @param numBoxes
+   * @return
+   */
+  std::vector<std::vector<MeshIndexType>> findTrianglesOverlappingBoxes(const float* lowerLefts, const float* upperRights, size_t numBoxes) const;
+
+protected:
+  TriangleBVH(const SharedTriList::Pointer& triangles, const SharedVertexList::Pointer& vertices, const std::vector<MeshIndexType>& triIds);
+
+private:
+  /**
+   * @brief A node is a leaf of Count triangles starting at Start, or when Count is 0 an inner
+   * node whose left child follows it and whose right child is at Start.
+   */
+  struct Node
+  {
+    float LowerLeft[3];
+    float UpperRight[3];
+    size_t Start;
+    size_t Count;
+  };
+
+  std::vector<Node> m_Nodes;
+  std::vector<MeshIndexType> m_TriIds;
+  std::vector<float> m_Coords;
+  float m_Padding = 0.0f;
+
+  /**
+   * @brief Builds the subtree over the triangles from begin to end and returns the index of its root
+   * @param begin
+   * @param end
+   * @param order The triangles in leaf order, rearranged while building
+   * @param triBounds 6 values per triangle
+   * @param centroids 3 values per triangle
+   * @return
+   */
+  size_t buildNode(size_t begin, size_t end, std::vector<size_t>& order, const std::vector<float>& triBounds, const std::vector<float>& centroids);
+
+  /**
+   * @brief Counts the crossings of the segment from q to r, or returns a code other than '0'
+   * when q lies on a triangle or the segment touches an edge or vertex
+   * @param q
+   * @param r
+   * @param crossings
+   * @return
+   */
+  char countCrossings(const float q[3], const float r[3], size_t& crossings) const;
+
+public:
+  TriangleBVH(const TriangleBVH&) = delete;            // Copy Constructor Not Implemented
+  TriangleBVH(TriangleBVH&&) = delete;                 // Move Constructor Not Implemented
+  TriangleBVH& operator=(const TriangleBVH&) = delete; // Copy Assignment Not Implemented
+  TriangleBVH& operator=(TriangleBVH&&) = delete;      // Move Assignment Not Implemented
+};
@@ -130,6 +130,7 @@ TriangleGeom::TriangleGeom()
   m_TriangleNeighbors = ElementDynamicList::NullPointer();
   m_TriangleCentroids = FloatArrayType::NullPointer();
   m_TriangleSizes = FloatArrayType::NullPointer();
+  m_TriangleBVH = TriangleBVH::NullPointer();
   m_ProgressCounter = 0;
 }
 
@@ -373,6 +374,35 @@ void TriangleGeom::deleteElementCentroids()
   m_TriangleCentroids = FloatArrayType::NullPointer();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TriangleGeom::findBoundingVolumeHierarchy()
+{
+  if(m_TriList.get() == nullptr || m_VertexList.get() == nullptr)
+  {
+    return -1;
+  }
+  m_TriangleBVH = TriangleBVH::New(m_TriList, m_VertexList);
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleGeom::getBoundingVolumeHierarchy()
+{
+  return m_TriangleBVH;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleGeom::deleteBoundingVolumeHierarchy()
+{
+  m_TriangleBVH = TriangleBVH::NullPointer();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
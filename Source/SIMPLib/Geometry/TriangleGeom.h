@@ -37,6 +37,7 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Geometry/IGeometry2D.h"
+#include "SIMPLib/Geometry/TriangleBVH.h"
 
 /**
  * @brief The TriangleGeom class represents a collection of triangles
@@ -174,6 +175,25 @@ public:
    */
   size_t getNumberOfTris();
 
+  /**
+   * @brief findBoundingVolumeHierarchy Builds a TriangleBVH over all triangles for point, ray,
+   * nearest triangle and box queries. Like the other find functions, the result is kept until
+   * it is deleted and is not updated when the vertices or triangles change.
+   * @return
+   */
+  int findBoundingVolumeHierarchy();
+
+  /**
+   * @brief getBoundingVolumeHierarchy
+   * @return
+   */
+  TriangleBVH::Pointer getBoundingVolumeHierarchy();
+
+  /**
+   * @brief deleteBoundingVolumeHierarchy
+   */
+  void deleteBoundingVolumeHierarchy();
+
   // -----------------------------------------------------------------------------
   // Inherited from IGeometry
   // -----------------------------------------------------------------------------
@@ -491,6 +511,7 @@ private:
   ElementDynamicList::Pointer m_TriangleNeighbors;
   FloatArrayType::Pointer m_TriangleCentroids;
   FloatArrayType::Pointer m_TriangleSizes;
+  TriangleBVH::Pointer m_TriangleBVH;
 
   friend class FindTriangleDerivativesImpl;
 
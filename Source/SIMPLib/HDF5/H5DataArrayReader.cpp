@@ -40,6 +40,7 @@
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
 
+#include "SIMPLib/DataArrays/BitMaskArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
@@ -65,21 +66,104 @@ template <typename T>
 IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const std::vector<size_t>& tDims, const std::vector<size_t>& cDims)
 {
   herr_t err = -1;
-  IDataArray::Pointer ptr;
+  typename DataArray<T>::Pointer ptr = DataArray<T>::CreateArray(tDims, cDims, datasetPath, false);
 
-  ptr = DataArray<T>::CreateArray(tDims, cDims, datasetPath, true);
-
-  T* data = (T*)(ptr->getVoidPointer(0));
-  err = QH5Lite::readPointerDataset(locId, datasetPath, data);
+  // Allocate without initializing the values since the read overwrites all of them anyways
+  if(ptr->allocate() < 0)
+  {
+    return IDataArray::NullPointer();
+  }
+  err = H5DataArrayReader::ReadDatasetIntoBuffer(locId, datasetPath, H5Lite::HDFTypeForPrimitive(T(0)), ptr->getVoidPointer(0), ptr->getSize());
   if(err < 0)
   {
     qDebug() << "readH5Data read error: " << __FILE__ << "(" << __LINE__ << ")";
-    ptr = IDataArray::NullPointer();
+    return IDataArray::NullPointer();
   }
   return ptr;
 }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5DataArrayReader::ReadDatasetIntoBuffer(hid_t gid, const QString& name, hid_t memType, void* buffer, size_t numElements, size_t slabOffset, size_t slabCount)
+{
+  if(nullptr == buffer && numElements > 0)
+  {
+    return -1;
+  }
+  hid_t did = H5Dopen(gid, name.toLatin1().constData(), H5P_DEFAULT);
+  if(did < 0)
+  {
+    qDebug() << "Error opening Dataset " << name;
+    return -2;
+  }
+  hid_t fileSpace = H5Dget_space(did);
+  if(fileSpace < 0)
+  {
+    H5Dclose(did);
+    return -3;
+  }
+
+  int err = 0;
+  int rank = H5Sget_simple_extent_ndims(fileSpace);
+  std::vector<hsize_t> dims(rank > 0 ? rank : 1, 1);
+  if(rank > 0)
+  {
+    H5Sget_simple_extent_dims(fileSpace, dims.data(), nullptr);
+  }
+  size_t sliceElements = 1;
+  for(size_t i = 1; i < dims.size(); i++)
+  {
+    sliceElements *= dims[i];
+  }
+
+  if(slabCount == 0)
+  {
+    slabOffset = 0;
+    slabCount = (rank > 0) ? dims[0] : 1;
+  }
+  else if(rank < 1 || slabOffset + slabCount > dims[0])
+  {
+    qDebug() << "The requested range " << slabOffset << "+" << slabCount << " is outside of Dataset " << name;
+    err = -4;
+  }
+  else
+  {
+    std::vector<hsize_t> offset(dims.size(), 0);
+    std::vector<hsize_t> count = dims;
+    offset[0] = slabOffset;
+    count[0] = slabCount;
+    if(H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr) < 0)
+    {
+      err = -5;
+    }
+  }
+
+  if(err >= 0 && slabCount * sliceElements != numElements)
+  {
+    qDebug() << "Dataset " << name << " has " << slabCount * sliceElements << " values to read but the buffer holds " << numElements;
+    err = -6;
+  }
+
+  if(err >= 0 && numElements > 0)
+  {
+    // The memory is a flat array that exactly fits the selection
+    hsize_t memDims = numElements;
+    hid_t memSpace = H5Screate_simple(1, &memDims, nullptr);
+    if(H5Dread(did, memType, memSpace, fileSpace, H5P_DEFAULT, buffer) < 0)
+    {
+      qDebug() << "Error reading Dataset " << name;
+      err = -7;
+    }
+    H5Sclose(memSpace);
+  }
+
+  H5Sclose(fileSpace);
+  H5Dclose(did);
+  return err;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -122,7 +206,7 @@ int H5DataArrayReader::ReadRequiredAttributes(hid_t gid, const QString& name, QS
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly)
+IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly, bool optimizeStorage)
 {
   herr_t err = -1;
   // herr_t retErr = 1;
@@ -172,26 +256,65 @@ IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QStr
   }
   // Strings are stored as variable length arrays so trying to match the component
   // dimensions does not make sense.
-  StringDataArray::Pointer strTemp = StringDataArray::CreateArray(dims[0], name, true);
-
-  std::vector<std::string> strings;
-  err = H5Lite::readVectorOfStringDataset(gid, name.toStdString(), strings);
-  // Copy the data into
-  for(std::vector<std::string>::size_type i = 0; i < strings.size(); i++)
+  // Callers that opt in get the values straight in the UTF-8 arena, dictionary encoded for
+  // low cardinality columns. Everyone else gets the QString per tuple they expect from
+  // getVoidPointer().
+  StringDataArray::Pointer strTemp = StringDataArray::CreateArray(0, name, true);
+  if(optimizeStorage)
   {
-    strTemp->setValue(i, QString::fromStdString(strings[i]));
+    strTemp->setStorage(StringDataArray::Storage::Arena);
   }
+  err = strTemp->readH5Data(gid);
   if(err < 0)
   {
     err = H5Tclose(typeId);
     return ptr;
   }
+  if(optimizeStorage)
+  {
+    strTemp->optimizeStorage();
+  }
 
   ptr = strTemp;
 
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ReadBitMaskArray(hid_t gid, const QString& name, bool metaDataOnly)
+{
+  IDataArray::Pointer ptr = IDataArray::NullPointer();
+
+  QString classType;
+  int version = 0;
+  std::vector<size_t> tDims;
+  std::vector<size_t> cDims;
+  herr_t err = ReadRequiredAttributes(gid, name, classType, version, tDims, cDims);
+  if(err < 0)
+  {
+    return ptr;
+  }
+
+  size_t numTuples = 1;
+  for(const auto& dim : tDims)
+  {
+    numTuples *= dim;
+  }
+  BitMaskArray::Pointer mask = BitMaskArray::CreateArray(numTuples, name, false);
+  if(!metaDataOnly)
+  {
+    err = mask->readH5Data(gid);
+    if(err < 0)
+    {
+      return ptr;
+    }
+  }
+  ptr = mask;
+  return ptr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
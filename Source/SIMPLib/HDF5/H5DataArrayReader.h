@@ -67,6 +67,21 @@ class SIMPLib_EXPORT H5DataArrayReader
      */
     static int ReadRequiredAttributes(hid_t gid, const QString& name, QString& objType, int& version, std::vector<size_t>& tDims, std::vector<size_t>& cDims);
 
+    /**
+     * @brief ReadDatasetIntoBuffer Reads a data set, or a contiguous range of it along its slowest
+     * dimension, straight into memory that is supplied by the caller. HDF5 converts the values from
+     * the type in the file to memType while reading, so no intermediate buffer is needed.
+     * @param gid The HDF5 Group to read the data set from
+     * @param name The name of the data set
+     * @param memType The HDF5 native type of the values in buffer
+     * @param buffer The memory to read into
+     * @param numElements The number of values that buffer can hold. This must match the number of values that are read.
+     * @param slabOffset The first index along the slowest dimension of the data set to read
+     * @param slabCount The number of indices along the slowest dimension to read. Zero reads the whole data set.
+     * @return Negative value on error
+     */
+    static int ReadDatasetIntoBuffer(hid_t gid, const QString& name, hid_t memType, void* buffer, size_t numElements, size_t slabOffset = 0, size_t slabCount = 0);
+
     /**
      * @brief ReadIDataArray Reads an IDataArray subclass from the HDF5 file
      * @param gid The HDF5 Group to read the data array from
@@ -90,9 +105,20 @@ class SIMPLib_EXPORT H5DataArrayReader
      * @param gid The HDF5 Group to read the data array from
      * @param name The name of the data set
      * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+     * @param optimizeStorage Keep the values in the Arena or Dictionary layout picked by
+     * StringDataArray::optimizeStorage() instead of one QString per tuple
+     * @return
+     */
+    static IDataArray::Pointer ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly = false, bool optimizeStorage = false);
+
+    /**
+     * @brief ReadBitMaskArray
+     * @param gid The HDF5 Group to read the data array from
+     * @param name The name of the data set
+     * @param metaDataOnly Read just the meta data about the BitMaskArray or actually read all the data
      * @return
      */
-    static IDataArray::Pointer ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
+    static IDataArray::Pointer ReadBitMaskArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
 
   protected:
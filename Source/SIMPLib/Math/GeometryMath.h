@@ -178,7 +178,8 @@ class SIMPLib_EXPORT GeometryMath
     static bool PointInBox(const float p[3], const float ll[3], const float ur[3]);
 
     /**
-     * @brief Determines if a point is inside of a polyhedron defined by a set of faces
+     * @brief Determines if a point is inside of a polyhedron defined by a set of faces. Every face is
+     * tested for every point; TriangleBVH::pointsInPolyhedron classifies many points faster.
      * @param p
      * @param lowerLeft
      * @param upperRight
@@ -14,6 +14,7 @@ const QString SessionID("SessionID");
 const QString PipelineErrors("PipelineErrors");
 const QString PipelineWarnings("PipelineWarnings");
 const QString Completed("Completed");
+const QString Profile("Profile");
 
 const QString ErrorLog("ErrorLog");
 const QString WarningLog("WarningLog");
@@ -27,6 +27,10 @@ public:
 
   friend PipelineListenerMessageHandler;
 
+  // The FilterPipeline::MessageDrainInterval the controllers execute with, so the listener
+  // keeps the coalesced progress of each filter instead of every update it sends
+  static const int k_MessageDrainInterval = 100;
+
   void createErrorLogFile(QString path);
   void createWarningLogFile(QString path);
   void createStatusLogFile(QString path);
@@ -43,6 +43,7 @@
 #include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineProfile.h"
 #include "SIMPLib/Plugin/PluginManager.h"
 #include "SIMPLib/Plugin/SIMPLPluginConstants.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
@@ -173,16 +174,22 @@ void ExecutePipelineController::serviceJSON(QJsonObject pipelineObj)
   Observer obs; // Create an Observer to report errors/progress from the executing pipeline
   pipeline->addMessageReceiver(&obs);
   pipeline->addMessageReceiver(&listener);
+  pipeline->setMessageDrainInterval(PipelineListener::k_MessageDrainInterval);
 
   int err = pipeline->preflightPipeline();
   qDebug() << "Preflight Error: " << err;
 
   if(listener.getErrorMessages().size() <= 0)
   {
+    PipelineProfile::Pointer profile = PipelineProfile::New();
+    pipeline->setProfile(profile);
+
     qDebug() << "Pipeline About to Execute....";
     pipeline->execute();
 
     qDebug() << "Pipeline Done Executing...." << pipeline->getErrorCode();
+
+    m_ResponseObj[SIMPL::JSON::Profile] = profile->toJson();
   }
 
 
@@ -31,6 +31,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "SIMPLib/Utilities/FloatSummation.h"
 
+#include <cmath>
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -44,61 +46,62 @@ FloatSummation::~FloatSummation() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float FloatSummation::Kahanf(std::vector<float> values)
+void FloatSummation::CompensatedSum::add(double value)
 {
-  float sum = 0.0;
-  float compensation = 0.0;
-
-  for(std::vector<float>::size_type i = 0; i < values.size(); i++)
+  // Neumaier's variant of the Kahan summation also keeps the error when value is the larger one
+  double newSum = Sum + value;
+  if(std::abs(Sum) >= std::abs(value))
   {
-    float adjustedValue = values.at(i) - compensation;
-    float newSum = sum + adjustedValue;
-    compensation = (newSum - sum) - adjustedValue;
-
-    sum = newSum;
+    Correction += (Sum - newSum) + value;
   }
-
-  return sum;
+  else
+  {
+    Correction += (value - newSum) + Sum;
+  }
+  Sum = newSum;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double FloatSummation::Kahan(std::vector<double> values)
+double FloatSummation::CompensatedSum::getValue() const
 {
-  double sum = 0.0;
-  double compensation = 0.0;
-
-  for(std::vector<double>::size_type i = 0; i < values.size(); i++)
-  {
-    double adjustedValue = values.at(i) - compensation;
-    double newSum = sum + adjustedValue;
-    compensation = (newSum - sum) - adjustedValue;
-
-    sum = newSum;
-  }
+  return Sum + Correction;
+}
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FloatSummation::CompensatedSum FloatSummation::CompensatedSum::Combine(const CompensatedSum& left, const CompensatedSum& right)
+{
+  CompensatedSum sum = left;
+  sum.Correction += right.Correction;
+  sum.add(right.Sum);
   return sum;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float FloatSummation::Kahanf(std::initializer_list<float> values)
+float FloatSummation::Kahanf(const std::vector<float>& values)
 {
-  float sum = 0.0;
-  float compensation = 0.0;
-
-  for(auto iter = std::begin(values); iter != std::end(values); iter++)
-  {
-    float adjustedValue = (*iter) - compensation;
-    float newSum = sum + adjustedValue;
-    compensation = (newSum - sum) - adjustedValue;
+  return static_cast<float>(Sum(values.data(), values.size()));
+}
 
-    sum = newSum;
-  }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double FloatSummation::Kahan(const std::vector<double>& values)
+{
+  return Sum(values.data(), values.size());
+}
 
-  return sum;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float FloatSummation::Kahanf(std::initializer_list<float> values)
+{
+  return static_cast<float>(Sum(values.begin(), values.size()));
 }
 
 // -----------------------------------------------------------------------------
@@ -106,17 +109,5 @@ float FloatSummation::Kahanf(std::initializer_list<float> values)
 // -----------------------------------------------------------------------------
 double FloatSummation::Kahan(std::initializer_list<double> values)
 {
-  double sum = 0.0;
-  double compensation = 0.0;
-
-  for(auto iter = std::begin(values); iter != std::end(values); iter++)
-  {
-    double adjustedValue = (*iter) - compensation;
-    double newSum = sum + adjustedValue;
-    compensation = (newSum - sum) - adjustedValue;
-
-    sum = newSum;
-  }
-
-  return sum;
+  return Sum(values.begin(), values.size());
 }
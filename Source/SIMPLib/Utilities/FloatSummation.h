@@ -31,14 +31,23 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
-#include <vector>
+#include <cstddef>
 #include <initializer_list>
+#include <vector>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/ParallelDataReduceAlgorithm.h"
 
 /**
 * @brief The FloatSummation class contains helper methods for summation of floating point numbers
+*
+* Sum(), Mean() and Variance() read the values of an array in place. They cut the values into the
+* chunks of a ParallelDataReduceAlgorithm, which depend only on the number of values, and sum the
+* chunks on all threads. Each chunk is summed in double precision by eight independent Kahan lanes
+* that the compiler can vectorize. The lanes and chunks are then merged by a compensated pairwise
+* sum in a fixed order. The result is therefore the same to the bit for any number of threads.
 */
 class SIMPLib_EXPORT FloatSummation
 {
@@ -46,18 +55,47 @@ public:
   FloatSummation();
   virtual ~FloatSummation();
 
+  /**
+  * @brief A sum in double precision along with the rounding error it has not taken in yet
+  */
+  struct SIMPLib_EXPORT CompensatedSum
+  {
+    double Sum = 0.0;
+    double Correction = 0.0;
+
+    /**
+    * @brief Adds the value, keeping its rounding error in the Correction
+    * @param value
+    */
+    void add(double value);
+
+    /**
+    * @brief Returns the sum with its correction applied
+    * @returns
+    */
+    double getValue() const;
+
+    /**
+    * @brief Returns the compensated sum of left and right
+    * @param left
+    * @param right
+    * @returns
+    */
+    static CompensatedSum Combine(const CompensatedSum& left, const CompensatedSum& right);
+  };
+
   /**
   * @brief Performs a Kahan summation over a vector of floating point numbers and returns the result
   * @param values The vector of floats used for the summation
   * @returns Kahan summation of floating point numbers
   */
-  static float Kahanf(std::vector<float> values);
+  static float Kahanf(const std::vector<float>& values);
   /**
   * @brief Performs a Kahan summation over a vector of floating point numbers and returns the result
   * @param values The vector of doubles used for the summation
   * @returns Kahan summation of floating point numbers
   */
-  static double Kahan(std::vector<double> values);
+  static double Kahan(const std::vector<double>& values);
 
   /**
   * @brief Performs a Kahan summation over a list of floating point numbers and returns the result
@@ -72,10 +110,146 @@ public:
   */
   static double Kahan(std::initializer_list<double> values);
 
+  /**
+  * @brief Returns the compensated sum of count values, using all threads of the current arena
+  * @param values
+  * @param count
+  * @returns
+  */
+  template <typename T>
+  static double Sum(const T* values, size_t count)
+  {
+    return Accumulate(values, count, [](double value) { return value; }).getValue();
+  }
+
+  /**
+  * @brief Returns the compensated sum of all values of the array, every component included
+  * @param array
+  * @returns
+  */
+  template <typename T>
+  static double Sum(const DataArray<T>& array)
+  {
+    return Sum(array.data(), array.size());
+  }
+
+  /**
+  * @brief Returns the mean of count values, 0 if there are none
+  * @param values
+  * @param count
+  * @returns
+  */
+  template <typename T>
+  static double Mean(const T* values, size_t count)
+  {
+    return count == 0 ? 0.0 : Sum(values, count) / static_cast<double>(count);
+  }
+
+  /**
+  * @brief Returns the mean of all values of the array, every component included
+  * @param array
+  * @returns
+  */
+  template <typename T>
+  static double Mean(const DataArray<T>& array)
+  {
+    return Mean(array.data(), array.size());
+  }
+
+  /**
+  * @brief Returns the population variance of count values. It takes two passes, one for the
+  * mean and one for the compensated sum of the squared differences from it.
+  * @param values
+  * @param count
+  * @param mean Set to the mean if it is not null
+  * @returns
+  */
+  template <typename T>
+  static double Variance(const T* values, size_t count, double* mean = nullptr)
+  {
+    double average = Mean(values, count);
+    if(mean != nullptr)
+    {
+      *mean = average;
+    }
+    if(count == 0)
+    {
+      return 0.0;
+    }
+    double sumSquares = Accumulate(values, count, [average](double value) { return (value - average) * (value - average); }).getValue();
+    return sumSquares / static_cast<double>(count);
+  }
+
+  /**
+  * @brief Returns the population variance of all values of the array, every component included
+  * @param array
+  * @param mean Set to the mean if it is not null
+  * @returns
+  */
+  template <typename T>
+  static double Variance(const DataArray<T>& array, double* mean = nullptr)
+  {
+    return Variance(array.data(), array.size(), mean);
+  }
+
+private:
+  static const size_t k_Lanes = 8;
+
+  /**
+  * @brief Sums transform(value) over count values in the fixed chunks and lanes described above
+  * @param values
+  * @param count
+  * @param transform
+  * @returns
+  */
+  template <typename T, typename Transform>
+  static CompensatedSum Accumulate(const T* values, size_t count, const Transform& transform)
+  {
+    ParallelDataReduceAlgorithm reduceAlg;
+    reduceAlg.setRange(0, count);
+    return reduceAlg.execute(CompensatedSum(),
+                             [values, &transform](const SIMPLRange& range, const CompensatedSum& init) {
+                               double sums[k_Lanes] = {0.0};
+                               double compensations[k_Lanes] = {0.0};
+                               size_t i = range.min();
+                               for(; i + k_Lanes <= range.max(); i += k_Lanes)
+                               {
+                                 for(size_t lane = 0; lane < k_Lanes; lane++)
+                                 {
+                                   double adjustedValue = transform(static_cast<double>(values[i + lane])) - compensations[lane];
+                                   double newSum = sums[lane] + adjustedValue;
+                                   compensations[lane] = (newSum - sums[lane]) - adjustedValue;
+                                   sums[lane] = newSum;
+                                 }
+                               }
+
+                               CompensatedSum laneSums[k_Lanes];
+                               for(size_t lane = 0; lane < k_Lanes; lane++)
+                               {
+                                 laneSums[lane].Sum = sums[lane];
+                                 laneSums[lane].Correction = -compensations[lane];
+                               }
+                               for(size_t stride = 1; stride < k_Lanes; stride *= 2)
+                               {
+                                 for(size_t lane = 0; lane + stride < k_Lanes; lane += 2 * stride)
+                                 {
+                                   laneSums[lane] = CompensatedSum::Combine(laneSums[lane], laneSums[lane + stride]);
+                                 }
+                               }
+
+                               CompensatedSum sum = CompensatedSum::Combine(init, laneSums[0]);
+                               for(; i < range.max(); i++)
+                               {
+                                 sum.add(transform(static_cast<double>(values[i])));
+                               }
+                               return sum;
+                             },
+                             CompensatedSum::Combine);
+  }
+
 public:
   FloatSummation(const FloatSummation&) = delete; // Copy Constructor Not Implemented
   FloatSummation(FloatSummation&&) = delete;      // Move Constructor Not Implemented
   FloatSummation& operator=(const FloatSummation&) = delete; // Copy Assignment Not Implemented
   FloatSummation& operator=(FloatSummation&&) = delete;      // Move Assignment Not Implemented
 };
-
@@ -39,8 +39,8 @@
  // -----------------------------------------------------------------------------
 ParallelData2DAlgorithm::ParallelData2DAlgorithm()
 : m_Range(SIMPLRange2D())
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 , m_RunParallel(true)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 , m_Partitioner(tbb::auto_partitioner())
 #endif
 {
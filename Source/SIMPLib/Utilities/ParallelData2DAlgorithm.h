@@ -38,6 +38,7 @@
 
 #include "SIMPLib/Common/SIMPLRange2D.h"
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ThreadScheduler.h"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
 // This is consistent with previous behavior, only earlier parallelization split the includes between
@@ -47,15 +48,15 @@
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 // clang-format on
 #endif
 
 /**
  * @brief The ParallelData2DAlgorithm class handles parallelization across 2D data-based algorithms.
  * A range is required, as well as an object with a matching function operator.  This class
- * utilizes TBB for parallelization and will fallback to non-parallelization if it is not
- * available or the parallelization is disabled.
+ * runs on the threads of the current ThreadScheduler arena, with TBB if it is available and
+ * with the built-in thread pool of the scheduler otherwise, and runs serially if the
+ * parallelization is disabled.
  */
 class SIMPLib_EXPORT ParallelData2DAlgorithm
 {
@@ -113,21 +114,22 @@ public:
   template <typename Body>
   void execute(const Body& body)
   {
-    bool doParallel = false;
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    doParallel = m_RunParallel;
-    if(doParallel)
-    {
-      tbb::blocked_range2d<size_t, size_t> tbbRange(m_Range.minRow(), m_Range.maxRow(), m_Range.minCol(), m_Range.maxCol());
-      tbb::parallel_for(tbbRange, body, m_Partitioner);
-    }
-#endif
-
     // Run non-parallel operation
-    if(!doParallel)
+    if(!m_RunParallel)
     {
       body(m_Range);
+      return;
     }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::blocked_range2d<size_t, size_t> tbbRange(m_Range.minRow(), m_Range.maxRow(), m_Range.minCol(), m_Range.maxCol());
+    ThreadScheduler::Instance()->execute([&] { tbb::parallel_for(tbbRange, body, m_Partitioner); });
+#else
+    // The thread pool splits the rows only
+    SIMPLRange2D range = m_Range;
+    ThreadScheduler::Instance()->parallelFor(range.minRow(), range.maxRow(), 1,
+                                             [&body, &range](size_t begin, size_t end) { body(SIMPLRange2D(begin, range.minCol(), end, range.maxCol())); });
+#endif
   }
 
 private:
@@ -39,8 +39,8 @@
  // -----------------------------------------------------------------------------
 ParallelData3DAlgorithm::ParallelData3DAlgorithm()
 : m_Range(SIMPLRange3D())
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 , m_RunParallel(true)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 , m_Partitioner(tbb::auto_partitioner())
 #endif
 {
@@ -39,8 +39,8 @@
  // -----------------------------------------------------------------------------
 ParallelDataAlgorithm::ParallelDataAlgorithm()
 : m_Range(SIMPLRange())
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 , m_RunParallel(true)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 , m_Partitioner(tbb::auto_partitioner())
 #endif
 {
@@ -0,0 +1,130 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ParallelDataReduceAlgorithm.h"
+
+#include <algorithm>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelDataReduceAlgorithm::ParallelDataReduceAlgorithm() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelDataReduceAlgorithm::~ParallelDataReduceAlgorithm() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ParallelDataReduceAlgorithm::getParallelizationEnabled() const
+{
+  return m_RunParallel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelDataReduceAlgorithm::setParallelizationEnabled(bool doParallel)
+{
+  m_RunParallel = doParallel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLRange ParallelDataReduceAlgorithm::getRange() const
+{
+  return m_Range;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelDataReduceAlgorithm::setRange(const SIMPLRange& range)
+{
+  m_Range = range;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelDataReduceAlgorithm::setRange(size_t min, size_t max)
+{
+  m_Range = {min, max};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ParallelDataReduceAlgorithm::getGrainSize() const
+{
+  return m_GrainSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelDataReduceAlgorithm::setGrainSize(size_t grainSize)
+{
+  m_GrainSize = std::max<size_t>(grainSize, 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ParallelDataReduceAlgorithm::getChunkCount() const
+{
+  if(m_Range.empty())
+  {
+    return 0;
+  }
+  size_t numChunks = (m_Range.size() + m_GrainSize - 1) / m_GrainSize;
+  return numChunks < k_MaxChunks ? numChunks : k_MaxChunks;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLRange ParallelDataReduceAlgorithm::getChunk(size_t index) const
+{
+  // Spread the remainder over the first chunks so no chunk is more than one index longer
+  size_t numChunks = getChunkCount();
+  size_t chunkSize = m_Range.size() / numChunks;
+  size_t remainder = m_Range.size() % numChunks;
+  size_t begin = m_Range.min() + index * chunkSize + std::min(index, remainder);
+  size_t end = begin + chunkSize + (index < remainder ? 1 : 0);
+  return {begin, end};
+}
@@ -0,0 +1,166 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief The ParallelDataReduceAlgorithm class combines the values of a range into one, such as
+ * a sum, a minimum and maximum or a histogram. The range is cut into chunks that depend only on
+ * its size and the grain size, each chunk is reduced on the threads of the current
+ * ThreadScheduler arena, and the chunk results are then combined pairwise in a fixed order on
+ * the calling thread. A floating point reduction therefore gives the same bits whatever the
+ * number of threads, and with the parallelization disabled.
+ */
+class SIMPLib_EXPORT ParallelDataReduceAlgorithm
+{
+public:
+  ParallelDataReduceAlgorithm();
+  virtual ~ParallelDataReduceAlgorithm();
+
+  /**
+   * @brief The most chunks a range is cut into
+   */
+  static const size_t k_MaxChunks = 256;
+
+  /**
+   * @brief Returns true if parallelization is enabled.  Returns false otherwise.
+   * @return
+   */
+  bool getParallelizationEnabled() const;
+
+  /**
+   * @brief Sets whether parallelization is enabled.
+   * @param doParallel
+   */
+  void setParallelizationEnabled(bool doParallel);
+
+  /**
+   * @brief Returns the range to operate over.
+   * @return
+   */
+  SIMPLRange getRange() const;
+
+  /**
+   * @brief Sets the range to operate over.
+   * @param range
+   */
+  void setRange(const SIMPLRange& range);
+
+  /**
+   * @brief Sets the range to operate over.
+   * @param min
+   * @param max
+   */
+  void setRange(size_t min, size_t max);
+
+  /**
+   * @brief Returns the fewest indices in a chunk.
+   * @return
+   */
+  size_t getGrainSize() const;
+
+  /**
+   * @brief Sets the fewest indices in a chunk. Ranges of more than k_MaxChunks times the grain
+   * size get larger chunks.
+   * @param grainSize
+   */
+  void setGrainSize(size_t grainSize);
+
+  /**
+   * @brief Returns the number of chunks the range is cut into.
+   * @return
+   */
+  size_t getChunkCount() const;
+
+  /**
+   * @brief Returns the indices of a chunk.
+   * @param index
+   * @return
+   */
+  SIMPLRange getChunk(size_t index) const;
+
+  /**
+   * @brief Reduces the range and returns the result.
+   * @param identity The value of an empty range, such as 0 for a sum
+   * @param body Called as T body(const SIMPLRange& range, const T& init) and returns init
+   * combined with the values of the range
+   * @param combine Called as T combine(const T& left, const T& right), where left comes
+   * before right in the range
+   * @return
+   */
+  template <typename T, typename Body, typename Combine>
+  T execute(const T& identity, const Body& body, const Combine& combine) const
+  {
+    static_assert(!std::is_same<T, bool>::value, "std::vector<bool> cannot hold the chunk results of separate threads");
+
+    size_t numChunks = getChunkCount();
+    if(numChunks == 0)
+    {
+      return identity;
+    }
+
+    std::vector<T> partials(numChunks, identity);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setParallelizationEnabled(m_RunParallel && numChunks > 1);
+    dataAlg.setRange(0, numChunks);
+    dataAlg.execute([&](const SIMPLRange& chunks) {
+      for(size_t chunk = chunks.min(); chunk < chunks.max(); chunk++)
+      {
+        partials[chunk] = body(getChunk(chunk), identity);
+      }
+    });
+
+    // The same pairwise tree for any number of threads keeps the result reproducible
+    for(size_t stride = 1; stride < numChunks; stride *= 2)
+    {
+      for(size_t i = 0; i + stride < numChunks; i += 2 * stride)
+      {
+        partials[i] = combine(partials[i], partials[i + stride]);
+      }
+    }
+    return partials[0];
+  }
+
+private:
+  SIMPLRange m_Range;
+  size_t m_GrainSize = 4096;
+  bool m_RunParallel = true;
+};
@@ -0,0 +1,193 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelDataReduceAlgorithm.h"
+
+/**
+ * @brief The ParallelDataScanAlgorithm class computes running values over a range, such as the
+ * prefix sum that turns a mask into the new indices of the tuples that are kept. It cuts the
+ * range into the same chunks as ParallelDataReduceAlgorithm. The first pass reduces every chunk
+ * in parallel. The chunk totals are then combined in order on the calling thread. The second
+ * pass scans every chunk in parallel, starting from the total of the chunks before it.
+ *
+ * With the parallelization disabled, or a single chunk, the range is scanned once in order
+ * instead. Integer scans give the same result either way. Floating point scans give the same
+ * result for any number of threads, but may differ in the last bits from the serial scan.
+ */
+class SIMPLib_EXPORT ParallelDataScanAlgorithm : public ParallelDataReduceAlgorithm
+{
+public:
+  ParallelDataScanAlgorithm();
+  ~ParallelDataScanAlgorithm() override;
+
+  /**
+   * @brief Scans the range and returns the combination of all of its values.
+   * @param identity The value of an empty range, such as 0 for a sum
+   * @param reduce Called as T reduce(const SIMPLRange& range, const T& init) and returns init
+   * combined with the values of the range
+   * @param combine Called as T combine(const T& left, const T& right), where left comes
+   * before right in the range
+   * @param scan Called as T scan(const SIMPLRange& range, const T& prefix), where prefix
+   * combines all values of the range before range.min(). It writes the running values of the
+   * range and returns prefix combined with the values of the range.
+   * @return
+   */
+  template <typename T, typename Reduce, typename Combine, typename Scan>
+  T execute(const T& identity, const Reduce& reduce, const Combine& combine, const Scan& scan) const
+  {
+    static_assert(!std::is_same<T, bool>::value, "std::vector<bool> cannot hold the chunk results of separate threads");
+
+    size_t numChunks = getChunkCount();
+    if(numChunks == 0)
+    {
+      return identity;
+    }
+
+    if(!getParallelizationEnabled() || numChunks == 1)
+    {
+      T prefix = identity;
+      for(size_t chunk = 0; chunk < numChunks; chunk++)
+      {
+        prefix = scan(getChunk(chunk), prefix);
+      }
+      return prefix;
+    }
+
+    // prefixes[i] ends up holding the combination of the chunks before chunk i
+    std::vector<T> prefixes(numChunks + 1, identity);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.execute([&](const SIMPLRange& chunks) {
+      for(size_t chunk = chunks.min(); chunk < chunks.max(); chunk++)
+      {
+        prefixes[chunk + 1] = reduce(getChunk(chunk), identity);
+      }
+    });
+
+    for(size_t chunk = 1; chunk <= numChunks; chunk++)
+    {
+      prefixes[chunk] = combine(prefixes[chunk - 1], prefixes[chunk]);
+    }
+
+    dataAlg.execute([&](const SIMPLRange& chunks) {
+      for(size_t chunk = chunks.min(); chunk < chunks.max(); chunk++)
+      {
+        scan(getChunk(chunk), prefixes[chunk]);
+      }
+    });
+    return prefixes[numChunks];
+  }
+
+  /**
+   * @brief Sets output[i] to the sum of input[getRange().min()] up to, but not including,
+   * input[i] for every i in the range. input and output may be the same array.
+   * @param input
+   * @param output
+   * @return The sum of the whole range
+   */
+  template <typename InT, typename OutT>
+  OutT exclusiveSum(const InT* input, OutT* output) const
+  {
+    return execute(static_cast<OutT>(0), SumReduce<InT, OutT>(input), SumCombine<OutT>(), [input, output](const SIMPLRange& range, OutT value) {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        OutT current = static_cast<OutT>(input[i]);
+        output[i] = value;
+        value += current;
+      }
+      return value;
+    });
+  }
+
+  /**
+   * @brief Sets output[i] to the sum of input[getRange().min()] up to and including input[i]
+   * for every i in the range. input and output may be the same array.
+   * @param input
+   * @param output
+   * @return The sum of the whole range
+   */
+  template <typename InT, typename OutT>
+  OutT inclusiveSum(const InT* input, OutT* output) const
+  {
+    return execute(static_cast<OutT>(0), SumReduce<InT, OutT>(input), SumCombine<OutT>(), [input, output](const SIMPLRange& range, OutT value) {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        value += static_cast<OutT>(input[i]);
+        output[i] = value;
+      }
+      return value;
+    });
+  }
+
+private:
+  template <typename InT, typename OutT>
+  class SumReduce
+  {
+  public:
+    SumReduce(const InT* input)
+    : m_Input(input)
+    {
+    }
+
+    OutT operator()(const SIMPLRange& range, OutT value) const
+    {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        value += static_cast<OutT>(m_Input[i]);
+      }
+      return value;
+    }
+
+  private:
+    const InT* m_Input;
+  };
+
+  template <typename OutT>
+  class SumCombine
+  {
+  public:
+    OutT operator()(const OutT& left, const OutT& right) const
+    {
+      return left + right;
+    }
+  };
+};
@@ -35,17 +35,13 @@
 #include "ParallelTaskAlgorithm.h"
 
 #include <algorithm>
-#include <thread>
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 ParallelTaskAlgorithm::ParallelTaskAlgorithm()
 : m_Parallelization(true)
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-, m_MaxThreads(std::thread::hardware_concurrency())
-, m_TaskGroup(new tbb::task_group)
-#endif
+, m_MaxThreads(ThreadScheduler::Instance()->getMaxConcurrency())
 {
 }
 
@@ -54,9 +50,7 @@ ParallelTaskAlgorithm::ParallelTaskAlgorithm()
 // -----------------------------------------------------------------------------
 ParallelTaskAlgorithm::~ParallelTaskAlgorithm()
 {
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  m_TaskGroup->wait();
-#endif
+  m_TaskGroup.wait();
 }
 
 // -----------------------------------------------------------------------------
@@ -80,11 +74,7 @@ void ParallelTaskAlgorithm::setParallelizationEnabled(bool doParallel)
 // -----------------------------------------------------------------------------
 uint32_t ParallelTaskAlgorithm::getMaxThreads() const
 {
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   return m_MaxThreads;
-#else
-  return std::thread::hardware_concurrency();
-#endif
 }
 
 // -----------------------------------------------------------------------------
@@ -92,7 +82,7 @@ uint32_t ParallelTaskAlgorithm::getMaxThreads() const
 // -----------------------------------------------------------------------------
 void ParallelTaskAlgorithm::setMaxThreads(uint32_t threads)
 {
-  m_MaxThreads = std::min(threads, std::thread::hardware_concurrency());
+  m_MaxThreads = std::max(1u, std::min(threads, ThreadScheduler::Instance()->getMaxConcurrency()));
 }
 
 // -----------------------------------------------------------------------------
@@ -100,9 +90,7 @@ void ParallelTaskAlgorithm::setMaxThreads(uint32_t threads)
 // -----------------------------------------------------------------------------
 void ParallelTaskAlgorithm::wait()
 {
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   // This will spill over if the number of files to process does not divide evenly by the number of threads.
-  m_TaskGroup->wait();
+  m_TaskGroup.wait();
   m_CurThreads = 0;
-#endif
 }
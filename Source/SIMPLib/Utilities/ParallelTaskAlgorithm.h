@@ -35,22 +35,14 @@
 #pragma once
 
 #include "SIMPLib/SIMPLib.h"
-
-// SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
-// This is consistent with previous behavior, only earlier parallelization split the includes between
-// the corresponding .h and .cpp files.
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-// clang-format off
-#include <tbb/task_group.h>
-#include <tbb/task_scheduler_init.h>
-// clang-format on
-#endif
+#include "SIMPLib/Utilities/ThreadScheduler.h"
 
 /**
  * @brief The ParallelTaskAlgorithm class handles parallelization across task-based algorithms.
- * An object with a function operator is required to operate the task.  This class utilizes
- * TBB for parallelization and will fallback to non-parallelization if it is not available
- * or the parallelization is disabled.
+ * An object with a function operator is required to operate the task.  The tasks run on the
+ * threads of the ThreadScheduler arena that was current when the algorithm was created, with
+ * TBB if it is available and with the built-in thread pool of the scheduler otherwise. They
+ * run serially if the parallelization is disabled.
  */
 class SIMPLib_EXPORT ParallelTaskAlgorithm
 {
@@ -71,15 +63,15 @@ public:
   void setParallelizationEnabled(bool doParallel);
 
   /**
-   * @brief Return maximum threads to use for parallelization.  If Parallel Algorithms
-   * is not enabled, the maximum hardware concurrency is returned instead.
+   * @brief Return maximum threads to use for parallelization.  This defaults to the
+   * concurrency of the current ThreadScheduler arena.
    * @return
    */
   uint32_t getMaxThreads() const;
 
   /**
    * @brief Sets the maximum number of threads to use.  This amount is automatically
-   * reduced to the max hardware concurrency.
+   * reduced to the concurrency of the current ThreadScheduler arena.
    * @param threads
    */
   void setMaxThreads(uint32_t threads);
@@ -93,21 +85,19 @@ public:
   template <typename Body>
   void execute(const Body& body)
   {
-    bool doParallel = false;
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-    doParallel = m_Parallelization;
-    if(doParallel)
+    if(m_Parallelization)
     {
-      m_TaskGroup->run(body);
+      m_TaskGroup.run(body);
       m_CurThreads++;
       if(m_CurThreads >= m_MaxThreads)
       {
         wait();
       }
     }
-#else
-    body();
-#endif
+    else
+    {
+      body();
+    }
   }
 
   /**
@@ -117,10 +107,7 @@ public:
 
 private:
   bool m_Parallelization = false;
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   uint32_t m_MaxThreads = 1;
   uint32_t m_CurThreads = 0;
-  tbb::task_scheduler_init init;
-  std::shared_ptr<tbb::task_group> m_TaskGroup;
-#endif
+  ThreadScheduler::TaskGroup m_TaskGroup;
 };
@@ -33,7 +33,10 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <chrono>
 #include <cmath>
+#include <cstring>
+#include <random>
 
 #include "SIMPLib/Common/Observer.h"
 #include "SIMPLib/SIMPLib.h"
@@ -46,7 +49,9 @@
 #include "SIMPLib/TestFilters/ThresholdExample.h"
 #endif
 
+#include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Utilities/FloatSummation.h"
+#include "SIMPLib/Utilities/ThreadScheduler.h"
 
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
@@ -129,6 +134,63 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDeterministicSum()
+  {
+    const size_t numTuples = 1 << 24;
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(numTuples, "Data", true);
+    float* values = data->getPointer(0);
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> distribution(0.0f, 1000.0f);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      values[i] = distribution(generator);
+    }
+
+    // The sum must not change in any bit with the number of threads
+    double serialSum = 0.0;
+    {
+      ThreadScheduler::Scope scope(ThreadScheduler::Instance()->createArena(1));
+      serialSum = FloatSummation::Sum(*data);
+    }
+    uint32_t maxThreads = ThreadScheduler::Instance()->getMaxConcurrency();
+    for(uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+      ThreadScheduler::Scope scope(ThreadScheduler::Instance()->createArena(threads));
+      auto start = std::chrono::steady_clock::now();
+      double sum = FloatSummation::Sum(*data);
+      auto end = std::chrono::steady_clock::now();
+      DREAM3D_REQUIRE(std::memcmp(&sum, &serialSum, sizeof(double)) == 0)
+
+      auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+      std::cout << "\tSum of " << numTuples << " floats on " << threads << " threads: " << elapsed.count() << " microseconds" << std::endl;
+    }
+
+    double mean = 0.0;
+    double variance = FloatSummation::Variance(*data, &mean);
+    DREAM3D_REQUIRE(std::abs(mean - serialSum / numTuples) < 1.0E-9)
+    DREAM3D_REQUIRE(std::abs(mean - 500.0) < 1.0)
+    DREAM3D_REQUIRE(std::abs(variance - 1000.0 * 1000.0 / 12.0) < 200.0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCompensation()
+  {
+    // A plain sum loses the small values next to the large ones
+    double sum = FloatSummation::Kahan({1.0E100, 1.0, -1.0E100});
+    DREAM3D_REQUIRE_EQUAL(sum, 1.0)
+
+    std::vector<int32_t> values = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    DREAM3D_REQUIRE_EQUAL(FloatSummation::Sum(values.data(), values.size()), 66.0)
+    DREAM3D_REQUIRE_EQUAL(FloatSummation::Mean(values.data(), values.size()), 6.0)
+    DREAM3D_REQUIRE_EQUAL(FloatSummation::Variance(values.data(), values.size()), 10.0)
+    DREAM3D_REQUIRE_EQUAL(FloatSummation::Mean(values.data(), 0), 0.0)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -139,6 +201,8 @@ public:
     int err = EXIT_SUCCESS;
 
     DREAM3D_REGISTER_TEST(TestKahanAccuracy());
+    DREAM3D_REGISTER_TEST(TestDeterministicSum());
+    DREAM3D_REGISTER_TEST(TestCompensation());
   }
 
 private:
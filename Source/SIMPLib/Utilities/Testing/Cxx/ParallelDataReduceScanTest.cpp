@@ -0,0 +1,231 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/ParallelDataReduceAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelDataScanAlgorithm.h"
+#include "SIMPLib/Utilities/ThreadScheduler.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ParallelDataReduceScanTest
+{
+public:
+  ParallelDataReduceScanTest() = default;
+  virtual ~ParallelDataReduceScanTest() = default;
+
+  ParallelDataReduceScanTest(const ParallelDataReduceScanTest&) = delete;            // Copy Constructor Not Implemented
+  ParallelDataReduceScanTest(ParallelDataReduceScanTest&&) = delete;                 // Move Constructor Not Implemented
+  ParallelDataReduceScanTest& operator=(const ParallelDataReduceScanTest&) = delete; // Copy Assignment Not Implemented
+  ParallelDataReduceScanTest& operator=(ParallelDataReduceScanTest&&) = delete;      // Move Assignment Not Implemented
+
+  const size_t k_NumTuples = 1 << 24;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<uint32_t> getThreadCounts()
+  {
+    std::vector<uint32_t> threadCounts = {1};
+    uint32_t maxThreads = ThreadScheduler::Instance()->getMaxConcurrency();
+    for(uint32_t threads = 2; threads < maxThreads; threads *= 2)
+    {
+      threadCounts.push_back(threads);
+    }
+    if(maxThreads > 1)
+    {
+      threadCounts.push_back(maxThreads);
+    }
+    return threadCounts;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReduce()
+  {
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(k_NumTuples, "Data", true);
+    float* values = data->getPointer(0);
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> distribution(-1.0f, 10.0f);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      values[i] = distribution(generator);
+    }
+
+    // A float sum changes with the order of the additions, so it only matches if the chunks do
+    auto sum = [values](const SIMPLRange& range, float value) {
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        value += values[i];
+      }
+      return value;
+    };
+    auto add = [](float left, float right) { return left + right; };
+
+    ParallelDataReduceAlgorithm reduceAlg;
+    reduceAlg.setRange(0, k_NumTuples);
+    DREAM3D_REQUIRE_EQUAL(reduceAlg.getChunkCount(), ParallelDataReduceAlgorithm::k_MaxChunks)
+
+    reduceAlg.setParallelizationEnabled(false);
+    float serialSum = reduceAlg.execute(0.0f, sum, add);
+    reduceAlg.setParallelizationEnabled(true);
+
+    for(uint32_t threads : getThreadCounts())
+    {
+      ThreadScheduler::Scope scope(ThreadScheduler::Instance()->createArena(threads));
+      auto start = std::chrono::steady_clock::now();
+      float parallelSum = reduceAlg.execute(0.0f, sum, add);
+      auto end = std::chrono::steady_clock::now();
+      DREAM3D_REQUIRE(std::memcmp(&parallelSum, &serialSum, sizeof(float)) == 0)
+
+      auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+      std::cout << "\tReduce " << k_NumTuples << " floats on " << threads << " threads: " << elapsed.count() << " microseconds" << std::endl;
+    }
+
+    // A histogram as the reduced value
+    using Histogram = std::vector<size_t>;
+    Histogram histogram = reduceAlg.execute(Histogram(11, 0),
+                                            [values](const SIMPLRange& range, Histogram value) {
+                                              for(size_t i = range.min(); i < range.max(); i++)
+                                              {
+                                                value[static_cast<size_t>(values[i] + 1.0f)]++;
+                                              }
+                                              return value;
+                                            },
+                                            [](const Histogram& left, const Histogram& right) {
+                                              Histogram value(left);
+                                              for(size_t bin = 0; bin < value.size(); bin++)
+                                              {
+                                                value[bin] += right[bin];
+                                              }
+                                              return value;
+                                            });
+    size_t count = 0;
+    for(size_t bin : histogram)
+    {
+      count += bin;
+    }
+    DREAM3D_REQUIRE_EQUAL(count, k_NumTuples)
+
+    reduceAlg.setRange(10, 10);
+    DREAM3D_REQUIRE_EQUAL(reduceAlg.getChunkCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(reduceAlg.execute(1.5f, sum, add), 1.5f)
+
+    reduceAlg.setRange(10, 110);
+    reduceAlg.setGrainSize(30);
+    DREAM3D_REQUIRE_EQUAL(reduceAlg.getChunkCount(), 4)
+    DREAM3D_REQUIRE_EQUAL(reduceAlg.getChunk(0).min(), 10)
+    DREAM3D_REQUIRE_EQUAL(reduceAlg.getChunk(3).max(), 110)
+    DREAM3D_REQUIRE_EQUAL(reduceAlg.getChunk(3).size(), 25)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestScan()
+  {
+    BoolArrayType::Pointer mask = BoolArrayType::CreateArray(k_NumTuples, "Mask", true);
+    bool* maskValues = mask->getPointer(0);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      maskValues[i] = (i % 7 == 0) || (i % 5 == 3);
+    }
+
+    std::vector<int64_t> expected(k_NumTuples);
+    int64_t expectedCount = 0;
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      expected[i] = expectedCount;
+      expectedCount += maskValues[i] ? 1 : 0;
+    }
+
+    Int64ArrayType::Pointer newIndices = Int64ArrayType::CreateArray(k_NumTuples, "NewIndices", true);
+    int64_t* indices = newIndices->getPointer(0);
+
+    ParallelDataScanAlgorithm scanAlg;
+    scanAlg.setRange(0, k_NumTuples);
+    for(uint32_t threads : getThreadCounts())
+    {
+      newIndices->initializeWithValue(-1);
+      ThreadScheduler::Scope scope(ThreadScheduler::Instance()->createArena(threads));
+      auto start = std::chrono::steady_clock::now();
+      int64_t count = scanAlg.exclusiveSum(maskValues, indices);
+      auto end = std::chrono::steady_clock::now();
+      DREAM3D_REQUIRE_EQUAL(count, expectedCount)
+      DREAM3D_REQUIRE(std::equal(expected.begin(), expected.end(), indices))
+
+      auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+      std::cout << "\tScan " << k_NumTuples << " mask values on " << threads << " threads: " << elapsed.count() << " microseconds" << std::endl;
+    }
+
+    scanAlg.setParallelizationEnabled(false);
+    newIndices->initializeWithValue(-1);
+    DREAM3D_REQUIRE_EQUAL(scanAlg.exclusiveSum(maskValues, indices), expectedCount)
+    DREAM3D_REQUIRE(std::equal(expected.begin(), expected.end(), indices))
+
+    // An inclusive scan in place over part of an array
+    std::vector<int32_t> counts(1000, 1);
+    scanAlg.setParallelizationEnabled(true);
+    scanAlg.setRange(100, 900);
+    scanAlg.setGrainSize(16);
+    DREAM3D_REQUIRE_EQUAL(scanAlg.inclusiveSum(counts.data(), counts.data()), 800)
+    DREAM3D_REQUIRE_EQUAL(counts[99], 1)
+    DREAM3D_REQUIRE_EQUAL(counts[100], 1)
+    DREAM3D_REQUIRE_EQUAL(counts[899], 800)
+    DREAM3D_REQUIRE_EQUAL(counts[900], 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### ParallelDataReduceScanTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestReduce())
+    DREAM3D_REGISTER_TEST(TestScan())
+  }
+};
@@ -0,0 +1,237 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
+#include "SIMPLib/Utilities/ThreadScheduler.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+namespace
+{
+/**
+ * @brief Adds up its range and tracks how many threads run it at once
+ */
+class CountingImpl
+{
+public:
+  CountingImpl(const std::vector<int>& values, std::atomic<int64_t>& sum, std::atomic<int>& active, std::atomic<int>& peak)
+  : m_Values(values)
+  , m_Sum(sum)
+  , m_Active(active)
+  , m_Peak(peak)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    int active = ++m_Active;
+    int peak = m_Peak.load();
+    while(active > peak && !m_Peak.compare_exchange_weak(peak, active))
+    {
+    }
+    int64_t sum = 0;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      sum += m_Values[i];
+    }
+    m_Sum += sum;
+    m_Active--;
+  }
+
+private:
+  const std::vector<int>& m_Values;
+  std::atomic<int64_t>& m_Sum;
+  std::atomic<int>& m_Active;
+  std::atomic<int>& m_Peak;
+};
+} // namespace
+
+class ThreadSchedulerTest
+{
+public:
+  ThreadSchedulerTest() = default;
+  virtual ~ThreadSchedulerTest() = default;
+
+  ThreadSchedulerTest(const ThreadSchedulerTest&) = delete;            // Copy Constructor Not Implemented
+  ThreadSchedulerTest(ThreadSchedulerTest&&) = delete;                 // Move Constructor Not Implemented
+  ThreadSchedulerTest& operator=(const ThreadSchedulerTest&) = delete; // Copy Assignment Not Implemented
+  ThreadSchedulerTest& operator=(ThreadSchedulerTest&&) = delete;      // Move Assignment Not Implemented
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestParallelFor()
+  {
+    ThreadScheduler* scheduler = ThreadScheduler::Instance();
+    DREAM3D_REQUIRED(scheduler->getMaxConcurrency(), >=, 1)
+
+    const size_t numValues = 1000003;
+    std::vector<int> values(numValues);
+    std::iota(values.begin(), values.end(), 0);
+    int64_t expected = std::accumulate(values.begin(), values.end(), static_cast<int64_t>(0));
+
+    // Every index is visited exactly once, even with nested loops in the pieces
+    std::atomic<int64_t> sum(0);
+    scheduler->parallelFor(0, numValues, 1000, [&](size_t begin, size_t end) {
+      int64_t partial = 0;
+      for(size_t i = begin; i < end; i++)
+      {
+        partial += values[i];
+      }
+      sum += partial;
+      scheduler->parallelFor(0, 10, 1, [](size_t, size_t) {});
+    });
+    DREAM3D_REQUIRE_EQUAL(sum.load(), expected)
+
+    sum = 0;
+    std::atomic<int> active(0);
+    std::atomic<int> peak(0);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numValues);
+    dataAlg.execute(CountingImpl(values, sum, active, peak));
+    DREAM3D_REQUIRE_EQUAL(sum.load(), expected)
+
+    bool caught = false;
+    try
+    {
+      scheduler->parallelFor(0, 100, 1, [](size_t begin, size_t) {
+        if(begin == 0)
+        {
+          throw std::runtime_error("piece failed");
+        }
+      });
+    } catch(const std::runtime_error&)
+    {
+      caught = true;
+    }
+    DREAM3D_REQUIRE(caught)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestArenaLimit()
+  {
+    ThreadScheduler* scheduler = ThreadScheduler::Instance();
+    ThreadScheduler::Arena::Pointer arena = scheduler->createArena(2);
+    DREAM3D_REQUIRED(arena->getMaxConcurrency(), <=, 2)
+
+    const size_t numValues = 1 << 22;
+    std::vector<int> values(numValues, 1);
+    std::atomic<int64_t> sum(0);
+    std::atomic<int> active(0);
+    std::atomic<int> peak(0);
+    {
+      ThreadScheduler::Scope scope(arena);
+      DREAM3D_REQUIRE(ThreadScheduler::CurrentArena() == arena)
+      DREAM3D_REQUIRED(scheduler->getMaxConcurrency(), <=, 2)
+
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, numValues);
+      dataAlg.execute(CountingImpl(values, sum, active, peak));
+    }
+    DREAM3D_REQUIRE(ThreadScheduler::CurrentArena() == scheduler->getDefaultArena())
+    DREAM3D_REQUIRE_EQUAL(sum.load(), static_cast<int64_t>(numValues))
+    DREAM3D_REQUIRED(peak.load(), <=, 2)
+
+    ThreadScheduler::Statistics statistics = arena->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(statistics.Regions, 1)
+    DREAM3D_REQUIRED(statistics.BusyTime, <=, statistics.Lifetime)
+    DREAM3D_REQUIRED(statistics.getUtilization(), >=, 0.0)
+    DREAM3D_REQUIRED(statistics.getUtilization(), <=, 1.0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTasks()
+  {
+    ThreadScheduler::Arena::Pointer arena = ThreadScheduler::Instance()->createArena(3);
+    ThreadScheduler::Scope scope(arena);
+
+    std::atomic<int> count(0);
+    {
+      ParallelTaskAlgorithm taskAlg;
+      DREAM3D_REQUIRED(taskAlg.getMaxThreads(), <=, 3)
+      for(int i = 0; i < 100; i++)
+      {
+        taskAlg.execute([&count] { count++; });
+      }
+      taskAlg.wait();
+      DREAM3D_REQUIRE_EQUAL(count.load(), 100)
+    }
+
+    // A task that throws may cancel the tasks that have not started, so only the counting
+    // task waited for before it is sure to have run
+    ThreadScheduler::TaskGroup group;
+    group.run([&count] { count++; });
+    group.wait();
+    group.run([] { throw std::runtime_error("task failed"); });
+    bool caught = false;
+    try
+    {
+      group.wait();
+    } catch(const std::runtime_error&)
+    {
+      caught = true;
+    }
+    DREAM3D_REQUIRE(caught)
+    DREAM3D_REQUIRE_EQUAL(count.load(), 101)
+    DREAM3D_REQUIRED(arena->getStatistics().Tasks, >=, 102)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### ThreadSchedulerTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestParallelFor())
+    DREAM3D_REGISTER_TEST(TestArenaLimit())
+    DREAM3D_REGISTER_TEST(TestTasks())
+  }
+};
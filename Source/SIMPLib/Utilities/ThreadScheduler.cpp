@@ -0,0 +1,882 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ThreadScheduler.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace
+{
+thread_local ThreadScheduler::Arena::Pointer t_CurrentArena;
+thread_local int t_WorkerIndex = -1;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint32_t HardwareConcurrency()
+{
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// -----------------------------------------------------------------------------
+// Pins the calling thread to the core, or lets it run on any core for a negative core
+// -----------------------------------------------------------------------------
+void PinCurrentThread(int core)
+{
+  uint32_t numCores = HardwareConcurrency();
+#if defined(_WIN32)
+  DWORD_PTR mask = 0;
+  if(core < 0)
+  {
+    for(uint32_t i = 0; i < numCores && i < sizeof(DWORD_PTR) * 8; i++)
+    {
+      mask |= static_cast<DWORD_PTR>(1) << i;
+    }
+  }
+  else
+  {
+    mask = static_cast<DWORD_PTR>(1) << (static_cast<uint32_t>(core) % numCores % (sizeof(DWORD_PTR) * 8));
+  }
+  SetThreadAffinityMask(GetCurrentThread(), mask);
+#elif defined(__linux__)
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  if(core < 0)
+  {
+    for(uint32_t i = 0; i < numCores; i++)
+    {
+      CPU_SET(i, &cpuSet);
+    }
+  }
+  else
+  {
+    CPU_SET(static_cast<uint32_t>(core) % numCores, &cpuSet);
+  }
+  pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+#else
+  (void)core;
+  (void)numCores;
+#endif
+}
+
+/**
+ * @brief Counts a region in an arena and in the scheduler for as long as it lives
+ */
+class RegionCounter
+{
+public:
+  RegionCounter(ThreadScheduler::Usage& arenaUsage, ThreadScheduler::Usage& schedulerUsage)
+  : m_ArenaUsage(arenaUsage)
+  , m_SchedulerUsage(schedulerUsage)
+  {
+    m_ArenaUsage.beginRegion();
+    m_SchedulerUsage.beginRegion();
+  }
+
+  ~RegionCounter()
+  {
+    m_ArenaUsage.endRegion();
+    m_SchedulerUsage.endRegion();
+  }
+
+  RegionCounter(const RegionCounter&) = delete;
+  RegionCounter& operator=(const RegionCounter&) = delete;
+
+private:
+  ThreadScheduler::Usage& m_ArenaUsage;
+  ThreadScheduler::Usage& m_SchedulerUsage;
+};
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+/**
+ * @brief Pins or releases the TBB worker threads as they enter the scheduler
+ */
+class PinningObserver : public tbb::task_scheduler_observer
+{
+public:
+  PinningObserver(const std::atomic<bool>& pin)
+  : m_Pin(pin)
+  {
+    observe(true);
+  }
+
+  ~PinningObserver() override
+  {
+    observe(false);
+  }
+
+  void on_scheduler_entry(bool isWorker) override
+  {
+    if(!isWorker)
+    {
+      return;
+    }
+    static std::atomic<int> s_NextCore(0);
+    thread_local int core = s_NextCore++;
+    thread_local bool pinned = false;
+    bool pin = m_Pin.load();
+    if(pin != pinned)
+    {
+      PinCurrentThread(pin ? core : -1);
+      pinned = pin;
+    }
+  }
+
+private:
+  const std::atomic<bool>& m_Pin;
+};
+#endif
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ThreadScheduler::Statistics::getUtilization() const
+{
+  return Lifetime > 0.0 ? std::min(1.0, BusyTime / Lifetime) : 0.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::Usage::Usage()
+: m_Created(std::chrono::steady_clock::now())
+, m_BusyTime(std::chrono::steady_clock::duration::zero())
+, m_Regions(0)
+, m_Tasks(0)
+, m_Steals(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThreadScheduler::Usage::beginRegion()
+{
+  m_Regions++;
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  if(m_ActiveRegions++ == 0)
+  {
+    m_BusySince = std::chrono::steady_clock::now();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThreadScheduler::Usage::endRegion()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  if(--m_ActiveRegions == 0)
+  {
+    m_BusyTime += std::chrono::steady_clock::now() - m_BusySince;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThreadScheduler::Usage::addTasks(uint64_t count)
+{
+  m_Tasks += count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThreadScheduler::Usage::addSteals(uint64_t count)
+{
+  m_Steals += count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::Statistics ThreadScheduler::Usage::getStatistics() const
+{
+  using Seconds = std::chrono::duration<double>;
+
+  Statistics statistics;
+  statistics.Regions = m_Regions.load();
+  statistics.Tasks = m_Tasks.load();
+  statistics.Steals = m_Steals.load();
+
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::duration busyTime = m_BusyTime;
+  if(m_ActiveRegions > 0)
+  {
+    busyTime += now - m_BusySince;
+  }
+  statistics.BusyTime = std::chrono::duration_cast<Seconds>(busyTime).count();
+  statistics.Lifetime = std::chrono::duration_cast<Seconds>(now - m_Created).count();
+  return statistics;
+}
+
+/**
+ * @brief The Pool class is the work-stealing thread pool that runs the parallel work when
+ * SIMPLib is built without TBB. Every worker has a deque of its own: it takes its newest task
+ * from the back and steals the oldest tasks of the others from the front once it has none.
+ * Tasks submitted by threads outside of the pool are spread over the workers in turn.
+ */
+class ThreadScheduler::Pool
+{
+public:
+  using Task = std::function<void()>;
+
+  Pool(size_t numThreads, const std::atomic<bool>& pinThreads, Usage& usage)
+  : m_PinThreads(pinThreads)
+  , m_Usage(usage)
+  , m_Pending(0)
+  , m_Stopping(false)
+  , m_NextQueue(0)
+  {
+    for(size_t i = 0; i < numThreads; i++)
+    {
+      m_Queues.emplace_back(new Queue);
+    }
+    for(size_t i = 0; i < numThreads; i++)
+    {
+      m_Threads.emplace_back([this, i]() { workerLoop(i); });
+    }
+  }
+
+  ~Pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_WakeMutex);
+      m_Stopping = true;
+    }
+    m_WakeCondition.notify_all();
+    for(auto& thread : m_Threads)
+    {
+      thread.join();
+    }
+  }
+
+  size_t size() const
+  {
+    return m_Threads.size();
+  }
+
+  /**
+   * @brief Queues the task, which runs with the arena as the current one of its thread
+   */
+  void submit(const Arena::Pointer& arena, const Task& task)
+  {
+    size_t index = (t_WorkerIndex >= 0) ? static_cast<size_t>(t_WorkerIndex) : (m_NextQueue++ % m_Queues.size());
+    // Counted before it is queued so a thread that takes it never sees the count below zero
+    {
+      std::lock_guard<std::mutex> lock(m_WakeMutex);
+      m_Pending++;
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_Queues[index]->Mutex);
+      m_Queues[index]->Tasks.push_back({arena, task});
+    }
+    m_WakeCondition.notify_one();
+  }
+
+  /**
+   * @brief Runs one queued task on the calling thread, which is how a thread that waits for
+   * its own tasks keeps busy
+   * @return false if there was no task to run
+   */
+  bool runPendingTask()
+  {
+    Entry entry;
+    if(!takeTask(t_WorkerIndex, entry))
+    {
+      return false;
+    }
+    Scope scope(entry.TaskArena);
+    entry.Function();
+    return true;
+  }
+
+private:
+  struct Entry
+  {
+    Arena::Pointer TaskArena;
+    Task Function;
+  };
+
+  struct Queue
+  {
+    std::mutex Mutex;
+    std::deque<Entry> Tasks;
+  };
+
+  /**
+   * @brief Takes the newest task of the own queue, or steals the oldest task of another
+   */
+  bool takeTask(int ownIndex, Entry& entry)
+  {
+    if(ownIndex >= 0)
+    {
+      Queue& queue = *m_Queues[static_cast<size_t>(ownIndex)];
+      std::lock_guard<std::mutex> lock(queue.Mutex);
+      if(!queue.Tasks.empty())
+      {
+        entry = std::move(queue.Tasks.back());
+        queue.Tasks.pop_back();
+        m_Pending--;
+        return true;
+      }
+    }
+    size_t start = (ownIndex >= 0) ? static_cast<size_t>(ownIndex) + 1 : 0;
+    for(size_t i = 0; i < m_Queues.size(); i++)
+    {
+      size_t victim = (start + i) % m_Queues.size();
+      if(static_cast<int>(victim) == ownIndex)
+      {
+        continue;
+      }
+      Queue& queue = *m_Queues[victim];
+      std::lock_guard<std::mutex> lock(queue.Mutex);
+      if(!queue.Tasks.empty())
+      {
+        entry = std::move(queue.Tasks.front());
+        queue.Tasks.pop_front();
+        m_Pending--;
+        if(ownIndex >= 0)
+        {
+          m_Usage.addSteals(1);
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void workerLoop(size_t index)
+  {
+    t_WorkerIndex = static_cast<int>(index);
+    bool pinned = false;
+    for(;;)
+    {
+      bool pin = m_PinThreads.load();
+      if(pin != pinned)
+      {
+        // The threads that start parallel work usually run on the first core
+        PinCurrentThread(pin ? static_cast<int>(index + 1) : -1);
+        pinned = pin;
+      }
+
+      if(runPendingTask())
+      {
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(m_WakeMutex);
+      m_WakeCondition.wait(lock, [this] { return m_Stopping || m_Pending > 0; });
+      if(m_Stopping)
+      {
+        return;
+      }
+    }
+  }
+
+  const std::atomic<bool>& m_PinThreads;
+  Usage& m_Usage;
+  std::vector<std::unique_ptr<Queue>> m_Queues;
+  std::vector<std::thread> m_Threads;
+  std::mutex m_WakeMutex;
+  std::condition_variable m_WakeCondition;
+  std::atomic<size_t> m_Pending;
+  bool m_Stopping;
+  std::atomic<size_t> m_NextQueue;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::Arena::Arena(uint32_t maxConcurrency, bool isolated)
+: m_MaxConcurrency(std::max(1u, maxConcurrency))
+, m_ActiveThreads(0)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(isolated)
+  {
+    m_TaskArena.reset(new tbb::task_arena(static_cast<int>(m_MaxConcurrency)));
+  }
+#else
+  (void)isolated;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::Arena::~Arena() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint32_t ThreadScheduler::Arena::getMaxConcurrency() const
+{
+  return m_MaxConcurrency;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::Statistics ThreadScheduler::Arena::getStatistics() const
+{
+  return m_Usage.getStatistics();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThreadScheduler::Arena::execute(const std::function<void()>& region)
+{
+  RegionCounter counter(m_Usage, ThreadScheduler::Instance()->m_Usage);
+  Scope scope(shared_from_this());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(nullptr != m_TaskArena.get())
+  {
+    m_TaskArena->execute(region);
+    return;
+  }
+#endif
+  region();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::Scope::Scope(const Arena::Pointer& arena)
+: m_Previous(t_CurrentArena)
+{
+  t_CurrentArena = arena;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::Scope::~Scope()
+{
+  t_CurrentArena = m_Previous;
+}
+
+#ifndef SIMPL_USE_PARALLEL_ALGORITHMS
+/**
+ * @brief What the tasks of a TaskGroup share with it while they run on the pool
+ */
+struct ThreadScheduler::TaskGroup::State
+{
+  std::atomic<size_t> Pending = {0};
+  std::atomic<bool> Failed = {false};
+  std::mutex Mutex;
+  std::exception_ptr Error;
+
+  /**
+   * @brief Runs the task unless an earlier task of the group threw, which is what
+   * tbb::task_group does with the tasks it has not started
+   */
+  void execute(const std::function<void()>& task)
+  {
+    if(Failed)
+    {
+      return;
+    }
+    try
+    {
+      task();
+    } catch(...)
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      if(!Error)
+      {
+        Error = std::current_exception();
+      }
+      Failed = true;
+    }
+  }
+};
+#endif
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::TaskGroup::TaskGroup()
+: m_Arena(ThreadScheduler::CurrentArena())
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+, m_TaskGroup(new tbb::task_group)
+#else
+, m_State(new State)
+#endif
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::TaskGroup::~TaskGroup()
+{
+  try
+  {
+    wait();
+  } catch(...)
+  {
+    // The tasks must not outlive the group, an exception nobody waited for is lost
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThreadScheduler::TaskGroup::run(const std::function<void()>& task)
+{
+  ThreadScheduler* scheduler = ThreadScheduler::Instance();
+  if(!m_InRegion)
+  {
+    m_Arena->m_Usage.beginRegion();
+    scheduler->m_Usage.beginRegion();
+    m_InRegion = true;
+  }
+  m_Arena->m_Usage.addTasks(1);
+  scheduler->m_Usage.addTasks(1);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(nullptr != m_Arena->m_TaskArena.get())
+  {
+    m_Arena->m_TaskArena->execute([this, &task] { m_TaskGroup->run(task); });
+  }
+  else
+  {
+    m_TaskGroup->run(task);
+  }
+#else
+  if(nullptr == scheduler->m_Pool.get())
+  {
+    // Without worker threads the task runs right here, its exception still waits for wait()
+    m_State->execute(task);
+    return;
+  }
+  std::shared_ptr<State> state = m_State;
+  state->Pending++;
+  scheduler->m_Pool->submit(m_Arena, [state, task] {
+    state->execute(task);
+    state->Pending--;
+  });
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThreadScheduler::TaskGroup::wait()
+{
+  if(!m_InRegion)
+  {
+    return;
+  }
+  m_InRegion = false;
+
+  ThreadScheduler* scheduler = ThreadScheduler::Instance();
+  std::exception_ptr error;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  try
+  {
+    if(nullptr != m_Arena->m_TaskArena.get())
+    {
+      m_Arena->m_TaskArena->execute([this] { m_TaskGroup->wait(); });
+    }
+    else
+    {
+      m_TaskGroup->wait();
+    }
+  } catch(...)
+  {
+    error = std::current_exception();
+  }
+#else
+  while(m_State->Pending > 0)
+  {
+    if(!scheduler->m_Pool->runPendingTask())
+    {
+      std::this_thread::yield();
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_State->Mutex);
+    std::swap(error, m_State->Error);
+    m_State->Failed = false;
+  }
+#endif
+
+  m_Arena->m_Usage.endRegion();
+  scheduler->m_Usage.endRegion();
+  if(error)
+  {
+    std::rethrow_exception(error);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler* ThreadScheduler::Instance()
+{
+  static ThreadScheduler scheduler;
+  return &scheduler;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::ThreadScheduler()
+: m_ThreadPinning(false)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  uint32_t concurrency = static_cast<uint32_t>(tbb::this_task_arena::max_concurrency());
+#else
+  uint32_t concurrency = HardwareConcurrency();
+  if(concurrency > 1)
+  {
+    m_Pool.reset(new Pool(concurrency - 1, m_ThreadPinning, m_Usage));
+  }
+#endif
+  m_DefaultArena = Arena::Pointer(new Arena(concurrency, false));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::~ThreadScheduler() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::Arena::Pointer ThreadScheduler::CurrentArena()
+{
+  if(nullptr != t_CurrentArena.get())
+  {
+    return t_CurrentArena;
+  }
+  return Instance()->m_DefaultArena;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::Arena::Pointer ThreadScheduler::createArena(uint32_t maxConcurrency)
+{
+  uint32_t concurrency = m_DefaultArena->getMaxConcurrency();
+  if(maxConcurrency > 0)
+  {
+    concurrency = std::min(maxConcurrency, concurrency);
+  }
+  return Arena::Pointer(new Arena(concurrency, true));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::Arena::Pointer ThreadScheduler::getDefaultArena() const
+{
+  return m_DefaultArena;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint32_t ThreadScheduler::getMaxConcurrency() const
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  // TBB worker threads know the arena they work in, but not the Scope it came from
+  if(nullptr == t_CurrentArena.get())
+  {
+    return static_cast<uint32_t>(tbb::this_task_arena::max_concurrency());
+  }
+#endif
+  return CurrentArena()->getMaxConcurrency();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThreadScheduler::setThreadPinning(bool pin)
+{
+  m_ThreadPinning = pin;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  std::lock_guard<std::mutex> lock(m_PinningMutex);
+  if(pin && nullptr == m_PinningObserver.get())
+  {
+    m_PinningObserver.reset(new PinningObserver(m_ThreadPinning));
+  }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ThreadScheduler::getThreadPinning() const
+{
+  return m_ThreadPinning;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThreadScheduler::Statistics ThreadScheduler::getStatistics() const
+{
+  return m_Usage.getStatistics();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThreadScheduler::execute(const std::function<void()>& region)
+{
+  CurrentArena()->execute(region);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThreadScheduler::parallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t, size_t)>& body)
+{
+  if(end <= begin)
+  {
+    return;
+  }
+
+  Arena::Pointer arena = CurrentArena();
+  RegionCounter counter(arena->m_Usage, m_Usage);
+
+  // A few pieces per thread lets the threads that finish early take over from the others
+  grain = std::max<size_t>(grain, 1);
+  size_t concurrency = std::min<size_t>(arena->getMaxConcurrency(), (nullptr == m_Pool.get()) ? 1 : m_Pool->size() + 1);
+  size_t numChunks = std::min((end - begin + grain - 1) / grain, concurrency * 4);
+  if(numChunks <= 1 || concurrency <= 1)
+  {
+    arena->m_Usage.addTasks(1);
+    m_Usage.addTasks(1);
+    body(begin, end);
+    return;
+  }
+
+  struct Region
+  {
+    std::atomic<size_t> NextChunk = {0};
+    std::atomic<size_t> DoneChunks = {0};
+    std::atomic<bool> Failed = {false};
+    std::mutex Mutex;
+    std::exception_ptr Error;
+  };
+  std::shared_ptr<Region> region = std::make_shared<Region>();
+
+  // The helpers may start after the work is done, so they only touch the body when they got a piece of it
+  const std::function<void(size_t, size_t)>* bodyPtr = &body;
+  size_t chunkSize = (end - begin) / numChunks;
+  size_t remainder = (end - begin) % numChunks;
+  Usage* schedulerUsage = &m_Usage;
+  auto runChunks = [region, arena, bodyPtr, begin, chunkSize, remainder, numChunks, schedulerUsage]() {
+    for(;;)
+    {
+      size_t chunk = region->NextChunk++;
+      if(chunk >= numChunks)
+      {
+        return;
+      }
+      size_t chunkBegin = begin + chunk * chunkSize + std::min(chunk, remainder);
+      size_t chunkEnd = chunkBegin + chunkSize + (chunk < remainder ? 1 : 0);
+      if(!region->Failed)
+      {
+        try
+        {
+          (*bodyPtr)(chunkBegin, chunkEnd);
+        } catch(...)
+        {
+          std::lock_guard<std::mutex> lock(region->Mutex);
+          if(!region->Error)
+          {
+            region->Error = std::current_exception();
+          }
+          region->Failed = true;
+        }
+      }
+      arena->m_Usage.addTasks(1);
+      schedulerUsage->addTasks(1);
+      region->DoneChunks++;
+    }
+  };
+
+  // Helpers that find the arena at its limit leave the pieces to the threads already on it
+  size_t numHelpers = std::min(numChunks, concurrency) - 1;
+  for(size_t i = 0; i < numHelpers; i++)
+  {
+    m_Pool->submit(arena, [arena, runChunks]() {
+      if(arena->m_ActiveThreads++ < arena->m_MaxConcurrency)
+      {
+        runChunks();
+      }
+      arena->m_ActiveThreads--;
+    });
+  }
+
+  arena->m_ActiveThreads++;
+  {
+    Scope scope(arena);
+    runChunks();
+  }
+  arena->m_ActiveThreads--;
+
+  while(region->DoneChunks < numChunks)
+  {
+    if(!m_Pool->runPendingTask())
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  if(region->Error)
+  {
+    std::rethrow_exception(region->Error);
+  }
+}
@@ -0,0 +1,333 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+// SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+// clang-format off
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+#include <tbb/task_scheduler_observer.h>
+// clang-format on
+#endif
+
+/**
+ * @brief The ThreadScheduler class is where the parallel algorithms of SIMPLib get their threads
+ * from. ParallelDataAlgorithm, ParallelData2DAlgorithm, ParallelData3DAlgorithm and
+ * ParallelTaskAlgorithm all run their work through the Instance().
+ *
+ * Parallel work runs in an Arena, which caps how many threads it uses at once. A thread that
+ * entered a Scope runs its parallel work in the arena of that Scope, everything else runs in
+ * the default arena of the process. FilterPipeline::execute() enters an arena of its own when
+ * it has a thread limit, which keeps pipelines that run at the same time, in the REST server
+ * or a PipelineBatch, from each taking every core.
+ *
+ * With TBB the arenas are tbb::task_arena objects that share the TBB worker threads. Without
+ * TBB the scheduler keeps a work-stealing pool of one thread less than the hardware concurrency,
+ * and the thread that starts the parallel work always takes part in it.
+ */
+class SIMPLib_EXPORT ThreadScheduler
+{
+public:
+  SIMPL_TYPE_MACRO(ThreadScheduler)
+
+  /**
+   * @brief The utilization of an arena or of the whole scheduler. Regions counts the parallel
+   * loops and task groups that ran and Tasks the pieces of work they were split into; Steals
+   * counts the tasks the built-in pool moved between threads. BusyTime is the time in seconds
+   * at least one region was running and Lifetime the time since the counting started.
+   */
+  struct Statistics
+  {
+    uint64_t Regions = 0;
+    uint64_t Tasks = 0;
+    uint64_t Steals = 0;
+    double BusyTime = 0.0;
+    double Lifetime = 0.0;
+
+    /**
+     * @brief Returns the share of the Lifetime that was BusyTime, between 0 and 1
+     * @return
+     */
+    double getUtilization() const;
+  };
+
+  /**
+   * @brief The Usage class keeps the counts behind the Statistics of an arena or the scheduler.
+   */
+  class SIMPLib_EXPORT Usage
+  {
+  public:
+    Usage();
+
+    void beginRegion();
+    void endRegion();
+    void addTasks(uint64_t count);
+    void addSteals(uint64_t count);
+
+    Statistics getStatistics() const;
+
+  private:
+    mutable std::mutex m_Mutex;
+    size_t m_ActiveRegions = 0;
+    std::chrono::steady_clock::time_point m_Created;
+    std::chrono::steady_clock::time_point m_BusySince;
+    std::chrono::steady_clock::duration m_BusyTime;
+    std::atomic<uint64_t> m_Regions;
+    std::atomic<uint64_t> m_Tasks;
+    std::atomic<uint64_t> m_Steals;
+  };
+
+  class TaskGroup;
+
+  /**
+   * @brief The Arena class is a set of threads of at most MaxConcurrency, counting the caller.
+   */
+  class SIMPLib_EXPORT Arena : public std::enable_shared_from_this<Arena>
+  {
+  public:
+    SIMPL_SHARED_POINTERS(Arena)
+
+    virtual ~Arena();
+
+    /**
+     * @brief Returns the most threads the arena runs at once
+     * @return
+     */
+    uint32_t getMaxConcurrency() const;
+
+    /**
+     * @brief Returns the utilization of the arena since it was created
+     * @return
+     */
+    Statistics getStatistics() const;
+
+    /**
+     * @brief Runs the region on the calling thread inside the arena, counting it as one region.
+     * The parallel work the region starts uses the threads of the arena.
+     * @param region
+     */
+    void execute(const std::function<void()>& region);
+
+  protected:
+    Arena(uint32_t maxConcurrency, bool isolated);
+
+  private:
+    friend class ThreadScheduler;
+    friend class TaskGroup;
+
+    uint32_t m_MaxConcurrency = 1;
+    Usage m_Usage;
+    std::atomic<uint32_t> m_ActiveThreads;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    std::unique_ptr<tbb::task_arena> m_TaskArena;
+#endif
+
+  public:
+    Arena(const Arena&) = delete;            // Copy Constructor Not Implemented
+    Arena(Arena&&) = delete;                 // Move Constructor Not Implemented
+    Arena& operator=(const Arena&) = delete; // Copy Assignment Not Implemented
+    Arena& operator=(Arena&&) = delete;      // Move Assignment Not Implemented
+  };
+
+  /**
+   * @brief The Scope class makes an arena the current one of the calling thread for as long
+   * as it lives. Threads a filter starts itself must enter the arena of the thread that
+   * started them to stay within its limit.
+   */
+  class SIMPLib_EXPORT Scope
+  {
+  public:
+    Scope(const Arena::Pointer& arena);
+    ~Scope();
+
+  private:
+    Arena::Pointer m_Previous;
+
+  public:
+    Scope(const Scope&) = delete;            // Copy Constructor Not Implemented
+    Scope(Scope&&) = delete;                 // Move Constructor Not Implemented
+    Scope& operator=(const Scope&) = delete; // Copy Assignment Not Implemented
+    Scope& operator=(Scope&&) = delete;      // Move Assignment Not Implemented
+  };
+
+  /**
+   * @brief The TaskGroup class runs tasks in the arena that was current when it was created,
+   * until wait() is called. Destroying the group waits for its tasks. Once a task throws, the
+   * tasks of the group that have not started yet may be skipped; only the tasks a caller
+   * waited for before that are sure to have run.
+   */
+  class SIMPLib_EXPORT TaskGroup
+  {
+  public:
+    TaskGroup();
+    virtual ~TaskGroup();
+
+    /**
+     * @brief Starts the task on a thread of the arena
+     * @param task
+     */
+    void run(const std::function<void()>& task);
+
+    /**
+     * @brief Waits for the tasks started so far, rethrowing the first exception one of them threw.
+     * The group can run new tasks afterwards.
+     */
+    void wait();
+
+  private:
+    Arena::Pointer m_Arena;
+    bool m_InRegion = false;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    std::unique_ptr<tbb::task_group> m_TaskGroup;
+#else
+    struct State;
+    std::shared_ptr<State> m_State;
+#endif
+
+  public:
+    TaskGroup(const TaskGroup&) = delete;            // Copy Constructor Not Implemented
+    TaskGroup(TaskGroup&&) = delete;                 // Move Constructor Not Implemented
+    TaskGroup& operator=(const TaskGroup&) = delete; // Copy Assignment Not Implemented
+    TaskGroup& operator=(TaskGroup&&) = delete;      // Move Assignment Not Implemented
+  };
+
+  /**
+   * @brief Returns the scheduler of the process
+   * @return
+   */
+  static ThreadScheduler* Instance();
+
+  virtual ~ThreadScheduler();
+
+  /**
+   * @brief Returns the arena of the innermost Scope of the calling thread, or the default arena
+   * @return
+   */
+  static Arena::Pointer CurrentArena();
+
+  /**
+   * @brief Creates an arena that runs at most maxConcurrency threads at once, 0 or more than
+   * the default arena has giving it as many as the default arena
+   * @param maxConcurrency
+   * @return
+   */
+  Arena::Pointer createArena(uint32_t maxConcurrency);
+
+  /**
+   * @brief Returns the arena work runs in outside of any Scope
+   * @return
+   */
+  Arena::Pointer getDefaultArena() const;
+
+  /**
+   * @brief Returns the most threads the parallel work of the calling thread runs on at once
+   * @return
+   */
+  uint32_t getMaxConcurrency() const;
+
+  /**
+   * @brief The thread limit FilterPipeline uses for pipelines that do not set MaxThreads
+   * themselves, 0 for none
+   */
+  SIMPL_INSTANCE_PROPERTY(uint32_t, MaxThreadsPerPipeline)
+
+  /**
+   * @brief Pins each worker thread to one core, or releases them again. This takes effect
+   * as the worker threads next pick up work. Pinning is only supported on Linux and Windows.
+   * @param pin
+   */
+  void setThreadPinning(bool pin);
+
+  /**
+   * @brief Returns true if worker threads are pinned to cores
+   * @return
+   */
+  bool getThreadPinning() const;
+
+  /**
+   * @brief Returns the utilization of all arenas together since the scheduler started
+   * @return
+   */
+  Statistics getStatistics() const;
+
+  /**
+   * @brief Runs the region in the current arena, see Arena::execute()
+   * @param region
+   */
+  void execute(const std::function<void()>& region);
+
+  /**
+   * @brief Runs the body over [begin, end) in pieces of at least grain indices on the threads
+   * of the current arena and returns once all of them are done. This is what the parallel
+   * algorithms use when SIMPLib is built without TBB.
+   * @param begin
+   * @param end
+   * @param grain
+   * @param body Called with the begin and end of each piece
+   */
+  void parallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t, size_t)>& body);
+
+protected:
+  ThreadScheduler();
+
+private:
+  class Pool;
+
+  Arena::Pointer m_DefaultArena;
+  Usage m_Usage;
+  std::atomic<bool> m_ThreadPinning;
+  std::unique_ptr<Pool> m_Pool;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  std::unique_ptr<tbb::task_scheduler_observer> m_PinningObserver;
+  std::mutex m_PinningMutex;
+#endif
+
+public:
+  ThreadScheduler(const ThreadScheduler&) = delete;            // Copy Constructor Not Implemented
+  ThreadScheduler(ThreadScheduler&&) = delete;                 // Move Constructor Not Implemented
+  ThreadScheduler& operator=(const ThreadScheduler&) = delete; // Copy Assignment Not Implemented
+  ThreadScheduler& operator=(ThreadScheduler&&) = delete;      // Move Assignment Not Implemented
+};